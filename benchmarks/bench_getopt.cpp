@@ -0,0 +1,183 @@
+// The overhead of structopt over hand-written getopt_long code, which is what a
+// latency-sensitive CLI would otherwise use
+//
+// Both parse the same argument lists into the same values: the options of
+// samples/demo.cpp, a few more flags, and positional files. `getopt/<case>/structopt`
+// prints its time as a multiple of `getopt/<case>/getopt_long`, and fails --check
+// above `max_ratio` when time checks are enabled, i.e., ctest with
+// STRUCTOPT_BENCH_TIME_TOLERANCE. Lower the ratios here when parser.hpp gets faster
+#include "harness.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
+#include <iostream>
+#include <string>
+#include <structopt/app.hpp>
+#include <vector>
+
+using structopt_bench::argument_list;
+using structopt_bench::registrar;
+
+namespace {
+
+enum class LogLevel { debug, info, warn, error, critical };
+
+} // namespace
+
+struct GetoptOptions {
+  std::string config_file;
+  std::optional<std::string> bind_address;
+  std::optional<bool> verbose = false;
+  std::optional<bool> quiet = false;
+  std::optional<bool> force = false;
+  std::optional<LogLevel> log_level = LogLevel::info;
+  std::optional<int> jobs;
+  std::vector<std::string> files;
+};
+STRUCTOPT(GetoptOptions, config_file, bind_address, verbose, quiet, force, log_level,
+          jobs, files);
+
+namespace {
+
+// What the getopt_long code fills: the same values, without std::optional
+struct plain_options {
+  std::string config_file;
+  std::string bind_address;
+  bool verbose = false;
+  bool quiet = false;
+  bool force = false;
+  LogLevel log_level = LogLevel::info;
+  int jobs = 0;
+  std::vector<std::string> files;
+};
+
+// The usual getopt_long loop, with the same validation as structopt
+bool parse_with_getopt(int argc, char *argv[], plain_options &options) {
+  static const option long_options[] = {
+      {"bind-address", required_argument, nullptr, 'b'},
+      {"verbose", no_argument, nullptr, 'v'},
+      {"quiet", no_argument, nullptr, 'q'},
+      {"force", no_argument, nullptr, 'f'},
+      {"log-level", required_argument, nullptr, 'l'},
+      {"jobs", required_argument, nullptr, 'j'},
+      {nullptr, 0, nullptr, 0}};
+  static const char *const log_levels[] = {"debug", "info", "warn", "error", "critical"};
+
+  // getopt_long keeps its state in globals
+#ifdef __GLIBC__
+  optind = 0;
+#else
+  optreset = 1;
+  optind = 1;
+#endif
+  opterr = 0;
+  for (int c; (c = getopt_long(argc, argv, "b:vqfl:j:", long_options, nullptr)) != -1;) {
+    switch (c) {
+    case 'b':
+      options.bind_address = optarg;
+      break;
+    case 'v':
+      options.verbose = !options.verbose;
+      break;
+    case 'q':
+      options.quiet = !options.quiet;
+      break;
+    case 'f':
+      options.force = !options.force;
+      break;
+    case 'l': {
+      int level = 0;
+      while (level < 5 && std::strcmp(optarg, log_levels[level]) != 0) {
+        level++;
+      }
+      if (level == 5) {
+        return false;
+      }
+      options.log_level = static_cast<LogLevel>(level);
+      break;
+    }
+    case 'j': {
+      char *end = nullptr;
+      const long jobs = std::strtol(optarg, &end, 0);
+      if (*optarg == '\0' || *end != '\0') {
+        return false;
+      }
+      options.jobs = static_cast<int>(jobs);
+      break;
+    }
+    default:
+      return false;
+    }
+  }
+  if (optind == argc) {
+    return false;
+  }
+  options.config_file = argv[optind++];
+  options.files.assign(argv + optind, argv + argc);
+  return true;
+}
+
+std::function<void()> getopt_long_case(std::vector<std::string> arguments) {
+  arguments.insert(arguments.begin(), "./bench");
+  return [list = argument_list(std::move(arguments))]() mutable {
+    plain_options options;
+    if (!parse_with_getopt(list.argc(), list.argv(), options)) {
+      std::cerr << "getopt_long failed\n";
+      std::abort();
+    }
+    structopt_bench::do_not_optimize(options);
+  };
+}
+
+std::function<void()> structopt_case(std::vector<std::string> arguments) {
+  arguments.insert(arguments.begin(), "./bench");
+  return [app = structopt::app("bench"),
+          list = argument_list(std::move(arguments))]() mutable {
+    auto result = app.try_parse<GetoptOptions>(list.argc(), list.argv());
+    if (!result.has_value()) {
+      std::cerr << result.error().message() << "\n";
+      std::abort();
+    }
+    structopt_bench::do_not_optimize(result);
+  };
+}
+
+// Registers `getopt/<name>/getopt_long` and `getopt/<name>/structopt`
+struct comparison {
+  registrar getopt_long;
+  registrar structopt;
+
+  comparison(const std::string &name, const std::vector<std::string> &arguments,
+             double max_ratio)
+      : getopt_long("getopt/" + name + "/getopt_long", getopt_long_case(arguments)),
+        structopt("getopt/" + name + "/structopt", structopt_case(arguments),
+                  "getopt/" + name + "/getopt_long", max_ratio) {}
+};
+
+std::vector<std::string> files(std::vector<std::string> arguments, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++) {
+    arguments.push_back("src/module_" + std::to_string(i) + "/file.cpp");
+  }
+  return arguments;
+}
+
+// The maximum ratios are about twice the ones measured when they were set, as the
+// ratios of these sub-microsecond parses vary by up to 1.5x from run to run
+const comparison flags("flags", {"-v", "-q", "-f", "app.toml"}, 5);
+const comparison combined("combined", {"-vqf", "app.toml"}, 6);
+const comparison values("values",
+                        {"--bind-address", "127.0.0.1", "--log-level", "debug",
+                         "--jobs", "8", "app.toml"},
+                        5);
+const comparison equals("equals",
+                        {"--bind-address=127.0.0.1", "--log-level=debug", "--jobs=8",
+                         "app.toml"},
+                        8);
+const comparison positional("positional", files({"app.toml"}, 64), 3.5);
+const comparison mixed("mixed",
+                       files({"-vq", "-b", "127.0.0.1", "--log-level=warn", "-j", "4",
+                              "app.toml"},
+                             16),
+                       5);
+
+} // namespace
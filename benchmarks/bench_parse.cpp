@@ -0,0 +1,298 @@
+// Parse latency and allocations along the axes that drive the cost of a parse: the
+// number of fields, the number of tokens, the depth of sub-commands, the number of
+// container elements and the number of enumerators
+#include "harness.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <structopt/app.hpp>
+#include <vector>
+
+using structopt_bench::argument_list;
+using structopt_bench::registrar;
+
+namespace {
+
+// try_parse `arguments` into a T; a failed parse is a bug in the benchmark
+template <typename T> std::function<void()> parse(std::vector<std::string> arguments) {
+  arguments.insert(arguments.begin(), "./bench");
+  return [app = structopt::app("bench"),
+          list = argument_list(std::move(arguments))]() mutable {
+    auto result = app.try_parse<T>(list.argc(), list.argv());
+    if (!result.has_value()) {
+      std::cerr << result.error().message() << "\n";
+      std::abort();
+    }
+    structopt_bench::do_not_optimize(result);
+  };
+}
+
+} // namespace
+
+// fields/N: N options, all given, e.g., `--f0 0 --f1 1 ...`
+struct Fields4 {
+  std::optional<int> f0, f1, f2, f3;
+};
+STRUCTOPT(Fields4, f0, f1, f2, f3);
+
+struct Fields16 {
+  std::optional<int> f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15;
+};
+STRUCTOPT(Fields16, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+
+struct Fields64 {
+  std::optional<int> f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15,
+                     f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29,
+                     f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43,
+                     f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57,
+                     f58, f59, f60, f61, f62, f63;
+};
+STRUCTOPT(Fields64, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15,
+          f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31,
+          f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47,
+          f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62, f63);
+
+template <std::size_t N> std::vector<std::string> all_fields() {
+  std::vector<std::string> arguments;
+  for (std::size_t i = 0; i < N; i++) {
+    arguments.push_back("--f" + std::to_string(i));
+    arguments.push_back(std::to_string(i));
+  }
+  return arguments;
+}
+
+static const registrar fields_4("fields/4", parse<Fields4>(all_fields<4>()));
+static const registrar fields_16("fields/16", parse<Fields16>(all_fields<16>()));
+static const registrar fields_64("fields/64", parse<Fields64>(all_fields<64>()));
+
+// tokens/N: a flag, an option and N - 3 positional strings
+struct TokenOptions {
+  std::optional<bool> verbose = false;
+  std::optional<int> jobs;
+  std::vector<std::string> files;
+};
+STRUCTOPT(TokenOptions, verbose, jobs, files);
+
+static std::vector<std::string> tokens(std::size_t count) {
+  std::vector<std::string> arguments{"-v", "--jobs", "4"};
+  for (std::size_t i = arguments.size(); i < count; i++) {
+    arguments.push_back("src/module_" + std::to_string(i) + "/file.cpp");
+  }
+  return arguments;
+}
+
+static const registrar tokens_8("tokens/8", parse<TokenOptions>(tokens(8)));
+static const registrar tokens_256("tokens/256", parse<TokenOptions>(tokens(256)));
+static const registrar tokens_8192("tokens/8192", parse<TokenOptions>(tokens(8192)));
+
+// depth/D: D nested sub-commands, each with an option, e.g.,
+// `--value 0 next --value 1 next --value 2`
+struct Level4 : structopt::sub_command {
+  std::optional<int> value;
+};
+STRUCTOPT(Level4, value);
+
+struct Level3 : structopt::sub_command {
+  std::optional<int> value;
+  Level4 next;
+};
+STRUCTOPT(Level3, value, next);
+
+struct Level2 : structopt::sub_command {
+  std::optional<int> value;
+  Level3 next;
+};
+STRUCTOPT(Level2, value, next);
+
+struct Level1 : structopt::sub_command {
+  std::optional<int> value;
+  Level2 next;
+};
+STRUCTOPT(Level1, value, next);
+
+struct Level0 {
+  std::optional<int> value;
+  Level1 next;
+};
+STRUCTOPT(Level0, value, next);
+
+static std::vector<std::string> levels(int depth) {
+  std::vector<std::string> arguments{"--value", "0"};
+  for (int level = 1; level <= depth; level++) {
+    arguments.insert(arguments.end(), {"next", "--value", std::to_string(level)});
+  }
+  return arguments;
+}
+
+static const registrar depth_0("depth/0", parse<Level0>(levels(0)));
+static const registrar depth_1("depth/1", parse<Level0>(levels(1)));
+static const registrar depth_4("depth/4", parse<Level0>(levels(4)));
+
+// elements/N: N integers into a positional std::vector<int>
+struct ElementOptions {
+  std::vector<int> values;
+};
+STRUCTOPT(ElementOptions, values);
+
+static std::vector<std::string> elements(std::size_t count) {
+  std::vector<std::string> arguments;
+  for (std::size_t i = 0; i < count; i++) {
+    arguments.push_back(std::to_string(i * 7919 % 100000));
+  }
+  return arguments;
+}
+
+static const registrar elements_16("elements/16", parse<ElementOptions>(elements(16)));
+static const registrar elements_1024("elements/1024",
+                                     parse<ElementOptions>(elements(1024)));
+static const registrar elements_65536("elements/65536",
+                                      parse<ElementOptions>(elements(65536)));
+
+// numbers/structopt: 1024 doubles into a positional std::vector<double>, against the
+// std::istringstream conversion structopt used to do
+struct NumberOptions {
+  std::vector<double> values;
+};
+STRUCTOPT(NumberOptions, values);
+
+static std::vector<std::string> numbers() {
+  std::vector<std::string> arguments;
+  for (std::size_t i = 0; i < 1024; i++) {
+    arguments.push_back(std::to_string(static_cast<double>(i) * 0.37));
+  }
+  return arguments;
+}
+
+static const registrar numbers_istringstream("numbers/istringstream",
+                                             [list = numbers()]() {
+                                               std::vector<double> values;
+                                               for (const auto &argument : list) {
+                                                 std::istringstream stream(argument);
+                                                 double value{};
+                                                 stream >> value;
+                                                 values.push_back(value);
+                                               }
+                                               structopt_bench::do_not_optimize(values);
+                                             });
+static const registrar numbers_structopt("numbers/structopt",
+                                         parse<NumberOptions>(numbers()),
+                                         "numbers/istringstream");
+
+// enums/N: 64 values of an enum with N enumerators, cycling through all of them
+enum class Enum4 { e0, e1, e2, e3 };
+
+enum class Enum32 { e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15,
+  e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31 };
+
+enum class Enum128 { e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15,
+  e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32,
+  e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49,
+  e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, e64, e65, e66,
+  e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83,
+  e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100,
+  e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114,
+  e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127 };
+
+template <typename E> struct EnumOptions {
+  std::vector<E> values;
+};
+STRUCTOPT(EnumOptions<Enum4>, values);
+STRUCTOPT(EnumOptions<Enum32>, values);
+STRUCTOPT(EnumOptions<Enum128>, values);
+
+static std::vector<std::string> enumerators(std::size_t count) {
+  std::vector<std::string> arguments;
+  for (std::size_t i = 0; i < 64; i++) {
+    arguments.push_back("e" + std::to_string(i % count));
+  }
+  return arguments;
+}
+
+static const registrar enums_4("enums/4", parse<EnumOptions<Enum4>>(enumerators(4)));
+static const registrar enums_32("enums/32", parse<EnumOptions<Enum32>>(enumerators(32)));
+static const registrar enums_128("enums/128",
+                                 parse<EnumOptions<Enum128>>(enumerators(128)));
+
+// delimited/N: N delimited options and a combined flag argument after every 8th, e.g.,
+// `--f0=0 --f1:1 ... -vq`
+struct DelimitedOptions {
+  std::optional<int> f0, f1, f2, f3;
+  std::optional<bool> verbose = false;
+  std::optional<bool> quiet = false;
+};
+STRUCTOPT(DelimitedOptions, f0, f1, f2, f3, verbose, quiet);
+
+static std::vector<std::string> delimited(std::size_t count) {
+  std::vector<std::string> arguments;
+  for (std::size_t i = 0; i < count; i++) {
+    arguments.push_back("--f" + std::to_string(i % 4) + (i % 2 == 0 ? "=" : ":") +
+                        std::to_string(i));
+    if (i % 8 == 7) {
+      arguments.push_back("-vq");
+    }
+  }
+  return arguments;
+}
+
+static const registrar delimited_64("delimited/64",
+                                    parse<DelimitedOptions>(delimited(64)));
+static const registrar delimited_8192("delimited/8192",
+                                      parse<DelimitedOptions>(delimited(8192)));
+
+// classify/token_kind: tells options from values in a mix of 16 tokens, against the
+// is_valid_number test structopt used to do
+static const std::vector<std::string> token_mix{
+    "--verbose", "-v", "-abc", "--log-level=debug", "input.txt", "/usr/include/a.h",
+    "42", "-3.15", "0x5B", "--output", "build/out", "2E-4", "--", "-std:c++17",
+    "release", "-1"};
+
+static const registrar classify_is_number("classify/is_number", []() {
+  std::size_t options = 0;
+  for (const auto &token : token_mix) {
+    options += token != "--" && !structopt::details::is_valid_number(token) &&
+               token.size() >= 2 && token[0] == '-';
+  }
+  structopt_bench::do_not_optimize(options);
+});
+static const registrar classify_token_kind(
+    "classify/token_kind",
+    []() {
+      using structopt::details::token_kind;
+      std::size_t options = 0;
+      for (const auto &token : token_mix) {
+        const auto kind = structopt::details::classify_token(token);
+        options += kind != token_kind::literal && kind != token_kind::number &&
+                   kind != token_kind::double_dash;
+      }
+      structopt_bench::do_not_optimize(options);
+    },
+    "classify/is_number");
+
+// batch/N: parse_batch of 1024 job specs on N threads, whatever the number of cores, so
+// that the allocations do not depend on the machine; N > 1 print their time relative
+// to batch/1
+struct JobOptions {
+  std::string name;
+  std::vector<std::string> inputs;
+  std::optional<int> priority = 0;
+  std::optional<double> timeout;
+  std::optional<bool> retry = false;
+};
+STRUCTOPT(JobOptions, name, inputs, priority, timeout, retry);
+
+static std::function<void()> parse_batch(std::size_t num_threads) {
+  std::vector<std::vector<std::string>> job_specs;
+  for (std::size_t i = 0; i < 1024; i++) {
+    job_specs.push_back({"./job", "--priority", std::to_string(i), "--timeout", "2.5",
+                         "-r", "job" + std::to_string(i), "a.txt", "b.txt", "c.txt"});
+  }
+  return [app = structopt::app("job"), job_specs, num_threads]() {
+    structopt_bench::do_not_optimize(app.parse_batch<JobOptions>(job_specs, num_threads));
+  };
+}
+
+static const registrar batch_1("batch/1", parse_batch(1));
+static const registrar batch_2("batch/2", parse_batch(2), "batch/1");
+static const registrar batch_4("batch/4", parse_batch(4), "batch/1");
+static const registrar batch_8("batch/8", parse_batch(8), "batch/1");
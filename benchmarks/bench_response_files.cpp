@@ -0,0 +1,90 @@
+// Throughput of expanding a large response file, on 1, 2, 4 and 8 threads
+#include "harness.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <structopt/app.hpp>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+using structopt_bench::registrar;
+
+struct FileListOptions {
+  std::vector<std::string> files;
+};
+STRUCTOPT(FileListOptions, files);
+
+namespace {
+
+// A file name no other run of the benchmarks uses at the same time
+std::filesystem::path unique_temp_path() {
+  static std::atomic<int> counter{0};
+#ifdef _WIN32
+  const auto pid = _getpid();
+#else
+  const auto pid = getpid();
+#endif
+  return std::filesystem::temp_directory_path() /
+         ("structopt_bench_" + std::to_string(pid) + "_" + std::to_string(counter++) +
+          ".rsp");
+}
+
+// An 8 MB list of paths, written at startup and removed at exit
+struct response_file {
+  std::filesystem::path path;
+  std::size_t size{0};
+
+  response_file() : path(unique_temp_path()) {
+    std::string contents;
+    for (int i = 0; contents.size() < (8 << 20); i++) {
+      contents += "/var/lib/indexer/shard_" + std::to_string(i % 64) + "/document_" +
+                  std::to_string(i) + ".json\n";
+    }
+    std::ofstream(path, std::ios::binary) << contents;
+    size = contents.size();
+  }
+
+  ~response_file() {
+    std::error_code error;
+    std::filesystem::remove(path, error);
+  }
+};
+
+const response_file &list() {
+  static const response_file file;
+  return file;
+}
+
+std::function<void()> expand(std::size_t num_threads) {
+  return [num_threads, argument = "@" + list().path.string()]() {
+    auto result = structopt::app("bench")
+                      .expand_response_files()
+                      .threads(num_threads)
+                      .try_parse<FileListOptions>(
+                          std::vector<std::string>{"./bench", argument});
+    if (!result.has_value() || result->files.empty()) {
+      std::cerr << "structopt_bench: cannot expand " << argument << "\n";
+      std::abort();
+    }
+    structopt_bench::do_not_optimize(result);
+  };
+}
+
+} // namespace
+
+// response_file/N: on N threads, whatever the number of cores, so that the allocations
+// do not depend on the machine; N > 1 print their time relative to response_file/1
+static const registrar response_file_1("response_file/1", expand(1), "", 0, list().size);
+static const registrar response_file_2("response_file/2", expand(2), "response_file/1", 0,
+                                       list().size);
+static const registrar response_file_4("response_file/4", expand(4), "response_file/1", 0,
+                                       list().size);
+static const registrar response_file_8("response_file/8", expand(8), "response_file/1", 0,
+                                       list().size);
@@ -0,0 +1,299 @@
+// structopt_compile_bench [--filter text] [--repeat count] [--keep]
+//
+// The cost of including structopt and parsing a struct, in compile time: generates
+// translation units with N fields of mixed types, and wide structs of up to 1024
+// fields, compiles each with the compiler that built this program, and prints the
+// wall time, the peak memory and the size of the object file. GCC's -ftime-report
+// phases, or Clang's -ftime-trace totals, break the time down into parsing, template
+// instantiation and code generation.
+//
+// The best of `count` compilations is printed. With --keep, the sources, objects and
+// reports are left in the temporary directory
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// A generated translation unit
+struct compile_case {
+  std::string name;
+  std::string source;
+};
+
+// Field types in the order they are cycled through; `E` is replaced by a distinct
+// enum per field, since magic_enum reflects every enum separately
+const char *const field_types[] = {
+    "std::optional<int>",
+    "std::optional<double>",
+    "std::optional<std::string>",
+    "std::optional<bool>",
+    "std::optional<E>",
+    "std::optional<std::vector<int>>",
+    "std::optional<std::pair<std::string, int>>",
+    "std::optional<std::array<int, 3>>",
+};
+
+// `fields` optional fields of mixed types, a positional field, and a parse
+// With `ranged`, every enum narrows its magic_enum range with STRUCTOPT_ENUM_RANGE
+std::string mixed_struct(std::size_t fields, bool ranged) {
+  std::ostringstream source;
+  source << "#include <structopt/app.hpp>\n\n";
+  std::ostringstream members;
+  std::ostringstream names;
+  std::ostringstream ranges;
+  names << "input";
+  for (std::size_t i = 0; i < fields; i++) {
+    std::string type = field_types[i % std::size(field_types)];
+    const auto enum_name = "Enum" + std::to_string(i);
+    if (const auto e = type.find('E'); e != std::string::npos) {
+      source << "enum class " << enum_name << " { red, green, blue, yellow };\n";
+      type.replace(e, 1, enum_name);
+      if (ranged) {
+        ranges << "STRUCTOPT_ENUM_RANGE(" << enum_name << ", 0, 3);\n";
+      }
+    }
+    members << "  " << type << " f" << i << ";\n";
+    names << ", f" << i;
+  }
+  source << "\nstruct Options {\n  std::string input;\n"
+         << members.str() << "};\nSTRUCTOPT(Options, " << names.str() << ");\n"
+         << ranges.str() << "\n"
+         << "int main(int argc, char *argv[]) {\n"
+         << "  auto options = structopt::app(\"bench\").parse<Options>(argc, argv);\n"
+         << "  return static_cast<int>(options.input.size());\n}\n";
+  return source.str();
+}
+
+// `fields` std::optional<int> fields and a parse: the cost of registering the fields
+// with STRUCTOPT, and of looking them up, rather than of converting their types
+std::string wide_struct(std::size_t fields) {
+  std::ostringstream source;
+  source << "#include <structopt/app.hpp>\n\nstruct Options {\n";
+  std::ostringstream names;
+  for (std::size_t i = 0; i < fields; i++) {
+    source << "  std::optional<int> f" << i << ";\n";
+    names << (i == 0 ? "" : ", ") << "f" << i;
+  }
+  source << "};\nSTRUCTOPT(Options, " << names.str() << ");\n\n"
+         << "int main(int argc, char *argv[]) {\n"
+         << "  auto options = structopt::app(\"bench\").parse<Options>(argc, argv);\n"
+         << "  return options.f0.value_or(0);\n}\n";
+  return source.str();
+}
+
+std::vector<compile_case> compile_cases() {
+  std::vector<compile_case> cases;
+  cases.push_back({"include", "#include <structopt/app.hpp>\n\nint main() {}\n"});
+  for (std::size_t fields : {0, 8, 32, 64}) {
+    cases.push_back({"fields/" + std::to_string(fields), mixed_struct(fields, false)});
+  }
+  cases.push_back({"fields/64/ranged", mixed_struct(64, true)});
+  for (std::size_t fields : {64, 256, 1024}) {
+    cases.push_back({"wide/" + std::to_string(fields), wide_struct(fields)});
+  }
+  return cases;
+}
+
+struct measurement {
+  double seconds{0};
+  long peak_kb{0};
+  std::uintmax_t object_bytes{0};
+  std::string phases;
+};
+
+// Runs `command` and waits for it, with its peak memory in `peak_kb`
+bool run(const std::vector<std::string> &command, const fs::path &output, long &peak_kb) {
+  const pid_t child = fork();
+  if (child == 0) {
+    if (std::freopen(output.c_str(), "w", stderr) == nullptr) {
+      _exit(127);
+    }
+    std::vector<char *> argv;
+    for (const auto &argument : command) {
+      argv.push_back(const_cast<char *>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+    execvp(argv[0], argv.data());
+    _exit(127);
+  }
+  int status = 0;
+  rusage usage{};
+  if (child < 0 || wait4(child, &status, 0, &usage) != child) {
+    return false;
+  }
+#ifdef __APPLE__
+  peak_kb = usage.ru_maxrss / 1024;
+#else
+  peak_kb = usage.ru_maxrss;
+#endif
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+std::string read_file(const fs::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+// ` phase parsing  :   1.72 ( 22%)   0.83 ( 54%)   2.62 ( 27%)   122M ( 46%)` => the
+// wall time, i.e., the third number, of the phases that matter
+std::string gcc_phases(const std::string &report) {
+  const std::pair<const char *, const char *> phases[] = {
+      {" phase parsing ", "parse"},
+      {" phase lang. deferred ", "deferred"},
+      {" template instantiation ", "instantiate"},
+      {" phase opt and generate ", "codegen"},
+  };
+  std::string result;
+  std::istringstream lines(report);
+  for (std::string line; std::getline(lines, line);) {
+    for (const auto &[prefix, name] : phases) {
+      if (line.compare(0, std::strlen(prefix), prefix) != 0) {
+        continue;
+      }
+      // `usr (share) sys (share) wall (share)`
+      auto wall_end = line.find('(');
+      wall_end = line.find('(', wall_end + 1);
+      wall_end = line.find('(', wall_end + 1);
+      const auto wall_begin = line.rfind(')', wall_end);
+      if (wall_end == std::string::npos || wall_begin == std::string::npos) {
+        continue;
+      }
+      std::istringstream wall(line.substr(wall_begin + 1, wall_end - wall_begin - 1));
+      std::string seconds;
+      wall >> seconds;
+      result += std::string(name) + "=" + seconds + "s ";
+    }
+  }
+  return result;
+}
+
+// `{"name":"Total InstantiateFunction", ..., "dur":123456}` => the totals that matter
+std::string clang_phases(const std::string &trace) {
+  const std::pair<const char *, const char *> phases[] = {
+      {"Total Source", "parse"},
+      {"Total InstantiateClass", "instantiate-class"},
+      {"Total InstantiateFunction", "instantiate"},
+      {"Total Backend", "codegen"},
+  };
+  std::string result;
+  for (const auto &[total, name] : phases) {
+    const auto at = trace.find("\"name\":\"" + std::string(total) + "\"");
+    if (at == std::string::npos) {
+      continue;
+    }
+    const auto event_begin = trace.rfind('{', at);
+    const auto duration = trace.find("\"dur\":", event_begin);
+    if (duration == std::string::npos) {
+      continue;
+    }
+    const auto microseconds = std::strtod(trace.c_str() + duration + 6, nullptr);
+    char text[64];
+    std::snprintf(text, sizeof(text), "%s=%.2fs ", name, microseconds / 1e6);
+    result += text;
+  }
+  return result;
+}
+
+measurement compile(const compile_case &c, const fs::path &directory, int repeat) {
+  auto stem = c.name;
+  std::replace(stem.begin(), stem.end(), '/', '_');
+  const auto source = directory / (stem + ".cpp");
+  const auto object = directory / (stem + ".o");
+  const auto report = directory / (stem + ".txt");
+  std::ofstream(source) << c.source;
+
+  const std::string compiler = STRUCTOPT_BENCH_COMPILER;
+  const bool clang = compiler.find("clang") != std::string::npos;
+  const std::vector<std::string> command = {compiler,
+                                            "-std=c++17",
+                                            "-O2",
+                                            "-I" STRUCTOPT_BENCH_INCLUDE_DIR,
+                                            "-c",
+                                            source.string(),
+                                            "-o",
+                                            object.string(),
+                                            clang ? "-ftime-trace" : "-ftime-report"};
+
+  measurement best;
+  best.seconds = 1e9;
+  for (int i = 0; i < repeat; i++) {
+    long peak_kb = 0;
+    const auto start = std::chrono::steady_clock::now();
+    if (!run(command, report, peak_kb)) {
+      std::cerr << "structopt_compile_bench: failed to compile " << source << "\n"
+                << read_file(report);
+      std::exit(EXIT_FAILURE);
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < best.seconds) {
+      best.seconds = elapsed.count();
+      best.peak_kb = peak_kb;
+      best.object_bytes = fs::file_size(object);
+      best.phases = clang ? clang_phases(read_file(directory / (stem + ".json")))
+                          : gcc_phases(read_file(report));
+    }
+  }
+  return best;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  std::string filter;
+  int repeat = 1;
+  bool keep = false;
+  for (int i = 1; i < argc; i++) {
+    const std::string option = argv[i];
+    if (option == "--keep") {
+      keep = true;
+    } else if (i + 1 < argc && option == "--filter") {
+      filter = argv[++i];
+    } else if (i + 1 < argc && option == "--repeat") {
+      repeat = std::max(1, std::atoi(argv[++i]));
+    } else {
+      std::cerr << "structopt_compile_bench: unknown option " << option << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  const auto directory = fs::temp_directory_path() / "structopt_compile_bench";
+  fs::create_directories(directory);
+
+  std::printf("%-16s %9s %9s %10s  %s\n", "case", "seconds", "peak MB", "object KB",
+              "phases");
+  for (const auto &c : compile_cases()) {
+    if (c.name.find(filter) == std::string::npos) {
+      continue;
+    }
+    const auto result = compile(c, directory, repeat);
+    std::printf("%-16s %9.2f %9.1f %10.1f  %s\n", c.name.c_str(), result.seconds,
+                static_cast<double>(result.peak_kb) / 1024,
+                static_cast<double>(result.object_bytes) / 1024, result.phases.c_str());
+    std::fflush(stdout);
+  }
+
+  if (keep) {
+    std::printf("sources, objects and reports are in %s\n", directory.c_str());
+  } else {
+    fs::remove_all(directory);
+  }
+  return EXIT_SUCCESS;
+}
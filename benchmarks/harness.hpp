@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A minimal benchmark harness: no dependencies, so the suite builds offline
+namespace structopt_bench {
+
+// Calls to operator new since the program started, counted by main.cpp
+extern std::atomic<std::size_t> allocations;
+
+// One measured operation, e.g., parsing one argument list
+struct benchmark {
+  std::string name; // `axis/size`, e.g., `fields/64`
+  std::function<void()> run;
+  // Another benchmark doing the same work, e.g., with getopt_long; with --check, the
+  // run fails if this one takes more than `max_ratio` times as long
+  std::string reference;
+  double max_ratio{0};
+  std::size_t bytes{0}; // read per operation, if any; the run prints the throughput
+};
+
+inline std::vector<benchmark> &registry() {
+  static std::vector<benchmark> benchmarks;
+  return benchmarks;
+}
+
+// Registers a benchmark at static initialization
+struct registrar {
+  registrar(std::string name, std::function<void()> run, std::string reference = "",
+            double max_ratio = 0, std::size_t bytes = 0) {
+    registry().push_back(
+        {std::move(name), std::move(run), std::move(reference), max_ratio, bytes});
+  }
+};
+
+// Keeps the compiler from discarding a result
+template <typename T> void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+// An `argv` that lives as long as the benchmark, e.g., `{"./main", "--jobs", "4"}`
+class argument_list {
+  std::vector<std::string> arguments_;
+  std::vector<char *> argv_;
+
+public:
+  explicit argument_list(std::vector<std::string> arguments)
+      : arguments_(std::move(arguments)) {
+    for (auto &argument : arguments_) {
+      argv_.push_back(argument.data());
+    }
+    argv_.push_back(nullptr);
+  }
+
+  argument_list(const argument_list &other) : argument_list(other.arguments_) {}
+  argument_list &operator=(const argument_list &) = delete;
+
+  int argc() const { return static_cast<int>(arguments_.size()); }
+  char **argv() { return argv_.data(); }
+};
+
+} // namespace structopt_bench
@@ -0,0 +1,228 @@
+// structopt_bench [--filter text] [--min-time ms] [--check baselines]
+//                 [--time-tolerance factor] [--write-baselines baselines]
+//
+// Runs every registered benchmark whose name contains `text` and prints the median
+// time and the number of allocations per operation, and the throughput of the ones
+// that read a known number of bytes.
+//
+// With --check, an operation that allocates more than its baseline fails the run;
+// allocation counts do not depend on the machine, so this is what ctest checks. With
+// --time-tolerance too, an operation that takes more than `factor` times its
+// baseline time fails as well, which only makes sense on the machine the baselines
+// were written on. A benchmark with a reference, e.g., the same parse with
+// getopt_long, also prints how many times as long it takes; a ratio is a time too, so
+// it only fails --check above its maximum with --time-tolerance
+#include "harness.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace structopt_bench {
+std::atomic<std::size_t> allocations{0};
+} // namespace structopt_bench
+
+void *operator new(std::size_t size) {
+  structopt_bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *pointer = std::malloc(size != 0 ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
+
+namespace {
+
+using structopt_bench::benchmark;
+using clock_type = std::chrono::steady_clock;
+
+struct measurement {
+  double nanoseconds;
+  std::size_t allocations;
+};
+
+struct baseline {
+  std::size_t allocations;
+  double nanoseconds;
+};
+
+measurement measure(const benchmark &bench, double min_time_ms) {
+  // warm up, e.g., the schema of the struct, then count the allocations of one
+  // operation
+  bench.run();
+  const auto before = structopt_bench::allocations.load(std::memory_order_relaxed);
+  bench.run();
+  const auto allocated =
+      structopt_bench::allocations.load(std::memory_order_relaxed) - before;
+
+  // batches of at least 1/5 of the time, so the clock's resolution does not matter
+  constexpr int samples = 5;
+  const std::chrono::duration<double, std::milli> batch_time(min_time_ms / samples);
+  std::size_t iterations = 1;
+  for (;;) {
+    const auto start = clock_type::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+      bench.run();
+    }
+    if (clock_type::now() - start >= batch_time) {
+      break;
+    }
+    iterations *= 2;
+  }
+
+  std::vector<double> times;
+  for (int sample = 0; sample < samples; sample++) {
+    const auto start = clock_type::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+      bench.run();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = clock_type::now() - start;
+    times.push_back(elapsed.count() / static_cast<double>(iterations));
+  }
+  std::sort(times.begin(), times.end());
+  return {times[samples / 2], allocated};
+}
+
+std::map<std::string, baseline> read_baselines(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    std::cerr << "structopt_bench: cannot read " << path << "\n";
+    std::exit(EXIT_FAILURE);
+  }
+  std::map<std::string, baseline> result;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    std::string name;
+    baseline entry{};
+    if (fields >> name >> entry.allocations >> entry.nanoseconds) {
+      result[name] = entry;
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  std::string filter;
+  std::string check_path;
+  std::string write_path;
+  double min_time_ms = 100;
+  double time_tolerance = 0;
+  for (int i = 1; i < argc; i++) {
+    const std::string option = argv[i];
+    if (i + 1 == argc) {
+      std::cerr << "structopt_bench: missing value for " << option << "\n";
+      return EXIT_FAILURE;
+    }
+    const std::string value = argv[++i];
+    if (option == "--filter") {
+      filter = value;
+    } else if (option == "--check") {
+      check_path = value;
+    } else if (option == "--write-baselines") {
+      write_path = value;
+    } else if (option == "--min-time") {
+      min_time_ms = std::stod(value);
+    } else if (option == "--time-tolerance") {
+      time_tolerance = std::stod(value);
+    } else {
+      std::cerr << "structopt_bench: unknown option " << option << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  const auto baselines =
+      check_path.empty() ? std::map<std::string, baseline>{} : read_baselines(check_path);
+
+  auto benchmarks = structopt_bench::registry();
+  std::sort(benchmarks.begin(), benchmarks.end(),
+            [](const benchmark &a, const benchmark &b) { return a.name < b.name; });
+
+  // Measure first, so that a benchmark can be compared with its reference
+  std::map<std::string, measurement> results;
+  for (const auto &bench : benchmarks) {
+    if (bench.name.find(filter) != std::string::npos) {
+      results[bench.name] = measure(bench, min_time_ms);
+    }
+  }
+
+  std::printf("%-32s %14s %12s %s\n", "benchmark", "ns/op", "allocs/op",
+              check_path.empty() ? "" : "baseline");
+  std::ostringstream written;
+  written << "# benchmark allocations nanoseconds\n";
+  int regressions = 0;
+  for (const auto &bench : benchmarks) {
+    const auto measured = results.find(bench.name);
+    if (measured == results.end()) {
+      continue;
+    }
+    const auto &result = measured->second;
+    written << bench.name << " " << result.allocations << " "
+            << static_cast<long long>(result.nanoseconds) << "\n";
+
+    std::string verdict;
+    const auto entry = baselines.find(bench.name);
+    if (entry != baselines.end()) {
+      const auto &expected = entry->second;
+      verdict = std::to_string(expected.allocations) + " allocs, " +
+                std::to_string(static_cast<long long>(expected.nanoseconds)) + " ns";
+      if (result.allocations > expected.allocations) {
+        verdict += "  REGRESSION: allocations";
+        regressions += 1;
+      } else if (time_tolerance > 0 &&
+                 result.nanoseconds > expected.nanoseconds * time_tolerance) {
+        verdict += "  REGRESSION: time";
+        regressions += 1;
+      }
+    } else if (!check_path.empty()) {
+      verdict = "no baseline";
+    }
+
+    if (bench.bytes != 0) {
+      char text[32];
+      std::snprintf(text, sizeof(text), "  %.2f GB/s",
+                    static_cast<double>(bench.bytes) / result.nanoseconds);
+      verdict += text;
+    }
+
+    const auto reference = results.find(bench.reference);
+    if (reference != results.end()) {
+      const auto ratio = result.nanoseconds / reference->second.nanoseconds;
+      char text[64];
+      std::snprintf(text, sizeof(text), "  %.2fx %s", ratio, bench.reference.c_str());
+      verdict += text;
+      if (!check_path.empty() && time_tolerance > 0 && bench.max_ratio > 0 &&
+          ratio > bench.max_ratio) {
+        std::snprintf(text, sizeof(text), "  REGRESSION: over %.1fx", bench.max_ratio);
+        verdict += text;
+        regressions += 1;
+      }
+    }
+    std::printf("%-32s %14.1f %12zu %s\n", bench.name.c_str(), result.nanoseconds,
+                result.allocations, verdict.c_str());
+  }
+
+  if (!write_path.empty()) {
+    std::ofstream(write_path) << written.str();
+  }
+  if (regressions != 0) {
+    std::printf("%d regression(s)\n", regressions);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
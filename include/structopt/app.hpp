@@ -1,96 +1,370 @@
 
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
+#include <structopt/environment.hpp>
+#include <structopt/exception.hpp>
 #include <structopt/is_stl_container.hpp>
+#include <structopt/observer.hpp>
+#include <structopt/parallel_for.hpp>
+#include <structopt/parse_result.hpp>
 #include <structopt/parser.hpp>
+#include <structopt/record_reader.hpp>
+#include <structopt/response_file.hpp>
+#include <structopt/settings.hpp>
+#include <structopt/source.hpp>
 #include <structopt/third_party/visit_struct/visit_struct.hpp>
 #include <type_traits>
 #include <vector>
 
 #define STRUCTOPT VISITABLE_STRUCT
 
+// The values of enum `E` are in [MIN, MAX]: magic_enum reflects the names of every
+// value in [-128, 127] otherwise, which dominates the compile time of small enums
+// Use at global scope, e.g., STRUCTOPT_ENUM_RANGE(Options::Color, 0, 2)
+#define STRUCTOPT_ENUM_RANGE(E, MIN, MAX)                                               \
+  template <> struct magic_enum::customize::enum_range<E> {                             \
+    static constexpr int min = MIN;                                                     \
+    static constexpr int max = MAX;                                                     \
+  }
+
 namespace structopt {
 
+// Parsing does not modify the app: one app can parse on several threads at once
 class app {
-  details::visitor visitor;
+  std::shared_ptr<const details::program_info> program_; // name, version and help
+  bool expand_response_files_{false};
+  std::size_t num_threads_{1};
+  int record_fd_{-1}; // read container values from this file descriptor, if not -1
+  char record_delimiter_{'\n'};
+  details::environment_options environment_; // fallbacks of optional fields
+  // values under the arguments, in increasing precedence
+  std::vector<std::shared_ptr<const source>> sources_;
+  std::shared_ptr<observer> observer_; // told about every step of a parse, if set
+  // schema of the last parsed struct, only used by help(); published with release and
+  // read with acquire, since help() may run on a thread that never built the schema
+  mutable std::atomic<const details::visitor *> schema_{nullptr};
 
 public:
   explicit app(std::string name, std::string version = "", std::string help = "")
-      : visitor(std::move(name), std::move(version), std::move(help)) {}
+      : program_(std::make_shared<const details::program_info>(details::program_info{
+            std::move(name), std::move(version), std::move(help)})) {}
 
-  template <typename T> T parse(const std::vector<std::string> &arguments) {
-    T argument_struct = T();
+  app(const app &other)
+      : program_(other.program_), expand_response_files_(other.expand_response_files_),
+        num_threads_(other.num_threads_), record_fd_(other.record_fd_),
+        record_delimiter_(other.record_delimiter_), environment_(other.environment_),
+        sources_(other.sources_), observer_(other.observer_),
+        schema_(other.schema_.load(std::memory_order_acquire)) {}
 
-    // Visit the struct and save flag, optional and positional field names
-    visit_struct::for_each(argument_struct, visitor);
+  app &operator=(const app &other) {
+    program_ = other.program_;
+    expand_response_files_ = other.expand_response_files_;
+    num_threads_ = other.num_threads_;
+    record_fd_ = other.record_fd_;
+    record_delimiter_ = other.record_delimiter_;
+    environment_ = other.environment_;
+    sources_ = other.sources_;
+    observer_ = other.observer_;
+    schema_.store(other.schema_.load(std::memory_order_acquire),
+                  std::memory_order_release);
+    return *this;
+  }
 
-    // add `help` and `version` optional arguments
-    visitor.optional_field_names.push_back("help");
-    visitor.optional_field_names.push_back("version");
+  // Replace `@path` arguments with the arguments in the file `path`, e.g., when the
+  // argument list is too long for the OS
+  //
+  // Response files follow GCC's rules: arguments are separated by whitespace, quotes
+  // group and a backslash escapes. Response files are mapped into memory, not read,
+  // and unmapped when the parse finishes. `@path` stays as is if `path` cannot be read
+  app &expand_response_files(bool enable = true) {
+    expand_response_files_ = enable;
+    return *this;
+  }
 
-    // Construct the argument parser
-    structopt::details::parser parser;
-    parser.visitor = visitor;
-    parser.arguments = arguments;
+  // Threads for very large argument lists, 1 by default and 0 for one per core
+  //
+  // Response files of several MB are split, and std::vector<std::string> fields of
+  // many thousands of values are filled, on that many threads
+  app &threads(std::size_t num_threads) {
+    num_threads_ = num_threads;
+    return *this;
+  }
 
-    for (std::size_t i = 1; i < parser.arguments.size(); i++) {
-      parser.current_index = i;
-      visit_struct::for_each(argument_struct, parser);
-    }
+  // Read the values of a container field from the file descriptor `fd` where its
+  // values include `-`, like xargs, e.g., `find . -print0 | indexer -`
+  //
+  // Every record, up to `delimiter` ('\n' or '\0'), is one value, converted like an
+  // argument. The input is read in large blocks as the values are parsed; with a
+  // structopt::stream field, memory use does not grow with the size of the input.
+  // Only containers of single-token values read records, and only the first `-`
+  // reads any: it reads the input to the end. `fd = -1` disables reading
+  app &read_values_from(int fd = 0, char delimiter = '\n') {
+    record_fd_ = fd;
+    record_delimiter_ = delimiter;
+    return *this;
+  }
+
+  // Optional fields that are not given in the arguments take their value from the
+  // environment variable `prefix` + the upper-case field name, if it is set, e.g.,
+  // `--log-level` from `INDEXER_LOG_LEVEL` with the prefix `INDEXER_`
+  //
+  // Values are parsed like the value of the option. The environment is scanned once
+  // per parse, after the arguments, and only for the fields that were not given
+  app &env_prefix(std::string prefix) {
+    environment_.prefix = std::move(prefix);
+    return *this;
+  }
+
+  // The optional field `field` falls back to the environment variable `variable`,
+  // instead of the one named after the prefix, if any
+  app &env(std::string field, std::string variable) {
+    environment_.variables.emplace_back(std::move(field), std::move(variable));
+    return *this;
+  }
+
+  // Fill the struct from the config file `path` before parsing the arguments, which
+  // override it. The environment, see env_prefix, overrides it too
+  //
+  // The file is INI, a TOML subset (`[table]` headers, `key = value` lines, quoted
+  // strings, `[a, b]` arrays) or JSON. Keys name optional fields, with the same
+  // kebab-case rules as options, and tables name nested structs. The file is mapped
+  // into memory; values are parsed straight from the mapping into their fields
+  app &config_file(std::string path) {
+    return add_source(std::make_shared<file_source>(std::move(path)));
+  }
+
+  // Fill the struct from `settings`, e.g., a structopt::map_source of query
+  // parameters or a structopt::env_source, before parsing the arguments
+  //
+  // Sources are applied in the order they are added, each over the previous ones, and
+  // the arguments over all of them. Every source is read once per parse, and its
+  // values are parsed straight into their fields
+  app &add_source(std::shared_ptr<const source> settings) {
+    sources_.push_back(std::move(settings));
+    return *this;
+  }
+
+  // Tell `events` about every step of every parse: tokens classified, fields matched,
+  // values converted, sub-commands entered and errors, with the time of each, e.g.,
+  // a structopt::trace_observer from <structopt/trace_observer.hpp>. `nullptr` removes
+  // the observer
+  //
+  // Parses without an observer do not read the clock. With parse_batch, the observer
+  // is called from several threads at once
+  app &observe(std::shared_ptr<observer> events) {
+    observer_ = std::move(events);
+    return *this;
+  }
+
+  template <typename T> T parse(const std::vector<std::string> &arguments) const {
+    return parse_tokens<T>(details::tokens(arguments.begin(), arguments.end()));
+  }
+
+  // Parse `settings` over the sources of the app, without arguments, e.g., the
+  // query parameters of a request
+  template <typename T> T parse(const source &settings) const {
+    return parse_tokens<T>(details::tokens{program_->name}, &settings);
+  }
+
+  // Parse `argv` in place - the arguments are viewed, not copied
+  template <typename T> T parse(int argc, char *argv[]) const {
+    return parse_tokens<T>(details::tokens(argv, argv + argc));
+  }
+
+  // Like parse, but errors are returned instead of thrown, and `--help` and
+  // `--version` are returned as errors instead of printing and exiting
+  template <typename T>
+  parse_result<T> try_parse(const std::vector<std::string> &arguments) const {
+    return try_parse_tokens<T>(details::tokens(arguments.begin(), arguments.end()));
+  }
+
+  template <typename T> parse_result<T> try_parse(int argc, char *argv[]) const {
+    return try_parse_tokens<T>(details::tokens(argv, argv + argc));
+  }
+
+  template <typename T> parse_result<T> try_parse(const source &settings) const {
+    return try_parse_tokens<T>(details::tokens{program_->name}, &settings);
+  }
+
+  // try_parse every argument list, spread over `num_threads` threads
+  //
+  // The results are in the order of `argument_lists`; an error in one entry does
+  // not affect the others. `num_threads = 0` uses one thread per core
+  template <typename T>
+  std::vector<parse_result<T>>
+  parse_batch(const std::vector<std::vector<std::string>> &argument_lists,
+              std::size_t num_threads = 0) const {
+    // Entries are handed out in blocks to keep the shared counter cold
+    constexpr std::size_t block_size = 64;
+    const std::size_t num_blocks = (argument_lists.size() + block_size - 1) / block_size;
+
+    std::vector<std::vector<parse_result<T>>> blocks(num_blocks);
+    details::parallel_for(num_blocks, num_threads, [&](std::size_t block) {
+      const auto first = block * block_size;
+      const auto last = std::min(first + block_size, argument_lists.size());
+      blocks[block].reserve(last - first);
+      for (auto i = first; i < last; i++) {
+        blocks[block].push_back(try_parse<T>(argument_lists[i]));
+      }
+    });
 
-    // directly call the parser to check for `help` and `version` flags
-    std::optional<bool> help = false, version = false;
-    for (std::size_t i = 1; i < parser.arguments.size(); i++) {
-      parser.operator()("help", help);
-      parser.operator()("version", version);
+    std::vector<parse_result<T>> result;
+    result.reserve(argument_lists.size());
+    for (auto &block : blocks) {
+      std::move(block.begin(), block.end(), std::back_inserter(result));
+    }
+    return result;
+  }
 
-      if (help == true) {
+private:
+  template <typename T>
+  T parse_tokens(details::tokens arguments, const source *last = nullptr) const {
+    T argument_struct = T();
+    auto failure = parse_into(argument_struct, std::move(arguments), last);
+    if (failure.has_value()) {
+      switch (failure->kind()) {
+      case error_kind::help_requested:
         // if help is requested, print help and exit
-        visitor.print_help(std::cout);
+        std::cout << failure->help();
         exit(EXIT_SUCCESS);
-      } else if (version == true) {
+      case error_kind::version_requested:
         // if version is requested, print version and exit
-        std::cout << visitor.version << "\n";
+        std::cout << failure->version_ << "\n";
         exit(EXIT_SUCCESS);
+      default:
+        throw structopt::exception(failure->message(), *failure->schema_, failure->name_,
+                                   failure->help_, failure->program_);
       }
     }
+    return argument_struct;
+  }
+
+  template <typename T>
+  parse_result<T> try_parse_tokens(details::tokens arguments,
+                                   const source *last = nullptr) const {
+    T argument_struct = T();
+    auto failure = parse_into(argument_struct, std::move(arguments), last);
+    if (failure.has_value()) {
+      return std::move(failure.value());
+    }
+    return argument_struct;
+  }
+
+  // Returns the first error, if any
+  template <typename T>
+  std::optional<parse_error> parse_into(T &argument_struct, details::tokens arguments,
+                                        const source *last) const {
+    // Flag, optional and positional field names are collected once per type
+    schema_.store(&details::schema<T>(), std::memory_order_release);
+
+    // Construct the argument parser
+    structopt::details::parser parser;
+    parser.name = program_->name;
+    parser.version = program_->version;
+    parser.help = program_->help;
+    parser.visitor = &details::schema<T>();
+    parser.num_threads = num_threads_;
+    parser.events = observer_.get();
+
+    // Arguments from response files view the mappings, which live until we return
+    details::response_files response_files(num_threads_);
+
+    parser.notify(parse_event_kind::parse_started);
+    parse_into(parser, argument_struct, arguments, response_files, last);
+    parser.notify(parse_event_kind::parse_finished);
+    if (parser.failed()) {
+      parser.failure->program_ = program_; // keeps the views of the error valid
+    }
+    return std::move(parser.failure);
+  }
 
-    // if all positional arguments were provided
-    // this list would be empty
-    if (!parser.visitor.positional_field_names.empty()) {
-      for (auto &field_name : parser.visitor.positional_field_names) {
-        if (std::find(parser.visitor.vector_like_positional_field_names.begin(),
-                      parser.visitor.vector_like_positional_field_names.end(),
-                      field_name) ==
-            parser.visitor.vector_like_positional_field_names.end()) {
-          // this positional argument is not a vector-like argument
-          // it expects value(s)
-          throw structopt::exception("Error: expected value for positional argument `" +
-                                         std::string(field_name) + "`.",
-                                     parser.visitor);
-        }
+  // Stops at the first error, in `parser.failure`
+  template <typename T>
+  void parse_into(details::parser &parser, T &argument_struct, details::tokens &arguments,
+                  details::response_files &response_files, const source *last) const {
+    if (expand_response_files_) {
+      if (const auto cycle = response_files.expand(arguments)) {
+        auto &error = parser.fail(details::error_detail::response_file_cycle);
+        error.token_index_ = cycle->token_index;
+        error.token_ = cycle->token;
+        return;
       }
     }
 
-    if (parser.current_index < parser.arguments.size()) {
-      throw structopt::exception("Error: unrecognized argument '" + parser.arguments[parser.current_index] + "'", parser.visitor);
+    // Values of a source are parsed into their fields before the next source is read
+    const auto apply = [&](const source &settings) {
+      details::settings values;
+      if (!settings.read(values)) {
+        auto &error = parser.fail(details::error_detail::config_syntax_error);
+        error.reason_ = values.error;
+        parser.locate_config_failure(values, values.line);
+        return false;
+      }
+      values.group_by_table();
+      parser.parse_config_table(argument_struct, values, 0);
+      // e.g., `--` among the values of an array
+      parser.double_dash_encountered = false;
+      return !parser.failed();
+    };
+    for (const auto &settings : sources_) {
+      if (!apply(*settings)) {
+        return;
+      }
+    }
+    if (last != nullptr && !apply(*last)) {
+      return;
     }
 
-    return argument_struct;
-  }
+    // Records of the input are views into the reader's buffer
+    std::optional<details::record_reader> records;
+    if (record_fd_ != -1) {
+      parser.records = &records.emplace(record_fd_, record_delimiter_);
+    }
+
+    // Optional fields given in the arguments do not read the environment
+    details::field_set given_options;
+    if (environment_.enabled()) {
+      parser.given_options = &given_options;
+    }
+
+    // skip the program name
+    parser.arguments = details::token_cursor(arguments, 1);
 
-  template <typename T> T parse(int argc, char *argv[]) {
-    std::vector<std::string> arguments;
-    std::copy(argv, argv + argc, std::back_inserter(arguments));
-    return parse<T>(arguments);
+    // Route every argument to its field in a single pass
+    parser.parse_struct(argument_struct);
+
+    if (!parser.failed() && !parser.arguments.empty()) {
+      if (parser.is_optional(parser.arguments.peek())) {
+        parser.fail(details::error_detail::unrecognized_argument);
+      } else {
+        parser.fail(details::error_detail::unexpected_argument);
+      }
+    }
+
+    if (!parser.failed() && environment_.enabled()) {
+      parser.parse_environment(argument_struct, environment_,
+                               details::process_environment());
+    }
+
+    if (!parser.failed()) {
+      parser.check_positional_fields();
+    }
   }
 
+public:
   std::string help() const {
+    static const details::visitor empty;
     std::stringstream os;
-    visitor.print_help(os);
+    const auto schema = schema_.load(std::memory_order_acquire);
+    (schema ? *schema : empty).print_help(os, program_->name, program_->help);
     return os.str();
   }
 };
@@ -0,0 +1,438 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <structopt/response_file.hpp>
+#include <structopt/settings.hpp>
+#include <structopt/token_kind.hpp>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// Reads a config file into settings
+//
+// Two formats are read: INI and the subset of TOML that looks like it, i.e.,
+// `[table.subtable]` headers, `key = value` lines, `#` and `;` comments, quoted
+// strings and `[a, b]` arrays; and JSON, if the file starts with `{`. Objects are
+// tables, `null` values are skipped
+//
+// The file is mapped into memory, and keys and values are views into the mapping.
+// Quotes and escapes are removed in place, in the copy-on-write mapping, so nothing
+// is copied; the mapping is kept in the settings
+class config_file_reader {
+  settings &result_;
+  char *in_{nullptr};
+  char *end_{nullptr};
+  std::size_t line_{1};
+
+public:
+  explicit config_file_reader(settings &result) : result_(result) {}
+
+  // False if `path` cannot be read or on a syntax error, see `settings::error`
+  bool read(const std::string &path) {
+    result_.origin = "config file `" + path + "`";
+    mapped_file file(path);
+    if (!file.is_open()) {
+      return result_.fail("cannot be read");
+    }
+    in_ = file.data();
+    end_ = in_ + file.size();
+    result_.files.push_back(std::move(file));
+
+    // one entry per line at most
+    result_.entries.reserve(static_cast<std::size_t>(std::count(in_, end_, '\n')) + 1);
+    skip_space();
+    return in_ != end_ && *in_ == '{' ? parse_json() : parse_ini();
+  }
+
+private:
+  bool fail(const char *reason) { return result_.fail(reason, line_); }
+
+  std::size_t find_table(std::size_t parent, std::string_view name) {
+    return result_.find_table(parent, name);
+  }
+
+  void add_entry(std::size_t table, std::string_view key, std::size_t first_value,
+                 std::size_t line) {
+    result_.entries.push_back({table, key, first_value, result_.values.size(), line});
+  }
+
+  // Spaces, tabs and, if `newlines`, line breaks
+  void skip_space(bool newlines = true) {
+    for (; in_ != end_; ++in_) {
+      const char c = *in_;
+      if (c == '\n' && newlines) {
+        line_ += 1;
+      } else if (c != ' ' && c != '\t' && c != '\r') {
+        return;
+      }
+    }
+  }
+
+  void skip_line() {
+    while (in_ != end_ && *in_ != '\n') {
+      ++in_;
+    }
+  }
+
+  // Spaces, tabs, comments and line breaks, e.g., between the values of an array
+  void skip_space_and_comments() {
+    skip_space();
+    while (in_ != end_ && (*in_ == '#' || *in_ == ';')) {
+      skip_line();
+      skip_space();
+    }
+  }
+
+  bool at_end_of_line() {
+    skip_space(false);
+    if (in_ != end_ && (*in_ == '#' || *in_ == ';')) {
+      skip_line();
+    }
+    return in_ == end_ || *in_ == '\n';
+  }
+
+  static void append_utf8(char *&out, std::uint32_t code_point) {
+    if (code_point < 0x80) {
+      *out++ = static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+      *out++ = static_cast<char>(0xC0 | (code_point >> 6));
+      *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+      *out++ = static_cast<char>(0xE0 | (code_point >> 12));
+      *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+      *out++ = static_cast<char>(0xF0 | (code_point >> 18));
+      *out++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+      *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+  }
+
+  bool read_hex(std::size_t digits, std::uint32_t &result) {
+    result = 0;
+    for (std::size_t i = 0; i < digits; i++, ++in_) {
+      if (in_ == end_ || !is_hex_digit(*in_)) {
+        return false;
+      }
+      const char c = *in_;
+      result = result * 16 + static_cast<std::uint32_t>(
+                                 c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+    }
+    return true;
+  }
+
+  // A double-quoted string, unescaped in place; `in_` is at the opening quote
+  // Escapes are those of JSON, which TOML shares
+  bool read_quoted_string(std::string_view &result) {
+    char *const begin = ++in_;
+    char *out = begin;
+    while (true) {
+      if (in_ == end_ || *in_ == '\n') {
+        return fail("unterminated string");
+      }
+      const char c = *in_++;
+      if (c == '"') {
+        break;
+      } else if (c != '\\') {
+        *out++ = c;
+        continue;
+      }
+      if (in_ == end_) {
+        return fail("unterminated string");
+      }
+      switch (*in_++) {
+      case '"':
+        *out++ = '"';
+        break;
+      case '\\':
+        *out++ = '\\';
+        break;
+      case '/':
+        *out++ = '/';
+        break;
+      case 'b':
+        *out++ = '\b';
+        break;
+      case 'f':
+        *out++ = '\f';
+        break;
+      case 'n':
+        *out++ = '\n';
+        break;
+      case 'r':
+        *out++ = '\r';
+        break;
+      case 't':
+        *out++ = '\t';
+        break;
+      case 'u': {
+        std::uint32_t code_point;
+        if (!read_hex(4, code_point)) {
+          return fail("invalid escape sequence");
+        }
+        if (code_point >= 0xD800 && code_point < 0xDC00 && end_ - in_ >= 6 &&
+            in_[0] == '\\' && in_[1] == 'u') {
+          // a UTF-16 surrogate pair, as JSON writes characters outside the BMP
+          in_ += 2;
+          std::uint32_t low;
+          if (!read_hex(4, low) || low < 0xDC00 || low >= 0xE000) {
+            return fail("invalid escape sequence");
+          }
+          code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+        }
+        // never longer than the escape sequence
+        append_utf8(out, code_point);
+        break;
+      }
+      default:
+        return fail("invalid escape sequence");
+      }
+    }
+    result = {begin, static_cast<std::size_t>(out - begin)};
+    return true;
+  }
+
+  // A single-quoted string, as is; `in_` is at the opening quote
+  bool read_literal_string(std::string_view &result) {
+    char *const begin = ++in_;
+    while (in_ != end_ && *in_ != '\'' && *in_ != '\n') {
+      ++in_;
+    }
+    if (in_ == end_ || *in_ != '\'') {
+      return fail("unterminated string");
+    }
+    result = {begin, static_cast<std::size_t>(in_++ - begin)};
+    return true;
+  }
+
+  // An unquoted value, e.g., `42`, `true` or, in INI, `hello world`
+  // Ends at the end of the line, a comment or any of `delimiters`
+  std::string_view read_bare_value(std::string_view delimiters) {
+    char *const begin = in_;
+    char *last = in_; // after the last character that is not a space
+    for (; in_ != end_ && *in_ != '\n'; ++in_) {
+      const char c = *in_;
+      const bool is_comment =
+          (c == '#' || c == ';') && (in_ == begin || in_[-1] == ' ' || in_[-1] == '\t');
+      if (is_comment || delimiters.find(c) != std::string_view::npos) {
+        break;
+      }
+      if (c != ' ' && c != '\t' && c != '\r') {
+        last = in_ + 1;
+      }
+    }
+    return {begin, static_cast<std::size_t>(last - begin)};
+  }
+
+  bool read_ini_value(std::string_view delimiters) {
+    std::string_view value;
+    if (in_ != end_ && *in_ == '"') {
+      if (!read_quoted_string(value)) {
+        return false;
+      }
+    } else if (in_ != end_ && *in_ == '\'') {
+      if (!read_literal_string(value)) {
+        return false;
+      }
+    } else {
+      value = read_bare_value(delimiters);
+    }
+    result_.values.push_back(value);
+    return true;
+  }
+
+  // `name` or `a.b.c`, e.g., a key or a table header, up to `terminator`
+  // Every part but the last is a table, looked up or added under `table`
+  bool read_dotted_name(std::size_t &table, std::string_view &name, char terminator) {
+    while (true) {
+      skip_space(false);
+      char *const begin = in_;
+      while (in_ != end_ && *in_ != '.' && *in_ != terminator && *in_ != '\n' &&
+             *in_ != ' ' && *in_ != '\t') {
+        ++in_;
+      }
+      name = {begin, static_cast<std::size_t>(in_ - begin)};
+      skip_space(false);
+      if (name.empty()) {
+        return fail("expected a name");
+      }
+      if (in_ == end_ || *in_ != '.') {
+        break;
+      }
+      ++in_;
+      table = find_table(table, name);
+    }
+    if (in_ == end_ || *in_ != terminator) {
+      return fail(terminator == '=' ? "expected `=` after the key" : "expected `]`");
+    }
+    ++in_;
+    return true;
+  }
+
+  bool parse_ini() {
+    std::size_t table = 0;
+    while (true) {
+      skip_space_and_comments();
+      if (in_ == end_) {
+        return true;
+      }
+      if (*in_ == '[') {
+        // [table] or [table.subtable]
+        ++in_;
+        if (in_ != end_ && *in_ == '[') {
+          return fail("arrays of tables are not supported");
+        }
+        table = 0;
+        std::string_view name;
+        if (!read_dotted_name(table, name, ']')) {
+          return false;
+        }
+        table = find_table(table, name);
+      } else {
+        const auto entry_line = line_;
+        auto entry_table = table;
+        std::string_view key;
+        if (!read_dotted_name(entry_table, key, '=')) {
+          return false;
+        }
+        skip_space(false);
+        const auto first_value = result_.values.size();
+        if (in_ != end_ && *in_ == '[') {
+          ++in_;
+          skip_space_and_comments();
+          while (in_ != end_ && *in_ != ']') {
+            if (!read_ini_value(",]")) {
+              return false;
+            }
+            skip_space_and_comments();
+            if (in_ != end_ && *in_ == ',') {
+              ++in_;
+              skip_space_and_comments();
+            } else if (in_ == end_ || *in_ != ']') {
+              return fail("expected `,` or `]` in array");
+            }
+          }
+          if (in_ == end_) {
+            return fail("unterminated array");
+          }
+          ++in_;
+        } else if (!read_ini_value({})) {
+          return false;
+        }
+        add_entry(entry_table, key, first_value, entry_line);
+      }
+      if (!at_end_of_line()) {
+        return fail("unexpected characters at the end of the line");
+      }
+    }
+  }
+
+  // A JSON string, number, `true` or `false`
+  bool read_json_value() {
+    if (in_ != end_ && *in_ == '"') {
+      std::string_view value;
+      if (!read_quoted_string(value)) {
+        return false;
+      }
+      result_.values.push_back(value);
+      return true;
+    }
+    const auto value = read_bare_value(",}] \t\r");
+    if (value.empty() || value == "null") {
+      return fail("expected a string, number or boolean");
+    }
+    result_.values.push_back(value);
+    return true;
+  }
+
+  // An object; `in_` is at the opening brace
+  bool parse_json_object(std::size_t table) {
+    ++in_;
+    skip_space();
+    if (in_ != end_ && *in_ == '}') {
+      ++in_;
+      return true;
+    }
+    while (true) {
+      skip_space();
+      if (in_ == end_ || *in_ != '"') {
+        return fail("expected a string key");
+      }
+      const auto entry_line = line_;
+      std::string_view key;
+      if (!read_quoted_string(key)) {
+        return false;
+      }
+      skip_space();
+      if (in_ == end_ || *in_ != ':') {
+        return fail("expected `:` after the key");
+      }
+      ++in_;
+      skip_space();
+
+      const auto first_value = result_.values.size();
+      if (in_ != end_ && *in_ == '{') {
+        if (!parse_json_object(find_table(table, key))) {
+          return false;
+        }
+      } else if (in_ != end_ && *in_ == '[') {
+        ++in_;
+        skip_space();
+        while (in_ != end_ && *in_ != ']') {
+          if (!read_json_value()) {
+            return false;
+          }
+          skip_space();
+          if (in_ != end_ && *in_ == ',') {
+            ++in_;
+            skip_space();
+          } else if (in_ == end_ || *in_ != ']') {
+            return fail("expected `,` or `]` in array");
+          }
+        }
+        if (in_ == end_) {
+          return fail("unterminated array");
+        }
+        ++in_;
+        add_entry(table, key, first_value, entry_line);
+      } else if (end_ - in_ >= 4 && std::string_view(in_, 4) == "null") {
+        // not set
+        in_ += 4;
+      } else {
+        if (!read_json_value()) {
+          return false;
+        }
+        add_entry(table, key, first_value, entry_line);
+      }
+
+      skip_space();
+      if (in_ != end_ && *in_ == ',') {
+        ++in_;
+      } else if (in_ != end_ && *in_ == '}') {
+        ++in_;
+        return true;
+      } else {
+        return fail("expected `,` or `}` in object");
+      }
+    }
+  }
+
+  bool parse_json() {
+    if (!parse_json_object(0)) {
+      return false;
+    }
+    skip_space();
+    return in_ == end_ || fail("unexpected characters after the object");
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
@@ -0,0 +1,180 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <structopt/field_table.hpp>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <stdlib.h>
+#elif defined(__APPLE__)
+#include <crt_externs.h>
+#else
+#include <unistd.h>
+extern "C" {
+extern char **environ;
+}
+#endif
+
+namespace structopt {
+
+namespace details {
+
+// The environment of the process, `NAME=value` entries ending with a null pointer
+inline char **process_environment() {
+#ifdef _WIN32
+  return _environ;
+#elif defined(__APPLE__)
+  return *_NSGetEnviron();
+#else
+  return environ;
+#endif
+}
+
+// Which environment variable, if any, supplies an optional field that is not given
+// in the arguments
+struct environment_options {
+  std::optional<std::string> prefix; // `PREFIX_` + the upper-case field name
+  std::vector<std::pair<std::string, std::string>> variables; // field => variable
+
+  bool enabled() const { return prefix.has_value() || !variables.empty(); }
+};
+
+// The variable of field `field_name` without the prefix: the upper-case name, with `-`
+// replaced by `_`, e.g., `LOG_LEVEL` for `log_level` and `RETRIES2` for `retries2`
+//
+// Used by both env_prefix and env_source, so that they map the same variable to the
+// same field
+inline std::string environment_name(std::string_view field_name) {
+  std::string result;
+  result.reserve(field_name.size());
+  for (const char c : field_name) {
+    result += c == '-' ? '_'
+                       : static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+  }
+  return result;
+}
+
+// The variable of every field of a struct without the prefix, e.g., `LOG_LEVEL` for
+// `log_level`, sorted; built once per type, whatever the prefix
+class environment_names {
+  std::vector<std::string> suffixes_;  // of each field
+  std::vector<std::size_t> by_suffix_; // indices into `suffixes_`, sorted by suffix
+
+public:
+  explicit environment_names(const field_table &table)
+      : suffixes_(table.size), by_suffix_(table.size) {
+    for (std::size_t i = 0; i < table.size; i++) {
+      suffixes_[i] = environment_name(table.names[i]);
+      by_suffix_[i] = i;
+    }
+    std::sort(by_suffix_.begin(), by_suffix_.end(), [this](std::size_t a, std::size_t b) {
+      return suffixes_[a] < suffixes_[b];
+    });
+  }
+
+  // Calls `f(index)` for every field whose variable ends with `suffix`, e.g.,
+  // `logLevel` and `loglevel` for `LOGLEVEL`
+  template <typename F> void find(std::string_view suffix, F &&f) const {
+    auto match = std::lower_bound(by_suffix_.begin(), by_suffix_.end(), suffix,
+                                  [this](std::size_t index, std::string_view key) {
+                                    return suffixes_[index] < key;
+                                  });
+    for (; match != by_suffix_.end() && suffixes_[*match] == suffix; ++match) {
+      f(*match);
+    }
+  }
+};
+
+template <typename T> const environment_names &environment_names_of() {
+  static const environment_names names(field_table_of<T>::value);
+  return names;
+}
+
+// The values of the environment variables of the `wanted` fields of a struct
+//
+// `environ` is scanned once. Most entries are rejected by their first character; the
+// others are looked up among the explicit variables and, after the prefix, among the
+// names of the fields, in O(log fields). No name is built, and nothing is allocated
+// unless a variable is set. The values are views into the environment, valid until
+// it changes
+class environment {
+  std::vector<std::optional<std::string_view>> values_; // of each field, if any is set
+
+public:
+  environment(const field_table &table, const environment_names &names,
+              const environment_options &options, const field_set &wanted,
+              char **entries) {
+    if (entries == nullptr || wanted.none()) {
+      return;
+    }
+
+    // a field named with `env(field, variable)` does not read the prefixed variable
+    field_set named;
+    std::array<bool, 256> first_characters{};
+    for (const auto &[field, variable] : options.variables) {
+      const auto index = table.find(field);
+      if (index != no_field && !variable.empty()) {
+        named.set(index);
+        first_characters[static_cast<unsigned char>(variable[0])] = true;
+      }
+    }
+    const std::string_view prefix = options.prefix ? *options.prefix : std::string_view{};
+    if (options.prefix.has_value()) {
+      if (prefix.empty()) {
+        first_characters.fill(true);
+      } else {
+        first_characters[static_cast<unsigned char>(prefix[0])] = true;
+      }
+    }
+
+    const auto set = [&](std::size_t index, std::string_view value) {
+      if (values_.empty()) {
+        values_.resize(table.size);
+      }
+      values_[index] = value;
+    };
+    for (auto entry = entries; *entry != nullptr; ++entry) {
+      if (!first_characters[static_cast<unsigned char>(**entry)]) {
+        continue;
+      }
+      // the value is not read, e.g., a long `PATH`, unless it is wanted
+      const char *equal = std::strchr(*entry, '=');
+      if (equal == nullptr) {
+        continue;
+      }
+      const std::string_view name(*entry, static_cast<std::size_t>(equal - *entry));
+      const std::string_view value(equal + 1);
+      // several fields may read the same variable
+      for (const auto &[field, variable] : options.variables) {
+        const auto index = variable == name ? table.find(field) : no_field;
+        if (index != no_field && wanted[index]) {
+          set(index, value);
+        }
+      }
+      if (options.prefix.has_value() && name.size() > prefix.size() &&
+          name.compare(0, prefix.size(), prefix) == 0) {
+        names.find(name.substr(prefix.size()), [&](std::size_t index) {
+          if (wanted[index] && !named[index]) {
+            set(index, value);
+          }
+        });
+      }
+    }
+  }
+
+  // Value of the variable of field `index`, if it is set
+  std::optional<std::string_view> value(std::size_t index) const {
+    return values_.empty() ? std::nullopt : values_[index];
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
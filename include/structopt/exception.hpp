@@ -1,28 +1,58 @@
-
 #pragma once
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <structopt/parse_error.hpp>
 #include <structopt/visitor.hpp>
 
 namespace structopt {
 
 class exception : public std::exception {
+  // Help is rendered on the first call to help(), if ever, once for all the copies
+  // of the exception
+  struct lazy_help {
+    const details::visitor *schema; // shared, see details::schema<T>()
+    std::string_view name;          // program (or sub-command) name
+    std::string_view help;          // custom help message, if any
+    std::shared_ptr<const details::program_info> program; // keeps the views alive
+    mutable std::once_flag rendered;
+    mutable std::string text;
+
+    lazy_help(const details::visitor *schema, std::string_view name, std::string_view help,
+              std::shared_ptr<const details::program_info> program)
+        : schema(schema), name(name), help(help), program(std::move(program)) {}
+  };
+
   std::string what_{""};
-  std::string help_{""};
-  details::visitor visitor_;
+  std::shared_ptr<const lazy_help> help_;
 
 public:
-  exception(const std::string &what, const details::visitor &visitor)
-      : what_(what), help_(""), visitor_(visitor) {
-    std::stringstream os;
-    visitor_.print_help(os);
-    help_ = os.str();
-  }
+  // `visitor` must outlive the exception, e.g., details::schema<T>(), and so must
+  // `name` and `help`, unless they are views into `program`
+  exception(const std::string &what, const details::visitor &visitor,
+            std::string_view name, std::string_view help = "",
+            std::shared_ptr<const details::program_info> program = nullptr)
+      : what_(what),
+        help_(std::make_shared<const lazy_help>(&visitor, name, help, std::move(program))) {}
 
   const char *what() const throw() { return what_.c_str(); }
 
-  const char *help() const throw() { return help_.c_str(); }
+  // Empty if the help cannot be rendered, e.g., out of memory
+  const char *help() const throw() {
+    try {
+      std::call_once(help_->rendered, [this]() {
+        std::stringstream os;
+        help_->schema->print_help(os, help_->name, help_->help);
+        help_->text = os.str();
+      });
+    } catch (...) {
+      return "";
+    }
+    return help_->text.c_str();
+  }
 };
 
-} // namespace structopt
\ No newline at end of file
+} // namespace structopt
@@ -0,0 +1,204 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <structopt/is_specialization.hpp>
+#include <structopt/third_party/visit_struct/visit_struct.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace structopt {
+
+namespace details {
+
+enum class field_kind : std::uint8_t { flag, optional, positional, nested_struct };
+
+template <typename T> constexpr field_kind get_field_kind() {
+  if constexpr (structopt::is_specialization<T, std::optional>::value) {
+    if constexpr (std::is_same<typename T::value_type, bool>::value) {
+      return field_kind::flag;
+    } else {
+      return field_kind::optional;
+    }
+  } else if constexpr (visit_struct::traits::is_visitable<T>::value) {
+    return field_kind::nested_struct;
+  } else {
+    return field_kind::positional;
+  }
+}
+
+// FNV-1a hash of a field name where `-` and `_` hash the same,
+// e.g., `log-level` and `log_level` refer to the same field
+constexpr std::uint32_t hash_field_name(std::string_view name) {
+  std::uint32_t hash = 2166136261u;
+  for (auto c : name) {
+    hash = (hash ^ static_cast<unsigned char>(c == '-' ? '_' : c)) * 16777619u;
+  }
+  return hash;
+}
+
+// Effectively s1.replace('-', '_') == s2.replace('-', '_')
+constexpr bool equal_field_names(std::string_view s1, std::string_view s2) {
+  if (s1.size() != s2.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < s1.size(); i++) {
+    const char c1 = s1[i] == '-' ? '_' : s1[i];
+    const char c2 = s2[i] == '-' ? '_' : s2[i];
+    if (c1 != c2) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Field indices are stored as 16-bit values to keep the tables small
+using field_index_t = std::uint16_t;
+constexpr field_index_t no_field = static_cast<field_index_t>(-1);
+
+// A set of field indices of a struct, e.g., the options given in the arguments
+using field_set = std::bitset<visit_struct::max_visitable_members>;
+
+// Smallest power of two that leaves the hash table at most half full
+constexpr std::size_t field_slot_count(std::size_t num_fields) {
+  std::size_t result = 2;
+  while (result < num_fields * 2) {
+    result *= 2;
+  }
+  return result;
+}
+
+// Open addressing (linear probing) hash table: slot => field index
+template <std::size_t Slots, std::size_t N>
+constexpr std::array<field_index_t, Slots>
+make_field_slots(const std::array<std::string_view, N> &names) {
+  std::array<field_index_t, Slots> result{};
+  for (auto &slot : result) {
+    slot = no_field;
+  }
+  for (std::size_t i = 0; i < N; i++) {
+    auto slot = hash_field_name(names[i]) & (Slots - 1);
+    while (result[slot] != no_field) {
+      slot = (slot + 1) & (Slots - 1);
+    }
+    result[slot] = static_cast<field_index_t>(i);
+  }
+  return result;
+}
+
+// First character => index of the first field (of one of the given kinds)
+// that starts with that character
+template <std::size_t N>
+constexpr std::array<field_index_t, 256>
+make_short_names(const std::array<std::string_view, N> &names,
+                 const std::array<field_kind, N> &kinds, bool flags, bool options,
+                 bool others) {
+  std::array<field_index_t, 256> result{};
+  for (auto &entry : result) {
+    entry = no_field;
+  }
+  for (std::size_t i = 0; i < N; i++) {
+    const bool included = (kinds[i] == field_kind::flag && flags) ||
+                          (kinds[i] == field_kind::optional && options) ||
+                          (kinds[i] != field_kind::flag &&
+                           kinds[i] != field_kind::optional && others);
+    const auto c = static_cast<unsigned char>(names[i][0]);
+    if (included && result[c] == no_field) {
+      result[c] = static_cast<field_index_t>(i);
+    }
+  }
+  return result;
+}
+
+// Compile-time lookup table of the fields of a STRUCTOPT struct
+//
+// Resolving a (long, kebab-case or short) name to a field index is a constant-time
+// table lookup and never allocates
+struct field_table {
+  std::size_t size;
+  const std::string_view *names;
+  const field_kind *kinds;
+  const field_index_t *slots;
+  std::size_t slot_mask;
+  const field_index_t *short_names;          // any field
+  const field_index_t *short_flag_or_option; // flags and options
+  const field_index_t *short_option;         // options, not flags
+
+  // `log_level` or `log-level` => index of `log_level`
+  constexpr field_index_t find(std::string_view name) const {
+    auto slot = hash_field_name(name) & slot_mask;
+    while (slots[slot] != no_field) {
+      if (equal_field_names(names[slots[slot]], name)) {
+        return slots[slot];
+      }
+      slot = (slot + 1) & slot_mask;
+    }
+    return no_field;
+  }
+
+  // `-log-level`, `--log_level`, etc. => index of `log_level`
+  constexpr field_index_t find_long(std::string_view next) const {
+    if (next.size() > 1 && next[0] == '-') {
+      // remove up to two leading dashes
+      next.remove_prefix(next[1] == '-' ? 2 : 1);
+      return find(next);
+    }
+    return no_field;
+  }
+
+  // `-l` => index of the first field that starts with `l`
+  constexpr field_index_t find_short(std::string_view next,
+                                     const field_index_t *table) const {
+    if (next.size() == 2 && next[0] == '-') {
+      return table[static_cast<unsigned char>(next[1])];
+    }
+    return no_field;
+  }
+
+  constexpr bool is_flag_or_option(field_index_t index) const {
+    return kinds[index] == field_kind::flag || kinds[index] == field_kind::optional;
+  }
+};
+
+template <typename T, std::size_t... I>
+constexpr std::array<std::string_view, sizeof...(I)>
+make_field_names(std::index_sequence<I...>) {
+  return {{std::string_view(visit_struct::get_name<I, T>())...}};
+}
+
+// Expands the member pointers of the struct at once, rather than looking up each
+// field by index, which is linear in the number of fields on some compilers
+template <auto... Pointers>
+constexpr std::array<field_kind, sizeof...(Pointers)>
+make_field_kinds(visit_struct::member_list<nullptr, Pointers...>) {
+  return {{get_field_kind<visit_struct::member_type_t<decltype(Pointers)>>()...}};
+}
+
+template <typename T> struct field_table_of {
+  static constexpr std::size_t size = visit_struct::field_count<T>();
+  static constexpr std::size_t slot_count = field_slot_count(size);
+
+  static constexpr auto names = make_field_names<T>(std::make_index_sequence<size>{});
+  static constexpr auto kinds = make_field_kinds(visit_struct::members<T>{});
+  static constexpr auto slots = make_field_slots<slot_count>(names);
+  static constexpr auto short_names = make_short_names(names, kinds, true, true, true);
+  static constexpr auto short_flag_or_option =
+      make_short_names(names, kinds, true, true, false);
+  static constexpr auto short_option = make_short_names(names, kinds, false, true, false);
+
+  static constexpr field_table value{size,
+                                     names.data(),
+                                     kinds.data(),
+                                     slots.data(),
+                                     slot_count - 1,
+                                     short_names.data(),
+                                     short_flag_or_option.data(),
+                                     short_option.data()};
+};
+
+} // namespace details
+
+} // namespace structopt
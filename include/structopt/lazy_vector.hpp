@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <structopt/parallel_for.hpp>
+#include <structopt/parse_number.hpp>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+struct parser;
+}
+
+// A vector field whose elements are converted when they are first accessed
+//
+// Parsing only copies the text of the values, back to back in one buffer. An
+// element is converted by the first operator[] or at() that reads it, or by
+// materialize(), which converts the remaining elements on several threads.
+// Invalid values are reported on access: std::invalid_argument, or std::out_of_range
+// for numbers that do not fit in a `T`
+//
+// Converting on access writes to the vector; call materialize() before reading
+// the same lazy_vector from several threads
+template <typename T> class lazy_vector {
+  static_assert(details::is_number_type<T>::value || std::is_same<T, std::string>::value,
+                "structopt::lazy_vector<T> supports numbers and std::string");
+
+  std::string text_;              // the values, back to back
+  std::vector<std::size_t> ends_; // end of each value in `text_`
+  std::string_view name_;         // of the field, for error messages
+  mutable std::vector<T> values_;
+  mutable std::vector<std::uint8_t> converted_;
+
+  friend struct structopt::details::parser;
+
+  void reserve(std::size_t size, std::size_t text_size) {
+    ends_.reserve(size);
+    text_.reserve(text_size);
+  }
+
+  void push_back(std::string_view token) {
+    text_.append(token);
+    ends_.push_back(text_.size());
+  }
+
+  void convert(std::size_t i) const {
+    const auto input = token(i);
+    if constexpr (std::is_same<T, std::string>::value) {
+      values_[i].assign(input);
+    } else {
+      const auto ec = details::parse_number(input, values_[i]);
+      if (ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("Error: failed to parse numeric argument `" +
+                                std::string(name_) + "`. `" + std::string(input) +
+                                "` is out of range.");
+      } else if (ec != std::errc()) {
+        throw std::invalid_argument("Error: failed to parse numeric argument `" +
+                                    std::string(name_) + "`. `" + std::string(input) +
+                                    "` is invalid.");
+      }
+    }
+    converted_[i] = 1;
+  }
+
+  static void lower_to(std::atomic<std::size_t> &minimum, std::size_t value) {
+    auto current = minimum.load();
+    while (value < current && !minimum.compare_exchange_weak(current, value)) {
+    }
+  }
+
+  void allocate() const {
+    if (values_.size() != ends_.size()) {
+      values_.resize(ends_.size());
+      converted_.assign(ends_.size(), 0);
+    }
+  }
+
+public:
+  using value_type = T;
+
+  std::size_t size() const { return ends_.size(); }
+
+  bool empty() const { return ends_.empty(); }
+
+  // The text of element `i`, not converted
+  std::string_view token(std::size_t i) const {
+    const auto begin = i == 0 ? 0 : ends_[i - 1];
+    return std::string_view(text_).substr(begin, ends_[i] - begin);
+  }
+
+  const T &operator[](std::size_t i) const {
+    allocate();
+    if (!converted_[i]) {
+      convert(i);
+    }
+    return values_[i];
+  }
+
+  const T &at(std::size_t i) const {
+    if (i >= size()) {
+      throw std::out_of_range("structopt::lazy_vector::at");
+    }
+    return (*this)[i];
+  }
+
+  // Convert every element not converted yet, on `num_threads` threads (0 = one per
+  // core). Throws for the first invalid element, after converting the others
+  const lazy_vector &materialize(std::size_t num_threads = 0) const {
+    allocate();
+    constexpr std::size_t block_size = 4096;
+    std::atomic<std::size_t> first_invalid{size()};
+    details::parallel_for(
+        (size() + block_size - 1) / block_size, num_threads, [&](std::size_t block) {
+          const auto last = std::min(size(), (block + 1) * block_size);
+          for (auto i = block * block_size; i < last; i++) {
+            if (converted_[i]) {
+              continue;
+            }
+            try {
+              convert(i);
+            } catch (const std::logic_error &) {
+              // std::invalid_argument or std::out_of_range
+              lower_to(first_invalid, i);
+            }
+          }
+        });
+    if (first_invalid < size()) {
+      // throws again
+      convert(first_invalid);
+    }
+    return *this;
+  }
+
+  // Every element, converted
+  const std::vector<T> &values(std::size_t num_threads = 0) const {
+    return materialize(num_threads).values_;
+  }
+};
+
+} // namespace structopt
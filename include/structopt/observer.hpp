@@ -0,0 +1,67 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <structopt/token_kind.hpp>
+
+// Define STRUCTOPT_DISABLE_OBSERVERS to compile the observer hooks out of the parser:
+// app::observe is then ignored. Otherwise a parse without an observer only tests a
+// null pointer at each hook, and never reads the clock
+//
+// The macro changes the definitions of inline parser functions, so every translation
+// unit of a program must agree on it, or the linker silently keeps one of the
+// definitions. Set it for the whole build with the CMake option of the same name,
+// which defines it for every target that links structopt, not in a source file
+#ifdef STRUCTOPT_DISABLE_OBSERVERS
+#define STRUCTOPT_OBSERVERS 0
+#else
+#define STRUCTOPT_OBSERVERS 1
+#endif
+
+namespace structopt {
+
+class parse_error;
+
+using token_kind = details::token_kind;
+
+enum class parse_event_kind : std::uint8_t {
+  parse_started,      // before the sources and the arguments are read
+  token_classified,   // `token` is a literal, a number, an option, etc., see `kind`
+  field_matched,      // `token` routes to the field `field`
+  value_converted,    // the value of `field` was parsed from `tokens` tokens
+  subcommand_entered, // `token` names the nested struct `field`
+  error_raised,       // the first error of the parse, see `error`
+  parse_finished,     // after the last check, whether the parse failed or not
+};
+
+// A step of a parse, see structopt::observer
+//
+// Views are valid during the call only
+struct parse_event {
+  parse_event_kind kind{parse_event_kind::parse_started};
+  std::chrono::steady_clock::time_point time{};
+  std::size_t token_index{0}; // of `token` in the arguments
+  std::string_view token;
+  token_kind kind_of_token{token_kind::literal}; // token_classified
+  std::string_view field;                        // name of the field, if any
+  std::size_t tokens{0};                         // value_converted: tokens consumed
+  bool converted{true};                          // value_converted: without error
+  const parse_error *error{nullptr};             // error_raised
+};
+
+// Told about every step of a parse, e.g., to find where the time of a slow parse
+// went; see app::observe and structopt::trace_observer
+//
+// Nested events bracket each other: a value_converted event closes the last
+// field_matched event of the same field, and every event of a sub-command falls
+// between its field_matched and value_converted events. With app::parse_batch, the
+// events of several parses interleave
+class observer {
+public:
+  virtual ~observer() = default;
+
+  virtual void on_event(const parse_event &event) = 0;
+};
+
+} // namespace structopt
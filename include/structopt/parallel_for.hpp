@@ -0,0 +1,76 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// `num_threads`, or one thread per core if 0
+inline std::size_t resolve_thread_count(std::size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return num_threads;
+}
+
+// Calls `f(i)` for every `i` in [0, count) on up to `num_threads` threads, the
+// calling thread included
+//
+// Indices are handed out one at a time through a shared counter, so `f` should do
+// a block of work per index. The first exception thrown by `f` is rethrown once
+// every thread has finished. If a thread cannot be started, the threads that were
+// started and the calling thread do the rest
+template <typename F>
+void parallel_for(std::size_t count, std::size_t num_threads, F &&f) {
+  num_threads = std::min(resolve_thread_count(num_threads), count);
+  if (num_threads <= 1) {
+    for (std::size_t i = 0; i < count; i++) {
+      f(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::exception_ptr exception;
+  std::atomic_flag exception_stored = ATOMIC_FLAG_INIT;
+  const auto worker = [&] {
+    try {
+      for (auto i = next++; i < count; i = next++) {
+        f(i);
+      }
+    } catch (...) {
+      // e.g., std::bad_alloc, or a throwing operator>> of a field type
+      if (!exception_stored.test_and_set()) {
+        exception = std::current_exception();
+      }
+      next = count;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  try {
+    threads.reserve(num_threads - 1);
+    for (std::size_t i = 1; i < num_threads; i++) {
+      threads.emplace_back(worker);
+    }
+  } catch (...) {
+    // e.g., std::system_error when the process is out of threads; the started
+    // threads must still be joined, so carry on with fewer
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+} // namespace details
+
+} // namespace structopt
@@ -0,0 +1,244 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <structopt/visitor.hpp>
+
+namespace structopt {
+
+namespace details {
+struct parser;
+
+// Set once per app and shared with its errors, so that an error can outlive the app
+struct program_info {
+  std::string name;
+  std::string version;
+  std::string help; // custom help message, if any
+};
+
+// Which check failed; selects the error message
+enum class error_detail : std::uint8_t {
+  help_requested,
+  version_requested,
+  unrecognized_argument,
+  unexpected_argument,
+  optional_argument_missing,
+  optional_argument_invalid,
+  positional_argument_missing,
+  numeric_argument_invalid,
+  numeric_argument_out_of_range,
+  boolean_argument_invalid,
+  enum_argument_invalid,
+  pair_argument_missing,
+  pair_element_invalid,
+  array_argument_missing,
+  tuple_argument_missing,
+  tuple_element_invalid,
+  sub_command_conflict,
+  response_file_cycle,
+  record_input_failed,
+  config_syntax_error,
+  config_key_unknown,
+  config_too_many_values,
+};
+} // namespace details
+
+class app;
+
+enum class error_kind : std::uint8_t {
+  help_requested,        // `-h` or `--help`
+  version_requested,     // `-v` or `--version`
+  unrecognized_argument, // e.g., `--foo` where there is no field `foo`
+  unexpected_argument,   // e.g., an excess positional argument
+  missing_value,         // e.g., `--foo` at the end of the arguments
+  invalid_value,         // e.g., `--count abc`
+  value_out_of_range,    // e.g., `--count 99999999999` for an int field
+  sub_command_conflict,  // two different sub-commands invoked
+  response_file_cycle,   // `@file` includes itself, directly or indirectly
+  input_failed,          // reading values from a file descriptor failed
+  invalid_config,        // the config file cannot be read, or has an unknown key
+};
+
+// Describes why parsing failed
+//
+// Describing an error is cheap: the message and the help text are only
+// formatted when `message()` or `help()` is called, and the program's name, version
+// and help are shared with the app, not copied
+class parse_error {
+  details::error_detail detail_;
+  std::size_t token_index_{0};
+  std::string_view field_name_;
+  std::string token_; // copied: the arguments, e.g., a response file, may be gone
+  std::size_t expected_{0};            // e.g., number of values of a std::array
+  std::size_t provided_{0};            // e.g., number of values found
+  std::string_view other_sub_command_; // the sub-command that was already invoked
+  std::string (*allowed_values_)(){nullptr};
+  const char *reason_{nullptr}; // e.g., of a syntax error
+  std::string source_;          // e.g., "config file `app.toml`", for errors in a source
+  std::size_t line_{0};         // in `source_`
+
+  // For rendering help; the views are into `program_` or the schema, nothing is copied
+  const details::visitor *schema_{nullptr};
+  std::string_view name_;    // program (or sub-command) name
+  std::string_view help_;    // custom help message, if any
+  std::string_view version_; // printed for `--version`
+  std::shared_ptr<const details::program_info> program_; // set by the app
+
+  friend struct details::parser;
+  friend class structopt::app;
+
+  explicit parse_error(details::error_detail detail) : detail_(detail) {}
+
+public:
+  error_kind kind() const {
+    switch (detail_) {
+    case details::error_detail::help_requested:
+      return error_kind::help_requested;
+    case details::error_detail::version_requested:
+      return error_kind::version_requested;
+    case details::error_detail::unrecognized_argument:
+      return error_kind::unrecognized_argument;
+    case details::error_detail::unexpected_argument:
+      return error_kind::unexpected_argument;
+    case details::error_detail::optional_argument_missing:
+    case details::error_detail::positional_argument_missing:
+    case details::error_detail::pair_argument_missing:
+    case details::error_detail::array_argument_missing:
+    case details::error_detail::tuple_argument_missing:
+      return error_kind::missing_value;
+    case details::error_detail::numeric_argument_out_of_range:
+      return error_kind::value_out_of_range;
+    case details::error_detail::sub_command_conflict:
+      return error_kind::sub_command_conflict;
+    case details::error_detail::response_file_cycle:
+      return error_kind::response_file_cycle;
+    case details::error_detail::record_input_failed:
+      return error_kind::input_failed;
+    case details::error_detail::config_syntax_error:
+    case details::error_detail::config_key_unknown:
+    case details::error_detail::config_too_many_values:
+      return error_kind::invalid_config;
+    default:
+      return error_kind::invalid_value;
+    }
+  }
+
+  // Index of the offending token in `argv`; `argc` if the arguments ended early
+  // With response files, an index into the arguments after expanding them
+  std::size_t token_index() const { return token_index_; }
+
+  // Name of the field that could not be parsed, if any
+  std::string_view field_name() const { return field_name_; }
+
+  // The offending token, if any
+  std::string_view token() const { return token_; }
+
+  // Same message as structopt::exception::what()
+  //
+  // Errors in a source, e.g., a config file, start with its origin and the line, e.g.,
+  // "Error: config file `app.toml`, line 3: unrecognized key `job`."
+  std::string message() const {
+    if (source_.empty()) {
+      return describe();
+    }
+    auto result = describe();
+    const std::string_view prefix = "Error: ";
+    if (result.compare(0, prefix.size(), prefix) == 0) {
+      result.erase(0, prefix.size());
+    }
+    return "Error: " + source_ +
+           (line_ != 0 ? ", line " + std::to_string(line_) : std::string{}) + ": " +
+           result;
+  }
+
+  // Help of the program (or sub-command) that failed to parse
+  std::string help() const {
+    std::stringstream os;
+    if (schema_) {
+      schema_->print_help(os, name_, help_);
+    }
+    return os.str();
+  }
+
+private:
+  std::string describe() const {
+    using details::error_detail;
+    const std::string field{field_name_};
+    switch (detail_) {
+    case error_detail::help_requested:
+      return help();
+    case error_detail::version_requested:
+      return std::string{version_};
+    case error_detail::unrecognized_argument:
+      return "Error: unrecognized argument '" + token_ + "'";
+    case error_detail::unexpected_argument:
+      return "Error: unexpected argument '" + token_ + "'";
+    case error_detail::optional_argument_missing:
+      return "Error: expected value for optional argument `" + field + "`.";
+    case error_detail::optional_argument_invalid:
+      return "Error: failed to correctly parse optional argument `" + field + "`.";
+    case error_detail::positional_argument_missing:
+      return "Error: expected value for positional argument `" + field + "`.";
+    case error_detail::numeric_argument_invalid:
+      return "Error: failed to parse numeric argument `" + field + "`. `" + token_ +
+             "` is invalid.";
+    case error_detail::numeric_argument_out_of_range:
+      return "Error: failed to parse numeric argument `" + field + "`. `" + token_ +
+             "` is out of range.";
+    case error_detail::boolean_argument_invalid: {
+      std::string lower_case_token = token_;
+      std::transform(lower_case_token.begin(), lower_case_token.end(),
+                     lower_case_token.begin(),
+                     [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+      return "Error: failed to parse boolean argument `" + field + "`. `" +
+             lower_case_token + "` is invalid.";
+    }
+    case error_detail::enum_argument_invalid:
+      return "Error: unexpected input `" + token_ + "` provided for enum argument `" +
+             field + "`. Allowed values are {" +
+             (allowed_values_ ? allowed_values_() : std::string{}) + "}";
+    case error_detail::pair_argument_missing:
+      return "Error: failed to correctly parse the pair `" + field + "`. Expected 2 " +
+             (provided_ == 0 ? "arguments, 0 provided." : "arguments, only 1 provided.");
+    case error_detail::pair_element_invalid:
+      return "Error: failed to correctly parse " +
+             std::string(provided_ == 0 ? "first" : "second") + " element of pair `" +
+             field + "`";
+    case error_detail::array_argument_missing:
+      return "Error: expected " + std::to_string(expected_) +
+             " values for std::array argument `" + field + "` - instead got only " +
+             std::to_string(provided_) + " arguments.";
+    case error_detail::tuple_argument_missing:
+      return "Error: failed to correctly parse tuple `" + field + "`. Expected " +
+             std::to_string(expected_) + " arguments, " + std::to_string(provided_) +
+             " provided.";
+    case error_detail::tuple_element_invalid:
+      return "Error: failed to correctly parse tuple `" + field + "` {size = " +
+             std::to_string(expected_) + "} at index " + std::to_string(provided_) +
+             ".";
+    case error_detail::sub_command_conflict:
+      return "Error: failed to invoke sub-command `" + field +
+             "` because a different sub-command, `" + std::string{other_sub_command_} +
+             "`, has already been invoked.";
+    case error_detail::response_file_cycle:
+      return "Error: response file `" + token_.substr(1) +
+             "` includes itself, directly or indirectly.";
+    case error_detail::record_input_failed:
+      return "Error: failed to read the values of `" + field + "` from the input.";
+    case error_detail::config_syntax_error:
+      return std::string("Error: ") + (reason_ ? reason_ : "syntax error") + ".";
+    case error_detail::config_key_unknown:
+      return "Error: unrecognized key `" + token_ + "`.";
+    case error_detail::config_too_many_values:
+      return "Error: too many values for `" + field + "`.";
+    }
+    return "";
+  }
+};
+
+} // namespace structopt
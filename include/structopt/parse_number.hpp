@@ -0,0 +1,154 @@
+#pragma once
+#include <charconv>
+#include <limits>
+#include <string_view>
+#include <structopt/is_number.hpp>
+#include <system_error>
+#include <type_traits>
+
+#if !defined(__cpp_lib_to_chars)
+// std::from_chars for floating-point types is not available
+#include <cmath>
+#include <locale>
+#include <sstream>
+#include <string>
+#endif
+
+namespace structopt {
+
+namespace details {
+
+// Arithmetic types that are parsed as numbers
+// Character types are read as characters, e.g., `-c x`, and bool has its own rules
+template <typename T>
+struct is_number_type
+    : std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                       !std::is_same<T, bool>::value &&
+                                       !std::is_same<T, char>::value &&
+                                       !std::is_same<T, signed char>::value &&
+                                       !std::is_same<T, unsigned char>::value &&
+                                       !std::is_same<T, wchar_t>::value &&
+                                       !std::is_same<T, char16_t>::value &&
+                                       !std::is_same<T, char32_t>::value> {};
+
+// `.` followed by zero or more digits, e.g., the `.7` in `42.7`
+inline bool is_fractional_part(std::string_view input) {
+  return !input.empty() && input[0] == '.' &&
+         input.find_first_not_of("0123456789", 1) == std::string_view::npos;
+}
+
+// Parse an integer, e.g., `42`, `-42`, `+42`, `0x2A`, `052` or `0b101010`
+// A decimal number with a fractional part, e.g., `42.7`, is truncated to `42`
+//
+// Returns std::errc::invalid_argument if `input` is not a number (or has trailing
+// characters) and std::errc::result_out_of_range if it does not fit in `T`
+template <typename T> std::errc parse_integer(std::string_view input, T &result) {
+  bool negative = false;
+  if (!input.empty() && (input[0] == '-' || input[0] == '+')) {
+    negative = input[0] == '-';
+    input.remove_prefix(1);
+  }
+
+  int base = 10;
+  if (is_hex_notation(input)) {
+    base = 16;
+    input.remove_prefix(2); // remove "0x"
+  } else if (is_binary_notation(input)) {
+    base = 2;
+    input.remove_prefix(2); // remove "0b"
+  } else if (is_octal_notation(input)) {
+    base = 8;
+    input.remove_prefix(1); // remove "0"
+  }
+
+  // Parse the magnitude; the sign is applied below
+  using unsigned_type = typename std::make_unsigned<T>::type;
+  unsigned_type magnitude{};
+  const auto last = input.data() + input.size();
+  const auto [ptr, ec] = std::from_chars(input.data(), last, magnitude, base);
+  if (ec != std::errc()) {
+    return ec;
+  }
+  if (ptr != last &&
+      !(base == 10 && is_fractional_part(std::string_view(ptr, last - ptr)))) {
+    // trailing characters, e.g., `42abc`
+    return std::errc::invalid_argument;
+  }
+
+  constexpr auto max = static_cast<unsigned_type>((std::numeric_limits<T>::max)());
+  if (!negative) {
+    if (magnitude > max) {
+      return std::errc::result_out_of_range;
+    }
+    result = static_cast<T>(magnitude);
+  } else if (magnitude == 0) {
+    result = 0;
+  } else if constexpr (std::is_unsigned<T>::value) {
+    return std::errc::result_out_of_range;
+  } else {
+    if (magnitude - 1 > max) {
+      return std::errc::result_out_of_range;
+    }
+    // -(magnitude - 1) - 1 does not overflow for the smallest value of `T`
+    result = static_cast<T>(-static_cast<T>(magnitude - 1) - 1);
+  }
+  return std::errc();
+}
+
+// Parse a floating-point number, e.g., `-3.15`, `+2.717`, `2E-4` or `.5`
+//
+// Same error reporting as parse_integer
+template <typename T> std::errc parse_floating_point(std::string_view input, T &result) {
+  // std::from_chars does not accept a leading `+`
+  if (input.size() > 1 && input[0] == '+' && input[1] != '-') {
+    input.remove_prefix(1);
+  }
+
+#if defined(__cpp_lib_to_chars)
+  const auto last = input.data() + input.size();
+  const auto [ptr, ec] = std::from_chars(input.data(), last, result);
+  if (ec != std::errc()) {
+    return ec;
+  }
+  if (ptr != last) {
+    // trailing characters, e.g., `1.5abc`
+    return std::errc::invalid_argument;
+  }
+  return std::errc();
+#else
+  if (input.empty() || input[0] == '+' ||
+      std::isspace(static_cast<unsigned char>(input[0]))) {
+    return std::errc::invalid_argument;
+  }
+  std::istringstream ss{std::string{input}};
+  ss.imbue(std::locale::classic());
+  T value{};
+  ss >> value;
+  if (ss.fail()) {
+    // out-of-range values are reported as the largest value of `T`
+    return std::fabs(value) == (std::numeric_limits<T>::max)()
+               ? std::errc::result_out_of_range
+               : std::errc::invalid_argument;
+  }
+  if (ss.peek() != std::char_traits<char>::eof()) {
+    // trailing characters, e.g., `1.5abc`
+    return std::errc::invalid_argument;
+  }
+  result = value;
+  return std::errc();
+#endif
+}
+
+// Locale-independent, non-allocating conversion of `input` to a number
+template <typename T> std::errc parse_number(std::string_view input, T &result) {
+  static_assert(is_number_type<T>::value, "parse_number: unsupported type");
+  if constexpr (std::is_integral<T>::value) {
+    return parse_integer(input, result);
+  } else {
+    return parse_floating_point(input, result);
+  }
+}
+
+} // namespace details
+
+} // namespace structopt
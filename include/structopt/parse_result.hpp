@@ -0,0 +1,34 @@
+#pragma once
+#include <optional>
+#include <structopt/parse_error.hpp>
+#include <utility>
+
+namespace structopt {
+
+// Either the parsed struct or a description of why parsing failed
+template <typename T> class parse_result {
+  std::optional<T> value_;
+  std::optional<parse_error> error_;
+
+public:
+  parse_result(T value) : value_(std::move(value)) {}
+
+  parse_result(parse_error error) : error_(std::move(error)) {}
+
+  bool has_value() const { return value_.has_value(); }
+
+  explicit operator bool() const { return has_value(); }
+
+  // Throws std::bad_optional_access if parsing failed
+  T &value() & { return value_.value(); }
+  const T &value() const & { return value_.value(); }
+  T &&value() && { return std::move(value_).value(); }
+
+  T *operator->() { return &value_.value(); }
+  const T *operator->() const { return &value_.value(); }
+
+  // Throws std::bad_optional_access if parsing succeeded
+  const parse_error &error() const { return error_.value(); }
+};
+
+} // namespace structopt
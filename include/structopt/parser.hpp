@@ -3,18 +3,28 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <chrono>
 #include <initializer_list>
-#include <iostream>
 #include <iterator>
 #include <set>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <structopt/array_size.hpp>
-#include <structopt/exception.hpp>
-#include <structopt/is_number.hpp>
+#include <structopt/environment.hpp>
+#include <structopt/field_table.hpp>
 #include <structopt/is_specialization.hpp>
+#include <structopt/lazy_vector.hpp>
+#include <structopt/observer.hpp>
+#include <structopt/parallel_for.hpp>
+#include <structopt/parse_error.hpp>
+#include <structopt/parse_number.hpp>
+#include <structopt/record_reader.hpp>
+#include <structopt/settings.hpp>
+#include <structopt/stream.hpp>
 #include <structopt/sub_command.hpp>
+#include <structopt/token_cursor.hpp>
+#include <structopt/token_kind.hpp>
 #include <structopt/third_party/magic_enum/magic_enum.hpp>
 #include <structopt/third_party/visit_struct/visit_struct.hpp>
 #include <tuple>
@@ -33,37 +43,102 @@ inline bool equal_strings_replace_hyphens(std::string_view s1, std::string_view
   });
 }
 
+// `c` => `-c`, e.g., to service the flags of a combined argument `-abc`
+// The two-character tokens live in static storage - no allocation per flag
+inline std::string_view short_option_token(char c) {
+  static constexpr auto tokens = [] {
+    std::array<std::array<char, 2>, 256> result{};
+    for (std::size_t i = 0; i < result.size(); i++) {
+      result[i] = {'-', static_cast<char>(i)};
+    }
+    return result;
+  }();
+  return {tokens[static_cast<unsigned char>(c)].data(), 2};
+}
+
+// A value that is parsed from exactly one token, e.g., a number or a string
+// - one container element per token, so the token count is the element count
+template <typename T>
+struct is_single_token_value
+    : std::integral_constant<bool, !visit_struct::traits::is_visitable<T>::value &&
+                                       !is_specialization<T, std::pair>::value &&
+                                       !is_specialization<T, std::tuple>::value &&
+                                       !is_stl_container<T>::value> {};
+
 struct parser {
-  structopt::details::visitor visitor;
-  std::vector<std::string> arguments;
-  std::size_t current_index{1};
-  std::size_t next_index{1};
+  std::string_view name;    // program (or sub-command) name
+  std::string_view version; // program version
+  std::string_view help;    // custom help message, if any
+  const structopt::details::visitor *visitor{nullptr};
+  const field_table *fields{nullptr};
+  token_cursor arguments;
+  std::size_t positional_index{0}; // next field in `visitor->positional_field_names`
   bool double_dash_encountered{false}; // "--" option-argument delimiter
   bool sub_command_invoked{false};
-  std::string already_invoked_subcommand_name{""};
+  std::string_view already_invoked_subcommand_name;
+  std::optional<structopt::parse_error> failure; // first error, if any
+  std::size_t num_threads{1}; // for converting long lists of strings, 0 = one per core
+  record_reader *records{nullptr}; // replaces `-` among container values, if set
+  field_set *given_options{nullptr}; // indices of the optional fields parsed, if set
+  structopt::observer *events{nullptr}; // told about every step of the parse, if set
+  bool literal_values{false}; // every token is a value, e.g., of a config file setting
+
+  // Errors are recorded, not thrown - parsing stops at the first error
+  bool failed() const { return failure.has_value(); }
+
+  // Tell `events` about a step of the parse at the next token
+  // Without an observer, this is a null test: the clock is not read
+  void notify(parse_event_kind kind, std::string_view field = {}, std::size_t tokens = 0,
+              token_kind kind_of_token = token_kind::literal) const {
+#if STRUCTOPT_OBSERVERS
+    if (events != nullptr) {
+      parse_event event;
+      event.kind = kind;
+      event.time = std::chrono::steady_clock::now();
+      event.token_index = arguments.index();
+      if (!arguments.empty()) {
+        event.token = arguments.peek();
+      }
+      event.kind_of_token = kind_of_token;
+      event.field = field;
+      event.tokens = tokens;
+      event.converted = !failed();
+      event.error = failure.has_value() ? &failure.value() : nullptr;
+      events->on_event(event);
+    }
+#else
+    (void)kind, (void)field, (void)tokens, (void)kind_of_token;
+#endif
+  }
+
+  structopt::parse_error &fail(error_detail detail, std::string_view field_name = {}) {
+    if (!failure.has_value()) {
+      failure = structopt::parse_error(detail);
+      failure->token_index_ = arguments.index();
+      failure->field_name_ = field_name;
+      if (!arguments.empty()) {
+        failure->token_ = arguments.peek();
+      }
+      failure->schema_ = visitor;
+      failure->name_ = name;
+      failure->help_ = help;
+      notify(parse_event_kind::error_raised, field_name);
+    }
+    return *failure;
+  }
 
+  // e.g., -b, -v, --verbose, -abc, --foo=bar but not -5 or -3.15
   bool is_optional(std::string_view name) {
     if (double_dash_encountered) {
       return false;
-    } else if (name == "--") {
-      double_dash_encountered = true;
-      return false;
-    } else if (is_valid_number(name)) {
-      return false;
     }
 
-    bool result = false;
-    if (name.size() >= 2) {
-      // e.g., -b, -v
-      if (name[0] == '-') {
-        result = true;
-        // e.g., --verbose
-        if (name[1] == '-') {
-          result = true;
-        }
-      }
+    const auto kind = classify_token(name);
+    if (kind == token_kind::double_dash) {
+      double_dash_encountered = true;
+      return false;
     }
-    return result;
+    return kind != token_kind::literal && kind != token_kind::number;
   }
 
   bool is_kebab_case(std::string_view next, std::string_view field_name) {
@@ -101,14 +176,8 @@ struct parser {
       return false;
     }
 
-    bool result = false;
-    for (auto &field_name : visitor.field_names) {
-      result = is_optional_field(next, field_name);
-      if (result) {
-        break;
-      }
-    }
-    return result;
+    return fields->find_long(next) != no_field ||
+           fields->find_short(next, fields->short_names) != no_field;
   }
 
   // checks if the next argument is a delimited optional field
@@ -136,47 +205,27 @@ struct parser {
       }
 
       // split `next` into key and value
-      // check if key is an optional field
-      std::string key;
-      bool delimiter_found = false;
-      for (size_t i = 0; i < next.size(); i++) {
-        if (next[i] == c && !delimiter_found) {
-          delimiter = c;
-          delimiter_found = true;
-        } else {
-          if (!delimiter_found) {
-            key += next[i];
-          }
-        }
-      }
-
-      // check if `key` is a valid optional field
-      if (delimiter_found && is_optional_field(key)) {
+      // check if key is a valid optional field
+      const auto key = next.substr(0, next.find(c));
+      delimiter = c;
+      if (is_optional_field(key)) {
         success = true;
       }
     }
     return {success, delimiter};
   }
 
-  std::pair<std::string, std::string> split_delimited_argument(char delimiter,
-                                                               std::string_view next) {
-    std::string key, value;
-    bool delimiter_found = false;
-    for (size_t i = 0; i < next.size(); i++) {
-      if (next[i] == delimiter && !delimiter_found) {
-        delimiter_found = true;
-      } else {
-        if (!delimiter_found) {
-          key += next[i];
-        } else {
-          value += next[i];
-        }
-      }
+  // `--foo=bar` => {`--foo`, `bar`}, both views into `next`
+  std::pair<std::string_view, std::string_view>
+  split_delimited_argument(char delimiter, std::string_view next) {
+    const auto pos = next.find(delimiter);
+    if (pos == std::string_view::npos) {
+      return {next, {}};
     }
-    return {key, value};
+    return {next.substr(0, pos), next.substr(pos + 1)};
   }
 
-  // Get the optional field name if any from 
+  // Get the optional field name if any from
   // e.g., `-v` => `verbose`
   // e.g., `-log-level` => `log_level`
   std::optional<std::string_view> get_full_optional_field_name(std::string_view next) {
@@ -184,279 +233,212 @@ struct parser {
 
     if (next.size() == 2 && next[0] == '-') {
       // short form of optional argument
-      for (auto& oarg : visitor.optional_field_names) {
-        if (oarg[0] == next[1]) {
-          // second character of next matches first character of some optional field_name
-          result = oarg;
-          break;
-        }
+      // second character of next matches first character of some optional field_name
+      const auto index = fields->find_short(next, fields->short_option);
+      if (index != no_field) {
+        result = fields->names[index];
+      } else if (next[1] == 'h') {
+        result = "help";
+      } else if (next[1] == 'v') {
+        result = "version";
       }
-    } else {
+    } else if (next.find_first_not_of('-') != std::string_view::npos) {
       // long form of optional argument
 
       // strip dashes on the left
       const auto potential_field_name = next.substr(next.find_first_not_of('-'));
 
-      // check if `potential_field_name` is in the optional field names list
-      for (auto& oarg : visitor.optional_field_names) {
-        if (equal_strings_replace_hyphens(potential_field_name, oarg)) {
-          result = oarg;
-          break;
-        }
+      // check if `potential_field_name` is an optional field
+      const auto index = fields->find(potential_field_name);
+      if (index != no_field && fields->kinds[index] == field_kind::optional) {
+        result = fields->names[index];
+      } else if (equal_field_names(potential_field_name, "help")) {
+        result = "help";
+      } else if (equal_field_names(potential_field_name, "version")) {
+        result = "version";
       }
-
     }
 
     return result;
   }
 
-  template <typename T> std::pair<T, bool> parse_argument(std::string_view name) {
-    if (next_index >= arguments.size()) {
-      return {T(), false};
+  // Parse the next value(s) straight into `result`
+  // Returns false if there is nothing to parse or `T` is not supported
+  template <typename T> bool parse_argument(std::string_view name, T &result) {
+    if (arguments.empty()) {
+      return false;
     }
-    T result;
-    bool success = true;
     if constexpr (visit_struct::traits::is_visitable<T>::value) {
-      result = parse_nested_struct<T>(name);
+      parse_nested_struct(name, result);
     } else if constexpr (std::is_enum<T>::value) {
-      result = parse_enum_argument<T>(name);
-      next_index += 1;
+      parse_enum_argument(name, result);
+      arguments.advance();
     } else if constexpr (structopt::is_specialization<T, std::pair>::value) {
-      result = parse_pair_argument<typename T::first_type, typename T::second_type>(name);
+      parse_pair_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::tuple>::value) {
-      result = parse_tuple_argument<T>(name);
+      parse_tuple_argument(name, result);
+    } else if constexpr (structopt::is_specialization<T, structopt::stream>::value) {
+      parse_stream_argument(name, result);
+    } else if constexpr (structopt::is_specialization<T, structopt::lazy_vector>::value) {
+      parse_lazy_vector_argument(name, result);
     } else if constexpr (!is_stl_container<T>::value) {
-      result = parse_single_argument<T>(name);
-      next_index += 1;
+      parse_single_argument(name, result);
+      arguments.advance();
     } else if constexpr (structopt::is_array<T>::value) {
-      constexpr std::size_t N = structopt::array_size<T>::size;
-      result = parse_array_argument<typename T::value_type, N>(name);
+      parse_array_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::deque>::value ||
                          structopt::is_specialization<T, std::list>::value ||
                          structopt::is_specialization<T, std::vector>::value) {
-      result = parse_vector_like_argument<T>(name);
+      parse_vector_like_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::set>::value ||
                          structopt::is_specialization<T, std::multiset>::value ||
                          structopt::is_specialization<T, std::unordered_set>::value ||
                          structopt::is_specialization<T,
                                                       std::unordered_multiset>::value) {
-      result = parse_set_argument<T>(name);
+      parse_set_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::queue>::value ||
                          structopt::is_specialization<T, std::stack>::value ||
                          structopt::is_specialization<T, std::priority_queue>::value) {
-      result = parse_container_adapter_argument<T>(name);
+      parse_container_adapter_argument(name, result);
     } else {
-      success = false;
+      return false;
     }
-    return {result, success};
+    return true;
   }
 
-  template <typename T> std::optional<T> parse_optional_argument(std::string_view name) {
-    next_index += 1;
-    std::optional<T> result;
-    if (next_index < arguments.size()) {
-      auto [value, success] = parse_argument<T>(name);
-      if (success) {
-        result = value;
-      } else {
-        throw structopt::exception(
-            "Error: failed to correctly parse optional argument `" + std::string{name} +
-                "`.",
-            visitor);
+  template <typename T>
+  void parse_optional_argument(std::string_view name, std::optional<T> &result) {
+    arguments.advance();
+    if (!arguments.empty()) {
+      if (!parse_argument(name, result.emplace())) {
+        result.reset();
+        fail(error_detail::optional_argument_invalid, name);
       }
     } else {
-      throw structopt::exception("Error: expected value for optional argument `" +
-                                     std::string{name} + "`.",
-                                 visitor);
+      result.reset();
+      fail(error_detail::optional_argument_missing, name);
     }
-    return result;
   }
 
   // Any field that can be constructed using std::stringstream
   // Not container type
   // Not a visitable type, i.e., a nested struct
+  //
+  // Numbers are converted with std::from_chars instead - no allocation
   template <typename T>
-  inline typename std::enable_if<!visit_struct::traits::is_visitable<T>::value, T>::type
-  parse_single_argument(std::string_view) {
-    std::string argument = arguments[next_index];
-    std::istringstream ss(argument);
-    T result;
-
-    if constexpr (std::is_integral<T>::value) {
-      if (is_hex_notation(argument)) {
-        ss >> std::hex >> result;
-      } else if (is_octal_notation(argument)) {
-        ss >> std::oct >> result;
-      } else if (is_binary_notation(argument)) {
-        argument.erase(0, 2); // remove "0b"
-        result = static_cast<T>(std::stoi(argument, nullptr, 2));
-      } else {
-        ss >> std::dec >> result;
+  inline typename std::enable_if<!visit_struct::traits::is_visitable<T>::value>::type
+  parse_single_argument(std::string_view name, T &result) {
+    if constexpr (is_number_type<T>::value) {
+      const auto ec = parse_number(arguments.peek(), result);
+      if (ec == std::errc::result_out_of_range) {
+        fail(error_detail::numeric_argument_out_of_range, name);
+      } else if (ec != std::errc()) {
+        fail(error_detail::numeric_argument_invalid, name);
       }
     } else {
+      std::istringstream ss(std::string{arguments.peek()});
       ss >> result;
     }
-
-    return result;
   }
 
   // Nested visitable struct
+  //
+  // `argument_struct` is default-constructed, or holds the values of a config file
   template <typename T>
-  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, T>::type
-  parse_nested_struct(std::string_view name) {
-
-    T argument_struct;
-
+  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value>::type
+  parse_nested_struct(std::string_view name, T &argument_struct) {
     if constexpr (std::is_base_of<structopt::sub_command, T>::value) {
       argument_struct.invoked_ = true;
     }
 
-    // Save struct field names
-    argument_struct.visitor_.name = name; // sub-command name; not the program
-    argument_struct.visitor_.version = visitor.version;
-    visit_struct::for_each(argument_struct, argument_struct.visitor_);
-
-    // add `help` and `version` optional arguments
-    argument_struct.visitor_.optional_field_names.push_back("help");
-    argument_struct.visitor_.optional_field_names.push_back("version");
-
     if (!sub_command_invoked) {
       sub_command_invoked = true;
       already_invoked_subcommand_name = name;
     } else {
       // a sub-command has already been invoked
-      throw structopt::exception(
-          "Error: failed to invoke sub-command `" + std::string{name} +
-              "` because a different sub-command, `" + already_invoked_subcommand_name +
-              "`, has already been invoked.",
-          argument_struct.visitor_);
+      fail_sub_command_conflict<T>(name);
+      return;
     }
+    notify(parse_event_kind::subcommand_entered, name);
 
     structopt::details::parser parser;
-    parser.next_index = 0;
-    parser.current_index = 0;
+    parser.name = name; // sub-command name; not the program
+    parser.version = version;
+    parser.visitor = &schema<T>(); // shared by every parser of a `T`
     parser.double_dash_encountered = double_dash_encountered;
-    parser.visitor = argument_struct.visitor_;
-
-    std::copy(arguments.begin() + next_index, arguments.end(),
-              std::back_inserter(parser.arguments));
-
-    for (std::size_t i = 0; i < parser.arguments.size(); i++) {
-      parser.current_index = i;
-      visit_struct::for_each(argument_struct, parser);
+    parser.num_threads = num_threads;
+    parser.records = records;
+    parser.events = events;
+    // hand the cursor to the sub-command; the tokens themselves are not copied
+    parser.arguments = std::move(arguments);
+
+    parser.parse_struct(argument_struct);
+    if (!parser.failed()) {
+      parser.check_positional_fields();
     }
 
-    // directly call the parser to check for `help` and `version` flags
-    std::optional<bool> help = false, version = false;
-    for (std::size_t i = 0; i < parser.arguments.size(); i++) {
-      parser.operator()("help", help);
-      parser.operator()("version", version);
-
-      if (help == true) {
-        // if help is requested, print help and exit
-        argument_struct.visitor_.print_help(std::cout);
-        exit(EXIT_SUCCESS);
-      } else if (version == true) {
-        // if version is requested, print version and exit
-        std::cout << argument_struct.visitor_.version << "\n";
-        exit(EXIT_SUCCESS);
-      }
-    }
-
-    // if all positional arguments were provided
-    // this list would be empty
-    if (!parser.visitor.positional_field_names.empty()) {
-      for (auto &field_name : parser.visitor.positional_field_names) {
-        if (std::find(parser.visitor.vector_like_positional_field_names.begin(),
-                      parser.visitor.vector_like_positional_field_names.end(),
-                      field_name) ==
-            parser.visitor.vector_like_positional_field_names.end()) {
-          // this positional argument is not a vector-like argument
-          // it expects value(s)
-          throw structopt::exception("Error: expected value for positional argument `" +
-                                         std::string(field_name) + "`.",
-                                     argument_struct.visitor_);
-        }
-      }
+    // continue after the tokens consumed by the sub-command
+    arguments = std::move(parser.arguments);
+    if (parser.failed()) {
+      failure = std::move(parser.failure);
     }
+  }
 
-    // update current and next
-    current_index += parser.next_index;
-    next_index += parser.next_index;
-
-    return argument_struct;
+  // Reported with the help of the sub-command `name`
+  template <typename T> void fail_sub_command_conflict(std::string_view name) {
+    auto &error = fail(error_detail::sub_command_conflict, name);
+    error.other_sub_command_ = already_invoked_subcommand_name;
+    error.schema_ = &schema<T>();
+    error.name_ = name;
+    error.help_ = {};
   }
 
   // Pair argument
   template <typename T1, typename T2>
-  std::pair<T1, T2> parse_pair_argument(std::string_view name) {
-    std::pair<T1, T2> result;
+  void parse_pair_argument(std::string_view name, std::pair<T1, T2> &result) {
     {
       // Pair first
-      auto [value, success] = parse_argument<T1>(name);
-      if (success) {
-        result.first = value;
-      } else {
-        if (next_index == arguments.size()) {
+      if (!parse_argument(name, result.first)) {
+        if (arguments.empty()) {
           // end of arguments list
           // first argument not provided
-          throw structopt::exception("Error: failed to correctly parse the pair `" +
-                                         std::string{name} +
-                                         "`. Expected 2 arguments, 0 provided.",
-                                     visitor);
+          fail(error_detail::pair_argument_missing, name).provided_ = 0;
         } else {
-          throw structopt::exception(
-              "Error: failed to correctly parse first element of pair `" +
-                  std::string{name} + "`",
-              visitor);
+          fail(error_detail::pair_element_invalid, name).provided_ = 0;
         }
       }
     }
+    if (failed()) {
+      return;
+    }
     {
       // Pair second
-      auto [value, success] = parse_argument<T2>(name);
-      if (success) {
-        result.second = value;
-      } else {
-        if (next_index == arguments.size()) {
+      if (!parse_argument(name, result.second)) {
+        if (arguments.empty()) {
           // end of arguments list
           // second argument not provided
-          throw structopt::exception("Error: failed to correctly parse the pair `" +
-                                         std::string{name} +
-                                         "`. Expected 2 arguments, only 1 provided.",
-                                     visitor);
+          fail(error_detail::pair_argument_missing, name).provided_ = 1;
         } else {
-          throw structopt::exception(
-              "Error: failed to correctly parse second element of pair `" +
-                  std::string{name} + "`",
-              visitor);
+          fail(error_detail::pair_element_invalid, name).provided_ = 1;
         }
       }
     }
-    return result;
   }
 
   // Array argument
   template <typename T, std::size_t N>
-  std::array<T, N> parse_array_argument(std::string_view name) {
-    std::array<T, N> result{};
-
-    const auto arguments_left = arguments.size() - next_index;
+  void parse_array_argument(std::string_view name, std::array<T, N> &result) {
+    const auto arguments_left = arguments.size();
     if (arguments_left == 0 || arguments_left < N) {
-      throw structopt::exception("Error: expected " + std::to_string(N) +
-                                     " values for std::array argument `" + std::string(name) +
-                                     "` - instead got only " +
-                                     std::to_string(arguments_left) + " arguments.",
-                                 visitor);
+      auto &error = fail(error_detail::array_argument_missing, name);
+      error.expected_ = N;
+      error.provided_ = arguments_left;
+      return;
     }
 
-    for (std::size_t i = 0; i < N; i++) {
-      auto [value, success] = parse_argument<T>(name);
-      if (success) {
-        result[i] = value;
-      }
+    for (std::size_t i = 0; i < N && !failed(); i++) {
+      parse_argument(name, result[i]);
     }
-    return result;
   }
 
   template <class Tuple, class F, std::size_t... I>
@@ -472,396 +454,811 @@ struct parser {
                              std::tuple_size<std::remove_reference_t<Tuple>>::value>{});
   }
 
+  // Checks if `next` marks the end of a container argument, e.g., `--verbose`, `--`
+  bool is_end_of_container(std::string_view next) {
+    if (literal_values) {
+      // e.g., `files = ["--", "--verbose"]` in a config file
+      return false;
+    }
+    const auto kind = classify_token(next);
+    if (kind == token_kind::literal || kind == token_kind::number) {
+      // a value - no need to look up fields
+      return false;
+    }
+    return is_optional_field(next) || next == "--" ||
+           is_delimited_optional_argument(next).first;
+  }
+
+  // Containers of strings at least this long are converted on `num_threads` threads
+  static constexpr std::size_t parallel_conversion_threshold = 1 << 16;
+
+  // Number of tokens, starting at the cursor, before the end of a container argument
+  // Used to reserve capacity up front; each token is classified once more
+  std::size_t count_container_values() {
+    const auto size = arguments.size();
+    std::size_t result = 0;
+    while (result < size && !is_end_of_container(arguments.peek(result))) {
+      result += 1;
+    }
+    return result;
+  }
+
+  // `-` among the values of a container, with record input enabled
+  bool is_record_input(std::string_view next) const {
+    return records != nullptr && !literal_values && next == "-";
+  }
+
+  // Pass every record of the input to `on_record`
+  template <typename F> void read_records(std::string_view name, F &&on_record) {
+    while (!failed()) {
+      const auto record = records->next();
+      if (!record.has_value()) {
+        break;
+      }
+      on_record(record.value());
+    }
+    if (!failed() && records->failed()) {
+      fail(error_detail::record_input_failed, name);
+    }
+  }
+
+  // Parse the values of a container, from the cursor till the end of the container
+  //
+  // `parse_value` parses the next token into one element of type `V`. A `-` is
+  // replaced by the records of the input, if enabled: every record becomes the next
+  // token, so records are converted exactly like arguments
+  template <typename V, typename F>
+  void parse_container_values(std::string_view name, F &&parse_value) {
+    while (!arguments.empty() && !failed()) {
+      const std::string_view next = arguments.peek();
+      if (is_end_of_container(next)) {
+        if (next == "--") {
+          double_dash_encountered = true;
+          arguments.advance();
+        }
+        // this marks the end of the container (break here)
+        break;
+      }
+      if constexpr (is_single_token_value<V>::value) {
+        if (is_record_input(next)) {
+          arguments.advance();
+          read_records(name, [&](std::string_view record) {
+            arguments.push_front(record);
+            parse_value();
+          });
+          continue;
+        }
+      }
+      parse_value();
+    }
+  }
+
   // Parse single tuple element
   template <typename T>
   void parse_tuple_element(std::string_view name, std::size_t index, std::size_t size,
-                           T &&result) {
-    auto [value, success] = parse_argument<typename std::remove_reference<T>::type>(name);
-    if (success) {
-      result = value;
-    } else {
-      if (next_index == arguments.size()) {
+                           T &result) {
+    if (failed()) {
+      return;
+    }
+    if (!parse_argument(name, result)) {
+      if (arguments.empty()) {
         // end of arguments list
         // failed to parse tuple <>. expected `size` arguments, `index` provided
-        throw structopt::exception("Error: failed to correctly parse tuple `" +
-                                       std::string{name} + "`. Expected " +
-                                       std::to_string(size) + " arguments, " +
-                                       std::to_string(index) + " provided.",
-                                   visitor);
+        auto &error = fail(error_detail::tuple_argument_missing, name);
+        error.expected_ = size;
+        error.provided_ = index;
       } else {
-        throw structopt::exception("Error: failed to correctly parse tuple `" +
-                                       std::string{name} +
-                                       "` {size = " + std::to_string(size) +
-                                       "} at index " + std::to_string(index) + ".",
-                                   visitor);
+        auto &error = fail(error_detail::tuple_element_invalid, name);
+        error.expected_ = size;
+        error.provided_ = index;
       }
     }
   }
 
   // Tuple argument
-  template <typename Tuple> Tuple parse_tuple_argument(std::string_view name) {
-    Tuple result;
+  template <typename Tuple>
+  void parse_tuple_argument(std::string_view name, Tuple &result) {
     std::size_t i = 0;
     constexpr auto tuple_size = std::tuple_size<Tuple>::value;
     for_each(result, [&](auto &&arg) {
       parse_tuple_element(name, i, tuple_size, arg);
       i += 1;
     });
-    return result;
   }
 
   // Vector, deque, list
-  template <typename T> T parse_vector_like_argument(std::string_view name) {
-    T result;
-
-    // Parse from current till end
-    while (next_index < arguments.size()) {
-      const std::string_view next = arguments[next_index];
-      if (is_optional_field(next) || next == "--" ||
-          is_delimited_optional_argument(next).first) {
-        if (next == "--") {
-          double_dash_encountered = true;
-          next_index += 1;
-        }
-        // this marks the end of the container (break here)
-        break;
-      }
-      auto [value, success] = parse_argument<typename T::value_type>(name);
-      if (success) {
-        result.push_back(value);
+  template <typename T>
+  void parse_vector_like_argument(std::string_view name, T &result) {
+    result.clear();
+    if constexpr (std::is_same<T, std::vector<std::string>>::value) {
+      const auto count = count_container_values();
+      if (count >= parallel_conversion_threshold && records == nullptr &&
+          resolve_thread_count(num_threads) > 1) {
+        // e.g., a file list read from a large response file
+        // the strings are independent - copy them on several threads
+        constexpr std::size_t block_size = 4096;
+        result.resize(count);
+        parallel_for((count + block_size - 1) / block_size, num_threads,
+                     [&](std::size_t block) {
+                       const auto last = std::min(count, (block + 1) * block_size);
+                       for (auto i = block * block_size; i < last; i++) {
+                         result[i].assign(arguments.peek(i));
+                       }
+                     });
+        arguments.advance(count);
+      } else {
+        result.reserve(count);
       }
+    } else if constexpr (structopt::is_specialization<T, std::vector>::value &&
+                         is_single_token_value<typename T::value_type>::value) {
+      result.reserve(count_container_values());
     }
-    return result;
-  }
 
-  // stack, queue, priority_queue
-  template <typename T> T parse_container_adapter_argument(std::string_view name) {
-    T result;
-    // Parse from current till end
-    while (next_index < arguments.size()) {
-      const std::string_view next = arguments[next_index];
-      if (is_optional_field(next) || next == "--" ||
-          is_delimited_optional_argument(next).first) {
-        if (next == "--") {
-          double_dash_encountered = true;
-          next_index += 1;
+    parse_container_values<typename T::value_type>(name, [&] {
+      if constexpr (std::is_same<typename T::value_type, bool>::value) {
+        // std::vector<bool> has no bool& to parse into
+        bool value;
+        if (parse_argument(name, value)) {
+          result.push_back(value);
+        }
+      } else {
+        // construct the element in place
+        if (!parse_argument(name, result.emplace_back())) {
+          result.pop_back();
         }
-        // this marks the end of the container (break here)
-        break;
       }
-      auto [value, success] = parse_argument<typename T::value_type>(name);
-      if (success) {
-        result.push(value);
+    });
+  }
+
+  // stack, queue, priority_queue
+  template <typename T>
+  void parse_container_adapter_argument(std::string_view name, T &result) {
+    result = T();
+    parse_container_values<typename T::value_type>(name, [&] {
+      typename T::value_type value;
+      if (parse_argument(name, value)) {
+        result.push(std::move(value));
       }
-    }
-    return result;
+    });
   }
 
   // Set, multiset, unordered_set, unordered_multiset
-  template <typename T> T parse_set_argument(std::string_view name) {
-    T result;
-    // Parse from current till end
-    while (next_index < arguments.size()) {
-      const std::string_view next = arguments[next_index];
-      if (is_optional_field(next) || next == "--" ||
-          is_delimited_optional_argument(next).first) {
-        if (next == "--") {
-          double_dash_encountered = true;
-          next_index += 1;
+  template <typename T> void parse_set_argument(std::string_view name, T &result) {
+    result.clear();
+    if constexpr (structopt::is_specialization<T, std::unordered_set>::value ||
+                  structopt::is_specialization<T, std::unordered_multiset>::value) {
+      result.reserve(count_container_values());
+    }
+    parse_container_values<typename T::value_type>(name, [&] {
+      typename T::value_type value;
+      if (parse_argument(name, value)) {
+        result.insert(std::move(value));
+      }
+    });
+  }
+
+  // structopt::stream - every value goes to the sink as soon as it is parsed
+  template <typename T>
+  void parse_stream_argument(std::string_view name, stream<T> &result) {
+    result.size_ = 0;
+    T value{};
+    parse_container_values<T>(name, [&] {
+      if (parse_argument(name, value) && !failed()) {
+        result.size_ += 1;
+        if (result.sink_) {
+          result.sink_(std::move(value));
         }
-        // this marks the end of the container (break here)
-        break;
       }
-      auto [value, success] = parse_argument<typename T::value_type>(name);
-      if (success) {
-        result.insert(value);
+    });
+  }
+
+  // structopt::lazy_vector - only the text of the values is stored
+  template <typename T>
+  void parse_lazy_vector_argument(std::string_view name, lazy_vector<T> &result) {
+    result = lazy_vector<T>();
+    result.name_ = name;
+    const auto count = count_container_values();
+    std::size_t text_size = 0;
+    for (std::size_t i = 0; i < count; i++) {
+      text_size += arguments.peek(i).size();
+    }
+    result.reserve(count, text_size);
+    for (std::size_t i = 0; i < count && !failed(); i++) {
+      if (is_record_input(arguments.peek())) {
+        // the text of the records is copied like the text of the tokens
+        arguments.advance();
+        read_records(name, [&](std::string_view record) { result.push_back(record); });
+      } else {
+        result.push_back(arguments.peek());
+        arguments.advance();
       }
     }
-    return result;
+    if (failed()) {
+      return;
+    }
+
+    if (!arguments.empty() && arguments.peek() == "--") {
+      // this marks the end of the container
+      double_dash_encountered = true;
+      arguments.advance();
+    }
   }
 
   // Enum class
-  template <typename T> T parse_enum_argument(std::string_view name) {
-    T result;
-    auto maybe_enum_value = magic_enum::enum_cast<T>(arguments[next_index]);
+  template <typename T> void parse_enum_argument(std::string_view name, T &result) {
+    auto maybe_enum_value = magic_enum::enum_cast<T>(arguments.peek());
     if (maybe_enum_value.has_value()) {
       result = maybe_enum_value.value();
     } else {
-      constexpr auto allowed_names = magic_enum::enum_names<T>();
+      fail(error_detail::enum_argument_invalid, name).allowed_values_ =
+          &allowed_enum_values<T>;
+    }
+  }
 
-      std::string allowed_names_string = "";
-      if (allowed_names.size()) {
-        for (size_t i = 0; i < allowed_names.size() - 1; i++) {
-          allowed_names_string += std::string{allowed_names[i]} + ", ";
-        }
-        allowed_names_string += allowed_names[allowed_names.size() - 1];
+  // e.g., "RED, GREEN, BLUE"; only formatted for error messages
+  template <typename T> static std::string allowed_enum_values() {
+    constexpr auto allowed_names = magic_enum::enum_names<T>();
+
+    std::string allowed_names_string = "";
+    if (allowed_names.size()) {
+      for (size_t i = 0; i < allowed_names.size() - 1; i++) {
+        allowed_names_string += std::string{allowed_names[i]} + ", ";
+      }
+      allowed_names_string += allowed_names[allowed_names.size() - 1];
+    }
+    return allowed_names_string;
+  }
+
+  // Parse the fields of `argument_struct` in a single pass over `arguments`
+  //
+  // Every token, starting at the cursor, is inspected exactly once and routed
+  // to the field it belongs to. Parsing stops at the end of the argument list or
+  // at the first token that does not belong to this struct - the caller (e.g., the
+  // parser of an enclosing struct) decides what to do with it
+  template <typename T> void parse_struct(T &argument_struct) {
+    visitor = &schema<T>();
+    fields = &field_table_of<T>::value;
+
+    while (!arguments.empty() && !failed()) {
+      const auto position = arguments.position();
+      const std::string_view next = arguments.peek();
+
+      // after `--`, every token is a positional argument
+      const auto kind =
+          double_dash_encountered ? token_kind::literal : classify_token(next);
+      notify(parse_event_kind::token_classified, {}, 0, kind);
+      if (kind == token_kind::double_dash) {
+        double_dash_encountered = true;
+        arguments.advance();
+        continue;
+      }
+
+      const bool consumed = kind == token_kind::literal || kind == token_kind::number
+                                ? parse_positional_token(argument_struct, next)
+                                : parse_optional_token(argument_struct, next, kind);
+      if (!consumed || arguments.position() == position) {
+        break;
       }
+    }
+  }
 
-      throw structopt::exception(
-          "Error: unexpected input `" + std::string{arguments[next_index]} +
-              "` provided for enum argument `" + std::string{name} +
-              "`. Allowed values are {" + allowed_names_string + "}",
-          visitor);
-      // TODO: Throw error invalid enum option
+  // Find the index of the optional (or flag) field that `next` refers to, if any
+  //
+  // If both the long and the short form match, the field declared first wins,
+  // e.g., with fields `value` and `v`, `-v` maps to `value`
+  std::optional<std::size_t> find_optional_field(std::string_view next) {
+    auto result = fields->find_long(next);
+    if (result != no_field && !fields->is_flag_or_option(result)) {
+      result = no_field;
+    }
+    result = (std::min)(result, fields->find_short(next, fields->short_flag_or_option));
+    if (result == no_field) {
+      return std::nullopt;
     }
     return result;
   }
 
-  // Visitor function for nested struct
+  // Find the index of the nested struct (sub-command) field named `next`, if any
+  std::optional<std::size_t> find_nested_struct_field(std::string_view next) {
+    const auto index = fields->find(next);
+    if (index != no_field && fields->kinds[index] == field_kind::nested_struct &&
+        fields->names[index] == next) {
+      return index;
+    }
+    return std::nullopt;
+  }
+
+  // Find the index of the positional field named `field_name`
+  std::optional<std::size_t> find_positional_field(std::string_view field_name) {
+    const auto index = fields->find(field_name);
+    if (index != no_field && fields->kinds[index] == field_kind::positional) {
+      return index;
+    }
+    return std::nullopt;
+  }
+
+  // `next` looks like an optional argument, i.e., starts with `-` or `--`
   template <typename T>
-  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, void>::type
-  operator()(std::string_view name, T &value) {
-    if (next_index > current_index) {
-      current_index = next_index;
+  bool parse_optional_token(T &argument_struct, std::string_view next, token_kind kind) {
+    // see if there is an optional field in the struct with a matching name
+    if (const auto field = find_optional_field(next); field.has_value()) {
+      return parse_field_at(argument_struct, field.value());
     }
 
-    if (current_index < arguments.size()) {
-      const auto next = arguments[current_index];
-      const auto field_name = std::string_view{name};
+    // maybe this is an optional argument that is delimited with '=' or ':'
+    // e.g., --foo=bar or --foo:BAR
+    if (kind == token_kind::delimited_option) {
+      const auto [success, delimiter] = is_delimited_optional_argument(next);
+      if (success) {
+        const auto [lhs, rhs] = split_delimited_argument(delimiter, next);
+
+        // get past the current argument, e.g., `--foo=bar`
+        arguments.advance();
+
+        // if `lhs` is an optional argument (i.e., maps to an optional field in the
+        // original struct), then queue `lhs` and `rhs` as the next two tokens
+        // the parser will take care of the rest
+        auto potential_field_name = get_full_optional_field_name(lhs);
+        if (potential_field_name.has_value()) {
+          arguments.push_front(rhs);
+          arguments.push_front(lhs);
+        }
+        return true;
+      }
+    }
 
-      // Check if `next` is the start of a subcommand
-      if (visitor.is_field_name(next) && next == field_name) {
-        next_index += 1;
-        value = parse_nested_struct<T>(name);
+    // This _could_ be a combined argument
+    // e.g., -abc => -a, -b, and -c where each of these is a flag argument
+    if (parse_combined_argument(next)) {
+      return true;
+    }
+
+    // `help` and `version` are checked last so that user-defined fields,
+    // e.g., `verbose`, take precedence over their short forms
+    if (parse_help_or_version(next)) {
+      return true;
+    }
+
+    // Any other option followed by a value is a value of the positional container
+    // waiting for values, as it would be after the container's first value, e.g.,
+    // `--foo` in `./main --foo bar` with a field `std::vector<std::string> files`
+    if (is_waiting_for_container() && has_container_value()) {
+      return parse_positional_token(argument_struct, next);
+    }
+    return false;
+  }
+
+  // The next positional field is a container, e.g., a std::vector
+  bool is_waiting_for_container() const {
+    if (positional_index >= visitor->positional_field_names.size()) {
+      return false;
+    }
+    const auto &containers = visitor->vector_like_positional_field_names;
+    return std::find(containers.begin(), containers.end(),
+                     visitor->positional_field_names[positional_index]) !=
+           containers.end();
+  }
+
+  // A value, i.e., not an option, follows the cursor before the end of the container
+  bool has_container_value() {
+    for (std::size_t i = 1; i < arguments.size(); i++) {
+      const auto next = arguments.peek(i);
+      if (is_end_of_container(next)) {
+        return false;
       }
+      const auto kind = classify_token(next);
+      if (kind == token_kind::literal || kind == token_kind::number) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool parse_combined_argument(std::string_view next) {
+    if (is_optional_field(next) || next[0] != '-' || next.size() < 2 || next[1] == '-') {
+      return false;
+    }
+
+    // e.g., `-abc` => `abc`
+    const auto potential_combined_argument = next.substr(1);
+
+    // Every element of the combined argument must be a known field
+    // and at least one of them must be an optional field
+    bool optional_field_matched = false;
+    for (auto c : potential_combined_argument) {
+      const auto arg = short_option_token(c);
+      if (!is_optional_field(arg)) {
+        // TODO: report error unrecognized option in combined argument
+        return false;
+      }
+      if (find_optional_field(arg).has_value()) {
+        optional_field_matched = true;
+      }
+    }
+
+    if (!optional_field_matched) {
+      return false;
     }
+
+    // confirmed: this is a combined argument
+
+    // get past the current combined argument
+    arguments.advance();
+
+    // queue the individual options that make up the combined argument
+    // e.g., "./main -abc" is read as "./main -a -b -c"
+    // so that the parser loop will service `-a`, `-b` and `-c` like any other
+    // optional arguments (flags and otherwise)
+    for (auto it = potential_combined_argument.rbegin();
+         it != potential_combined_argument.rend(); ++it) {
+      arguments.push_front(short_option_token(*it));
+    }
+    return true;
+  }
+
+  // `-h`/`--help` and `-v`/`--version` are added to every struct
+  bool parse_help_or_version(std::string_view next) {
+    if (is_optional_field(next, "help")) {
+      // if help is requested, stop here
+      // app::parse prints help and exits
+      fail(error_detail::help_requested, "help");
+      return true;
+    } else if (is_optional_field(next, "version")) {
+      // if version is requested, stop here
+      // app::parse prints the version and exits
+      fail(error_detail::version_requested, "version").version_ = version;
+      return true;
+    }
+    return false;
   }
 
-  // Visitor function for any positional field (not std::optional)
+  // `next` is a positional argument or the name of a sub-command
   template <typename T>
-  inline typename std::enable_if<!structopt::is_specialization<T, std::optional>::value &&
-                                     !visit_struct::traits::is_visitable<T>::value,
-                                 void>::type
-  operator()(std::string_view name, T &result) {
-    if (next_index > current_index) {
-      current_index = next_index;
+  bool parse_positional_token(T &argument_struct, std::string_view next) {
+    const auto nested_struct_field = find_nested_struct_field(next);
+
+    std::optional<std::size_t> positional_field;
+    if (positional_index < visitor->positional_field_names.size()) {
+      positional_field =
+          find_positional_field(visitor->positional_field_names[positional_index]);
     }
 
-    if (current_index < arguments.size()) {
-      const auto next = arguments[current_index];
+    // If `next` names a sub-command, it is parsed as one unless a positional field
+    // declared before the sub-command is still waiting for a value
+    if (nested_struct_field.has_value() &&
+        (!positional_field.has_value() ||
+         nested_struct_field.value() < positional_field.value())) {
+      return parse_field_at(argument_struct, nested_struct_field.value());
+    }
 
-      if (is_optional(next)) {
-        return;
+    if (!positional_field.has_value()) {
+      // We're not looking to save any more positional fields
+      // all of them already have a value
+      return false;
+    }
+
+    if (!parse_field_at(argument_struct, positional_field.value())) {
+      // positional field does not yet have a value
+      return false;
+    }
+
+    // Move on to the next positional field
+    positional_index += 1;
+    return true;
+  }
+
+  // Optional fields of `argument_struct` that were not given in the arguments take
+  // the value of their environment variable, if it is set
+  //
+  // The value is parsed like the value of the option, e.g., `APP_VERBOSE=on` for a
+  // flag `verbose`. `environ` is scanned once, and not at all if no field has a
+  // variable
+  template <typename T>
+  void parse_environment(T &argument_struct, const environment_options &options,
+                         char **entries) {
+    if (entries == nullptr || *entries == nullptr) {
+      return;
+    }
+    const auto &table = field_table_of<T>::value;
+    field_set wanted;
+    for (std::size_t i = 0; i < table.size; i++) {
+      wanted[i] = table.is_flag_or_option(static_cast<field_index_t>(i)) &&
+                  (given_options == nullptr || !(*given_options)[i]);
+    }
+    const environment variables(table, environment_names_of<T>(), options, wanted,
+                                entries);
+    for (std::size_t i = 0; i < table.size && !failed(); i++) {
+      if (const auto variable = variables.value(i)) {
+        // the value is the next, and only, token
+        arguments.push_front(variable.value());
+        const auto &field = field_accessor_at<T>(i);
+        field.parse_setting(*this, argument_struct, field.pointer, table.names[i], nullptr,
+                            1);
       }
+    }
+  }
 
-      if (visitor.positional_field_names.empty()) {
-        // We're not looking to save any more positional fields
-        // all of them already have a value
-        throw structopt::exception("Error: unexpected argument '" + next + "'", visitor);
-        return;
+  // Fill `argument_struct` from table `table` of the settings of a source, e.g., a
+  // config file, and its subtables
+  //
+  // Keys name optional fields and subtables name nested structs, as options and
+  // sub-commands do in the arguments; a subtable does not invoke its sub-command.
+  // Values are parsed like the values of options, and a flag takes its value, e.g.,
+  // `verbose = true`, instead of being toggled
+  template <typename T>
+  void parse_config_table(T &argument_struct, const settings &config,
+                          std::size_t table) {
+    const auto outer_visitor = visitor;
+    const auto outer_fields = fields;
+    visitor = &schema<T>();
+    fields = &field_table_of<T>::value;
+
+    const auto [first, last] = config.entries_of(table);
+    for (auto entry = first; entry != last && !failed(); ++entry) {
+      bool known = false;
+      find_config_fields<T>(config, entry->key, [&](std::size_t index) {
+        if (failed() || !fields->is_flag_or_option(index)) {
+          return;
+        }
+        known = true;
+        // the values are the next tokens
+        for (auto i = entry->last_value; i > entry->first_value; i--) {
+          arguments.push_front(config.values[i - 1]);
+        }
+        const auto &field = field_accessor_at<T>(index);
+        field.parse_setting(*this, argument_struct, field.pointer, fields->names[index],
+                            &config, entry->last_value - entry->first_value);
+        if (!failed() && !arguments.empty()) {
+          fail(error_detail::config_too_many_values, fields->names[index]);
+        }
+        arguments.advance(arguments.size());
+      });
+      if (!known && !failed() && !config.ignore_unknown_keys) {
+        fail(error_detail::config_key_unknown).token_ = entry->key;
+      }
+      locate_config_failure(config, entry->line);
+    }
+
+    for (std::size_t child = 1; child < config.tables.size() && !failed(); child++) {
+      if (config.tables[child].parent != table) {
+        continue;
       }
+      bool known = false;
+      find_config_fields<T>(config, config.tables[child].name, [&](std::size_t index) {
+        if (failed() || fields->kinds[index] != field_kind::nested_struct) {
+          return;
+        }
+        known = true;
+        const auto &field = field_accessor_at<T>(index);
+        field.parse_setting(*this, argument_struct, field.pointer, fields->names[index],
+                            &config, child);
+      });
+      if (!known && !failed() && !config.ignore_unknown_keys) {
+        fail(error_detail::config_key_unknown).token_ = config.tables[child].name;
+        locate_config_failure(config, 0);
+      }
+    }
 
-      const auto field_name = visitor.positional_field_names.front();
+    visitor = outer_visitor;
+    fields = outer_fields;
+  }
 
-      // // This will be parsed as a subcommand (nested struct)
-      // if (visitor.is_field_name(next) && next == field_name) {
-      //   return;
-      // }
+  // Calls `f(index)` for every field of `T` that `key` of `config` names: with the
+  // kebab-case rules of options or, for environment variables, the name env_prefix
+  // reads, e.g., `LOG_LEVEL` for `log_level`
+  template <typename T, typename F>
+  void find_config_fields(const settings &config, std::string_view key, F &&f) {
+    if (config.environment_keys) {
+      environment_names_of<T>().find(key, f);
+    } else if (const auto index = fields->find(key); index != no_field) {
+      f(index);
+    }
+  }
 
-      if (field_name != std::string{name}) {
-        // current field is not the one we want to parse
-        return;
-      }
+  // Errors in a source are reported with its origin and the line of the entry
+  void locate_config_failure(const settings &config, std::size_t line) {
+    if (failed() && failure->source_.empty()) {
+      failure->source_ = config.origin;
+      failure->line_ = line;
+      failure->token_index_ = 0;
+    }
+  }
 
-      // Remove from the positional field list as it is about to be parsed
-      visitor.positional_field_names.pop_front();
+  // A setting, e.g., of a config file or the environment: `item` is the table of a
+  // nested struct in `config`, or the number of values of an option in the tokens
+  template <typename T>
+  void parse_setting(std::string_view name, T &value, const settings *config,
+                     std::size_t item) {
+    if constexpr (visit_struct::traits::is_visitable<T>::value) {
+      parse_config_table(value, *config, item);
+    } else if constexpr (structopt::is_specialization<T, std::optional>::value) {
+      // a setting is never an option, nor `--`, nor `-` for the records of the input
+      const bool outer_literal_values = literal_values;
+      literal_values = true;
+      if (item == 0) {
+        // e.g., `tags = []`
+        if constexpr (is_stl_container<typename T::value_type>::value) {
+          value.emplace();
+        } else {
+          fail(error_detail::optional_argument_missing, name);
+        }
+      } else if (!parse_argument(name, value.emplace())) {
+        value.reset();
+        fail(error_detail::optional_argument_invalid, name);
+      }
+      literal_values = outer_literal_values;
+    }
+  }
 
-      auto [value, success] = parse_argument<T>(field_name);
-      if (success) {
-        result = value;
-      } else {
-        // positional field does not yet have a value
-        visitor.positional_field_names.push_front(field_name);
+  // Throws if a positional field did not receive a value
+  void check_positional_fields() {
+    // if all positional arguments were provided
+    // there would be no fields left to check
+    for (auto i = positional_index; i < visitor->positional_field_names.size(); i++) {
+      const auto field_name = visitor->positional_field_names[i];
+      if (std::find(visitor->vector_like_positional_field_names.begin(),
+                    visitor->vector_like_positional_field_names.end(),
+                    field_name) == visitor->vector_like_positional_field_names.end()) {
+        // this positional argument is not a vector-like argument
+        // it expects value(s)
+        fail(error_detail::positional_argument_missing, field_name);
+        return;
       }
     }
   }
 
-  // Visitor function for std::optional field
+  // A field of `T`, with its type erased: a pointer to the member, and the parsers of
+  // its type. The parsers are instantiated once per field type rather than once per
+  // field, e.g., 64 std::optional<int> fields share them
+  template <typename T> struct field_accessor {
+    using member = char T::*;
+    bool (*parse)(parser &, T &, member, std::string_view);
+    // see parse_setting
+    void (*parse_setting)(parser &, T &, member, std::string_view, const settings *,
+                          std::size_t);
+    member pointer; // converted back to `F T::*` by the parsers
+  };
+
+  template <typename T, typename F>
+  static bool parse_member(parser &self, T &s, char T::*member, std::string_view name) {
+    return self.parse_field(name, s.*reinterpret_cast<F T::*>(member));
+  }
+
+  template <typename T, typename F>
+  static void parse_setting_member(parser &self, T &s, char T::*member,
+                                   std::string_view name, const settings *config,
+                                   std::size_t item) {
+    self.parse_setting(name, s.*reinterpret_cast<F T::*>(member), config, item);
+  }
+
+  template <typename T, auto... Pointers>
+  static std::array<field_accessor<T>, sizeof...(Pointers)>
+  make_field_accessors(visit_struct::member_list<nullptr, Pointers...>) {
+    return {{{&parse_member<T, visit_struct::member_type_t<decltype(Pointers)>>,
+              &parse_setting_member<T, visit_struct::member_type_t<decltype(Pointers)>>,
+              reinterpret_cast<char T::*>(
+                  static_cast<visit_struct::member_type_t<decltype(Pointers)> T::*>(
+                      Pointers))}...}};
+  }
+
   template <typename T>
-  inline typename std::enable_if<structopt::is_specialization<T, std::optional>::value,
-                                 void>::type
-  operator()(std::string_view name, T &value) {
-    if (next_index > current_index) {
-      current_index = next_index;
+  static const field_accessor<T> &field_accessor_at(std::size_t index) {
+    static const auto accessors = make_field_accessors<T>(visit_struct::members<T>{});
+    return accessors[index];
+  }
+
+  // Parse the field at (runtime) index `index` of `T`
+  // This is a constant-time table lookup - no iteration over the struct fields
+  template <typename T> bool parse_field_at(T &argument_struct, std::size_t index) {
+    const auto &field = field_accessor_at<T>(index);
+    const auto name = field_table_of<T>::value.names[index];
+    // only set in the parser of the top-level struct; sub-commands have their own
+    if (given_options != nullptr) {
+      given_options->set(index);
+    }
+#if STRUCTOPT_OBSERVERS
+    if (events != nullptr) {
+      notify(parse_event_kind::field_matched, name);
+      const auto tokens_left = arguments.size();
+      const bool result = field.parse(*this, argument_struct, field.pointer, name);
+      const auto tokens = (std::max)(tokens_left, arguments.size()) - arguments.size();
+      notify(parse_event_kind::value_converted, name, tokens);
+      return result;
     }
+#endif
+    return field.parse(*this, argument_struct, field.pointer, name);
+  }
 
-    if (current_index < arguments.size()) {
-      const auto next = arguments[current_index];
-      const auto field_name = std::string{name};
+  // Nested struct
+  template <typename T>
+  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, bool>::type
+  parse_field(std::string_view name, T &value) {
+    if (sub_command_invoked) {
+      // a sub-command has already been invoked
+      // the offending token is the name of this one
+      fail_sub_command_conflict<T>(name);
+      return true;
+    }
+    arguments.advance();
+    parse_nested_struct(name, value);
+    return true;
+  }
 
-      if (next == "--" && double_dash_encountered == false) {
-        double_dash_encountered = true;
-        next_index += 1;
-        return;
-      }
+  // Any positional field (not std::optional)
+  template <typename T>
+  inline typename std::enable_if<!structopt::is_specialization<T, std::optional>::value &&
+                                     !visit_struct::traits::is_visitable<T>::value,
+                                 bool>::type
+  parse_field(std::string_view name, T &result) {
+    return parse_argument(name, result);
+  }
 
-      // if `next` looks like an optional argument
-      // i.e., starts with `-` or `--`
-      // see if you can find an optional field in the struct with a matching name
-
-      // check if the current argument looks like it could be this optional field
-      if (double_dash_encountered == false && is_optional_field(next, field_name)) {
-
-        // this is an optional argument matching the current struct field
-        if constexpr (std::is_same<typename T::value_type, bool>::value) {
-          // It is a boolean optional argument
-          // Does it have a default value?
-          // If yes, this is a FLAG argument, e.g,, "--verbose" will set it to true if the
-          // default value is false No need to write "--verbose true"
-          if (value.has_value()) {
-            // The field already has a default value!
-            value = !value.value(); // simply toggle it
-            next_index += 1;
-          } else {
-            // boolean optional argument doesn't have a default value
-            // expect one
-            value = parse_optional_argument<typename T::value_type>(name);
-          }
-        } else {
-          // Not std::optional<bool>
-          // Parse the argument type <T>
-          value = parse_optional_argument<typename T::value_type>(name);
-        }
+  // std::optional field
+  template <typename T>
+  inline typename std::enable_if<structopt::is_specialization<T, std::optional>::value,
+                                 bool>::type
+  parse_field(std::string_view name, T &value) {
+    // this is an optional argument matching the current struct field
+    if constexpr (std::is_same<typename T::value_type, bool>::value) {
+      // It is a boolean optional argument
+      // Does it have a default value?
+      // If yes, this is a FLAG argument, e.g,, "--verbose" will set it to true if the
+      // default value is false No need to write "--verbose true"
+      if (value.has_value()) {
+        // The field already has a default value!
+        value = !value.value(); // simply toggle it
+        arguments.advance();
       } else {
-        if (double_dash_encountered == false) {
-
-          // maybe this is an optional argument that is delimited with '=' or ':'
-          // e.g., --foo=bar or --foo:BAR
-          if (next.size() > 1 && next[0] == '-') {
-            const auto [success, delimiter] = is_delimited_optional_argument(next);
-            if (success) {
-              const auto [lhs, rhs] = split_delimited_argument(delimiter, next);
-              // update next_index and return
-              // the parser will take care of the rest
-
-              // if `lhs` is an optional argument (i.e., maps to an optional field in the original struct), then insert into arguments list
-              auto potential_field_name = get_full_optional_field_name(lhs);
-              if (potential_field_name.has_value()) {
-                for (auto &arg : {rhs, lhs}) {
-                  const auto begin = arguments.begin();
-                  arguments.insert(begin + next_index + 1, arg);
-                }
-              }
-              // get past the current argument, e.g., `--foo=bar`
-              next_index += 1;
-              return;
-            }
-          }
-
-          // A direct match of optional argument with field_name has not happened
-          // This _could_ be a combined argument
-          // e.g., -abc => -a, -b, and -c where each of these is a flag argument
-
-          std::vector<std::string> potential_combined_argument;
-
-          if (is_optional_field(next) == false && next[0] == '-' &&
-              (next.size() > 1 && next[1] != '-')) {
-            for (std::size_t i = 1; i < next.size(); i++) {
-              potential_combined_argument.push_back("-" + std::string(1, next[i]));
-            }
-          }
-
-          if (!potential_combined_argument.empty()) {
-            bool is_combined_argument = true;
-            for (auto &arg : potential_combined_argument) {
-              if (!is_optional_field(arg)) {
-                is_combined_argument = false;
-                // TODO: report error unrecognized option in combined argument
-              }
-            }
-
-            if (is_combined_argument) {
-
-              // check and make sure the current field_name is
-              // in `potential_combined_argument`
-              //
-              // Let's say the argument `next` is `-abc`
-              // the current field name is `b`
-              // 1. Split `-abc` into `-a`, `-b`, and `-c`
-              // 2. Check if `-b` is in the above list
-              //    1. If yes, consider this as a combined argument
-              //       push the list of arguments (split up) into `arguments`
-              //    2. If no, nothing to do here
-              bool field_name_matched = false;
-              for (auto &arg : potential_combined_argument) {
-                if (arg == "-" + std::string(1, field_name[0])) {
-                  field_name_matched = true;
-                }
-              }
-
-              if (field_name_matched) {
-                // confirmed: this is a combined argument
-
-                // insert the individual options that make up the combined argument
-                // right after the combined argument
-                // e.g., ""./main -abc" becomes "./main -abc -a -b -c"
-                // Once this is done, increment `next_index` so that the parser loop will
-                // service
-                // `-a`, `-b` and `-c` like any other optional arguments (flags and
-                // otherwise)
-                for (std::vector<std::string>::reverse_iterator it =
-                         potential_combined_argument.rbegin();
-                     it != potential_combined_argument.rend(); ++it) {
-                  auto &arg = *it;
-                  if (next_index < arguments.size()) {
-                    auto begin = arguments.begin();
-                    arguments.insert(begin + next_index + 1, arg);
-                  } else {
-                    arguments.push_back(arg);
-                  }
-                }
-
-                // get past the current combined argument
-                next_index += 1;
-              }
-            }
-          }
-        }
+        // boolean optional argument doesn't have a default value
+        // expect one
+        parse_optional_argument(name, value);
       }
+    } else {
+      // Not std::optional<bool>
+      // Parse the argument type <T>
+      parse_optional_argument(name, value);
     }
+    return true;
   }
 };
 
 // Specialization for std::string
-template <> inline std::string parser::parse_single_argument<std::string>(std::string_view) {
-  return arguments[next_index];
+template <>
+inline void parser::parse_single_argument<std::string>(std::string_view,
+                                                       std::string &result) {
+  result.assign(arguments.peek());
 }
 
 // Specialization for bool
 // yes, YES, on, 1, true, TRUE, etc. = true
 // no, NO, off, 0, false, FALSE, etc. = false
 // Converts argument to lower case before check
-template <> inline bool parser::parse_single_argument<bool>(std::string_view name) {
-  if (next_index > current_index) {
-    current_index = next_index;
-  }
-
-  if (current_index < arguments.size()) {
-    const std::vector<std::string> true_strings{"on", "yes", "1", "true"};
-    const std::vector<std::string> false_strings{"off", "no", "0", "false"};
-    std::string current_argument = arguments[current_index];
-
-    // Convert argument to lower case
-    std::transform(current_argument.begin(), current_argument.end(),
-                   current_argument.begin(),
-                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+template <>
+inline void parser::parse_single_argument<bool>(std::string_view name, bool &result) {
+  if (!arguments.empty()) {
+    static constexpr std::string_view true_strings[]{"on", "yes", "1", "true"};
+    static constexpr std::string_view false_strings[]{"off", "no", "0", "false"};
+    const std::string_view current_argument = arguments.peek();
+
+    // Compare ignoring case
+    const auto matches = [&current_argument](std::string_view s) {
+      return std::equal(current_argument.begin(), current_argument.end(), s.begin(),
+                        s.end(), [](unsigned char c1, unsigned char c2) {
+                          return std::tolower(c1) == c2;
+                        });
+    };
 
     // Detect if argument is true or false
-    if (std::find(true_strings.begin(), true_strings.end(), current_argument) !=
-        true_strings.end()) {
-      return true;
-    } else if (std::find(false_strings.begin(), false_strings.end(), current_argument) !=
-               false_strings.end()) {
-      return false;
+    if (std::any_of(std::begin(true_strings), std::end(true_strings), matches)) {
+      result = true;
+    } else if (std::any_of(std::begin(false_strings), std::end(false_strings), matches)) {
+      result = false;
     } else {
-      throw structopt::exception("Error: failed to parse boolean argument `" +
-                                     std::string{name} + "`." + " `" + current_argument +
-                                     "`" + " is invalid.",
-                                 visitor);
-      return false;
+      fail(error_detail::boolean_argument_invalid, name);
+      result = false;
     }
   } else {
-    return false;
+    result = false;
   }
 }
 
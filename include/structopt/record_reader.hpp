@@ -0,0 +1,117 @@
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace structopt {
+
+namespace details {
+
+// Reads delimited records from a file descriptor, e.g., the output of
+// `find . -print0` or `ls` on stdin
+//
+// The input is read in large blocks into one buffer, and every record is a view into
+// that buffer - no allocation per record. A record is valid until the next call to
+// next(). The buffer holds `buffer_size` bytes, or the longest record if that is
+// longer, however long the input is
+//
+// Empty records are skipped. With '\n' as the delimiter, a trailing '\r' is removed
+class record_reader {
+  int fd_;
+  char delimiter_;
+  std::vector<char> buffer_;
+  std::size_t begin_{0}; // first byte of the next record
+  std::size_t scan_{0};  // bytes before `scan_` have no delimiter
+  std::size_t end_{0};   // end of the data read so far
+  bool end_of_input_{false};
+  bool failed_{false};
+
+  // Read more of the input after the data in the buffer
+  void fill() {
+    if (begin_ > 0) {
+      // drop the records that have been read
+      std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+      scan_ -= begin_;
+      end_ -= begin_;
+      begin_ = 0;
+    }
+    if (end_ == buffer_.size()) {
+      // a record longer than the buffer
+      buffer_.resize(buffer_.size() * 2);
+    }
+    while (true) {
+#ifdef _WIN32
+      const auto count = ::_read(fd_, buffer_.data() + end_,
+                                 static_cast<unsigned>(buffer_.size() - end_));
+#else
+      const auto count = ::read(fd_, buffer_.data() + end_, buffer_.size() - end_);
+#endif
+      if (count > 0) {
+        end_ += static_cast<std::size_t>(count);
+      } else if (count < 0 && errno == EINTR) {
+        continue;
+      } else {
+        end_of_input_ = true;
+        failed_ = count < 0;
+      }
+      return;
+    }
+  }
+
+  std::string_view record(std::size_t first, std::size_t last) const {
+    if (delimiter_ == '\n' && last > first && buffer_[last - 1] == '\r') {
+      last -= 1;
+    }
+    return {buffer_.data() + first, last - first};
+  }
+
+public:
+  record_reader(int fd, char delimiter, std::size_t buffer_size = 1 << 18)
+      : fd_(fd), delimiter_(delimiter), buffer_(buffer_size > 0 ? buffer_size : 1) {}
+
+  // The next record; nothing at the end of the input, or if reading failed
+  std::optional<std::string_view> next() {
+    while (true) {
+      const auto found = static_cast<const char *>(
+          std::memchr(buffer_.data() + scan_, delimiter_, end_ - scan_));
+      if (found) {
+        const auto first = begin_;
+        const auto last = static_cast<std::size_t>(found - buffer_.data());
+        begin_ = scan_ = last + 1;
+        const auto result = record(first, last);
+        if (!result.empty()) {
+          return result;
+        }
+      } else if (!end_of_input_) {
+        scan_ = end_;
+        fill();
+      } else if (begin_ < end_) {
+        // the last record has no delimiter
+        const auto first = begin_;
+        begin_ = scan_ = end_;
+        const auto result = record(first, end_);
+        if (!result.empty()) {
+          return result;
+        }
+      } else {
+        return std::nullopt;
+      }
+    }
+  }
+
+  // Whether reading the input failed, as opposed to reaching its end
+  bool failed() const { return failed_; }
+};
+
+} // namespace details
+
+} // namespace structopt
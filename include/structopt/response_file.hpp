@@ -0,0 +1,415 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <structopt/parallel_for.hpp>
+#include <structopt/token_cursor.hpp>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace structopt {
+
+namespace details {
+
+// Identifies a file independent of the path used to open it
+struct file_id {
+  std::uint64_t device{0};
+  std::uint64_t inode{0};
+
+  bool operator==(const file_id &other) const {
+    return device == other.device && inode == other.inode;
+  }
+};
+
+// A regular file mapped into memory, copy-on-write
+//
+// The mapping is writable, but writes are private: they never reach the file.
+// Only the pages that are written to are copied
+class mapped_file {
+  char *data_{nullptr};
+  std::size_t size_{0};
+  file_id id_;
+  bool is_open_{false};
+
+public:
+  mapped_file() = default;
+
+  // Not open if `path` is not a regular file that can be read
+  explicit mapped_file(const std::string &path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      return;
+    }
+    BY_HANDLE_FILE_INFORMATION info;
+    if (GetFileInformationByHandle(file, &info) &&
+        !(info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+      id_ = {info.dwVolumeSerialNumber,
+             (std::uint64_t(info.nFileIndexHigh) << 32) | info.nFileIndexLow};
+      size_ = static_cast<std::size_t>((std::uint64_t(info.nFileSizeHigh) << 32) |
+                                       info.nFileSizeLow);
+      is_open_ = true;
+      if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping) {
+          data_ = static_cast<char *>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+          CloseHandle(mapping);
+        }
+        if (!data_) {
+          is_open_ = false;
+          size_ = 0;
+        }
+      }
+    }
+    CloseHandle(file);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat status;
+    if (::fstat(fd, &status) == 0 && S_ISREG(status.st_mode)) {
+      id_ = {static_cast<std::uint64_t>(status.st_dev),
+             static_cast<std::uint64_t>(status.st_ino)};
+      size_ = static_cast<std::size_t>(status.st_size);
+      is_open_ = true;
+      if (size_ > 0) {
+        void *data = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+          // read front to back, exactly once
+          ::madvise(data, size_, MADV_SEQUENTIAL);
+          data_ = static_cast<char *>(data);
+        } else {
+          is_open_ = false;
+          size_ = 0;
+        }
+      }
+    }
+    ::close(fd);
+#endif
+  }
+
+  mapped_file(const mapped_file &) = delete;
+  mapped_file &operator=(const mapped_file &) = delete;
+
+  mapped_file(mapped_file &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+        id_(other.id_), is_open_(std::exchange(other.is_open_, false)) {}
+
+  mapped_file &operator=(mapped_file &&other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(id_, other.id_);
+    std::swap(is_open_, other.is_open_);
+    return *this;
+  }
+
+  ~mapped_file() {
+    if (data_) {
+#ifdef _WIN32
+      UnmapViewOfFile(data_);
+#else
+      ::munmap(data_, size_);
+#endif
+    }
+  }
+
+  bool is_open() const { return is_open_; }
+  char *data() const { return data_; }
+  std::size_t size() const { return size_; }
+  const file_id &id() const { return id_; }
+};
+
+inline bool is_response_file_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Splits `[begin, end)` into raw arguments, i.e., with their quotes and escapes, and
+// calls `on_argument(argument_begin, argument_end, is_quoted)` for each, in order
+//
+// Arguments are separated by whitespace. Single or double quotes group whitespace
+// into an argument and a backslash escapes the next character, also inside quotes
+// - the rules of GCC response files. `is_quoted` is true if the argument has quotes
+// or escapes to remove, see unquote_response_file_argument
+//
+// Returns false if `[begin, end)` ends inside quotes or right after a backslash,
+// i.e., if `end` would not end the last argument of a longer file. Nothing is written
+template <typename F>
+bool split_response_file(char *begin, char *end, F &&on_argument) {
+  char *in = begin;
+  while (true) {
+    while (in != end && is_response_file_space(*in)) {
+      ++in;
+    }
+    if (in == end) {
+      return true;
+    }
+
+    char *const argument = in;
+    bool is_quoted = false;
+    bool is_escaped = false; // ends with an unpaired backslash
+    char quote = 0;
+    for (; in != end; ++in) {
+      const char c = *in;
+      if (c == '\\') {
+        is_quoted = true;
+        if (in + 1 == end) {
+          is_escaped = true;
+        } else {
+          ++in;
+        }
+      } else if (quote) {
+        if (c == quote) {
+          quote = 0;
+        }
+      } else if (c == '\'' || c == '"') {
+        is_quoted = true;
+        quote = c;
+      } else if (is_response_file_space(c)) {
+        break;
+      }
+    }
+    on_argument(argument, in, is_quoted);
+    if (quote || is_escaped) {
+      return false;
+    }
+  }
+}
+
+// Removes the quotes and escapes of a raw argument in place
+//
+// The argument only gets shorter, so it is written over itself
+inline std::string_view unquote_response_file_argument(char *begin, char *end) {
+  char *out = begin;
+  char quote = 0;
+  for (char *in = begin; in != end; ++in) {
+    const char c = *in;
+    if (c == '\\' && in + 1 != end) {
+      // escaped character
+      ++in;
+    } else if (quote) {
+      if (c == quote) {
+        quote = 0;
+        continue;
+      }
+    } else if (c == '\'' || c == '"') {
+      quote = c;
+      continue;
+    }
+    *out++ = *in;
+  }
+  return {begin, static_cast<std::size_t>(out - begin)};
+}
+
+inline std::string_view make_response_file_argument(char *begin, char *end,
+                                                    bool is_quoted) {
+  return is_quoted ? unquote_response_file_argument(begin, end)
+                   : std::string_view(begin, static_cast<std::size_t>(end - begin));
+}
+
+// Where a response file includes itself, directly or through other response files
+struct response_file_cycle {
+  std::size_t token_index; // of the outermost `@file` argument
+  std::string_view token;  // the `@file` argument that closes the cycle
+};
+
+// The response files of a parse
+//
+// Arguments read from a response file are views into its mapping; they are valid
+// as long as this object is. Paths are relative to the working directory
+class response_files {
+  std::vector<mapped_file> files_;
+  std::vector<file_id> expanding_; // files being expanded, outermost first
+  std::size_t num_threads_;
+  std::size_t parallel_threshold_;
+
+  static bool is_response_file_argument(std::string_view argument) {
+    return argument.size() > 1 && argument[0] == '@';
+  }
+
+  // Appends `argument`, or the arguments of `argument` if it is `@path`
+  bool append_argument(std::string_view argument, tokens &result,
+                       std::string_view &cycle) {
+    if (is_response_file_argument(argument)) {
+      return expand_argument(argument, result, cycle);
+    }
+    result.push_back(argument);
+    return true;
+  }
+
+  // Appends the arguments of `@path` to `result`; `argument` itself if `path`
+  // cannot be read. False on a cycle, with `cycle` set to the offending argument
+  bool expand_argument(std::string_view argument, tokens &result,
+                       std::string_view &cycle) {
+    mapped_file file{std::string(argument.substr(1))};
+    if (!file.is_open()) {
+      // e.g., an email address or a file that does not exist
+      result.push_back(argument);
+      return true;
+    }
+    for (const auto &id : expanding_) {
+      if (id == file.id()) {
+        cycle = argument;
+        return false;
+      }
+    }
+    expanding_.push_back(file.id());
+    // the mapping stays put when `files_` grows
+    char *const begin = file.data();
+    char *const end = begin + file.size();
+    files_.push_back(std::move(file));
+
+    bool success = true;
+    const auto size = static_cast<std::size_t>(end - begin);
+    if (resolve_thread_count(num_threads_) > 1 && size >= parallel_threshold_) {
+      success = split_in_parallel(begin, end, result, cycle);
+    } else {
+      split_response_file(begin, end, [&](char *first, char *last, bool is_quoted) {
+        if (success) {
+          success = append_argument(make_response_file_argument(first, last, is_quoted),
+                                    result, cycle);
+        }
+      });
+    }
+    expanding_.pop_back();
+    return success;
+  }
+
+  // Splits a large response file on several threads
+  //
+  // The file is cut into chunks at whitespace, and each chunk is split as if it
+  // started outside of quotes. Chunks are counted in parallel, a chunk that started
+  // inside quotes after all is merged into the one before it, and then the
+  // arguments of every chunk are written to their place in `result` in parallel
+  bool split_in_parallel(char *begin, char *end, tokens &result,
+                         std::string_view &cycle) {
+    const auto num_threads = resolve_thread_count(num_threads_);
+    const auto size = static_cast<std::size_t>(end - begin);
+
+    // Several chunks per thread, in case some are slower
+    std::vector<char *> boundaries{begin};
+    const std::size_t num_chunks = num_threads * 4;
+    for (std::size_t i = 1; i < num_chunks; i++) {
+      char *boundary = std::max(begin + size / num_chunks * i, boundaries.back());
+      while (boundary != end && !is_response_file_space(*boundary)) {
+        ++boundary;
+      }
+      if (boundary != end && boundary != boundaries.back()) {
+        boundaries.push_back(boundary);
+      }
+    }
+    boundaries.push_back(end);
+
+    struct chunk {
+      char *begin;
+      char *end;
+      std::size_t num_arguments;
+      bool ends_outside_quotes;
+    };
+    std::vector<chunk> chunks(boundaries.size() - 1);
+    const auto count_arguments = [](chunk &c) {
+      c.num_arguments = 0;
+      c.ends_outside_quotes =
+          split_response_file(c.begin, c.end, [&c](char *, char *, bool) {
+            c.num_arguments += 1;
+          });
+    };
+    parallel_for(chunks.size(), num_threads, [&](std::size_t i) {
+      chunks[i] = {boundaries[i], boundaries[i + 1], 0, true};
+      count_arguments(chunks[i]);
+    });
+
+    // The first chunk starts outside of quotes. So does every chunk after one
+    // that ends outside of quotes
+    std::vector<chunk> merged{chunks.front()};
+    for (std::size_t i = 1; i < chunks.size(); i++) {
+      if (merged.back().ends_outside_quotes) {
+        merged.push_back(chunks[i]);
+      } else {
+        merged.back().end = chunks[i].end;
+        count_arguments(merged.back());
+      }
+    }
+
+    std::vector<std::size_t> offsets{result.size()};
+    for (const auto &c : merged) {
+      offsets.push_back(offsets.back() + c.num_arguments);
+    }
+    const auto first = result.size();
+    result.resize(offsets.back());
+    parallel_for(merged.size(), num_threads, [&](std::size_t i) {
+      auto out = result.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+      split_response_file(merged[i].begin, merged[i].end,
+                          [&out](char *first, char *last, bool is_quoted) {
+                            *out++ = make_response_file_argument(first, last, is_quoted);
+                          });
+    });
+
+    // Response files in the response file, if any
+    const auto nested = std::find_if(result.begin() + static_cast<std::ptrdiff_t>(first),
+                                     result.end(), is_response_file_argument);
+    if (nested != result.end()) {
+      tokens rest(nested, result.end());
+      result.erase(nested, result.end());
+      for (const auto &argument : rest) {
+        if (!append_argument(argument, result, cycle)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+public:
+  // Response files of at least `parallel_threshold` bytes are split on
+  // `num_threads` threads (0 = one per core)
+  explicit response_files(std::size_t num_threads = 1,
+                          std::size_t parallel_threshold = std::size_t(4) << 20)
+      : num_threads_(num_threads), parallel_threshold_(parallel_threshold) {}
+
+  // Replaces every `@path` argument, but the program name, with the arguments in
+  // the file `path`. Response files may refer to other response files
+  std::optional<response_file_cycle> expand(tokens &arguments) {
+    std::size_t first = 1;
+    while (first < arguments.size() && !is_response_file_argument(arguments[first])) {
+      first += 1;
+    }
+    if (first >= arguments.size()) {
+      // nothing to expand
+      return std::nullopt;
+    }
+
+    tokens result(arguments.begin(), arguments.begin() + first);
+    for (std::size_t i = first; i < arguments.size(); i++) {
+      std::string_view cycle;
+      if (!append_argument(arguments[i], result, cycle)) {
+        return response_file_cycle{i, cycle};
+      }
+    }
+    arguments = std::move(result);
+    return std::nullopt;
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
@@ -0,0 +1,99 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <structopt/response_file.hpp>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// The settings of one source, e.g., a config file: values by key, in tables that nest
+// like the structs they fill
+//
+// Keys and values are views, usually into the storage of the source; `files` and
+// `strings` keep storage that the source does not, e.g., a mapped config file, alive
+// as long as the settings
+struct settings {
+  // e.g., `[server]` or a JSON object; table 0 holds the top-level keys
+  struct table {
+    std::size_t parent;
+    std::string_view name;
+  };
+
+  // `key = value` or `key = [value, ...]` in a table
+  struct entry {
+    std::size_t table;
+    std::string_view key;
+    std::size_t first_value; // into `values`
+    std::size_t last_value;
+    std::size_t line; // 0 if the source has no lines
+  };
+
+  std::string origin; // e.g., "config file `app.toml`", for error messages
+  bool ignore_unknown_keys{false}; // e.g., unrelated environment variables
+  // keys are environment variables without the prefix, e.g., `LOG_LEVEL`, and name the
+  // fields that env_prefix would read them into, see details::environment_name
+  bool environment_keys{false};
+  std::vector<table> tables{{0, {}}};
+  std::vector<entry> entries; // grouped by table by group_by_table()
+  std::vector<std::string_view> values;
+
+  std::vector<mapped_file> files;
+  std::deque<std::string> strings;
+
+  // Why and where reading the source failed, if it did
+  const char *error{nullptr};
+  std::size_t line{0};
+
+  bool fail(const char *reason, std::size_t error_line = 0) {
+    error = reason;
+    line = error_line;
+    return false;
+  }
+
+  std::size_t find_table(std::size_t parent, std::string_view name) {
+    for (std::size_t i = 1; i < tables.size(); i++) {
+      if (tables[i].parent == parent && tables[i].name == name) {
+        return i;
+      }
+    }
+    tables.push_back({parent, name});
+    return tables.size() - 1;
+  }
+
+  // `server.tls.enabled` => key `enabled` in table `server.tls`, with `values`
+  template <typename Values> void add(std::string_view path, const Values &new_values) {
+    std::size_t table = 0;
+    for (auto dot = path.find('.'); dot != std::string_view::npos; dot = path.find('.')) {
+      table = find_table(table, path.substr(0, dot));
+      path.remove_prefix(dot + 1);
+    }
+    const auto first_value = values.size();
+    values.insert(values.end(), std::begin(new_values), std::end(new_values));
+    entries.push_back({table, path, first_value, values.size(), 0});
+  }
+
+  // Entries of the same table end up next to each other, still in source order
+  void group_by_table() {
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const entry &a, const entry &b) { return a.table < b.table; });
+  }
+
+  // The entries of table `index`, after group_by_table()
+  std::pair<const entry *, const entry *> entries_of(std::size_t index) const {
+    const auto range = std::equal_range(
+        entries.begin(), entries.end(), entry{index, {}, 0, 0, 0},
+        [](const entry &a, const entry &b) { return a.table < b.table; });
+    return {entries.data() + (range.first - entries.begin()),
+            entries.data() + (range.second - entries.begin())};
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
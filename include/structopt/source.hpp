@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <structopt/config_file.hpp>
+#include <structopt/environment.hpp>
+#include <structopt/settings.hpp>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+// Settings from outside the command line, e.g., a config file, the environment or
+// the query parameters of a request, that fill the optional fields and nested
+// structs of a STRUCTOPT struct
+//
+// A source lists its settings by key: the name of an optional field, or a dotted
+// path through nested structs, e.g., `server.port`. Values are views into the
+// storage of the source and are converted straight into the fields, like the values
+// of options
+//
+// read() is called once per parse, possibly from several threads at once
+class source {
+public:
+  virtual ~source() = default;
+
+  // Add the settings of this source to `result`, or return false with
+  // `result.error` set
+  virtual bool read(details::settings &result) const = 0;
+};
+
+// A config file, see app::config_file
+class file_source : public source {
+  std::string path_;
+
+public:
+  explicit file_source(std::string path) : path_(std::move(path)) {}
+
+  bool read(details::settings &result) const override {
+    return details::config_file_reader(result).read(path_);
+  }
+};
+
+// Key/value pairs in memory, e.g., a std::map<std::string, std::string> of decoded
+// query parameters. A key that appears several times, e.g., in a
+// std::vector<std::pair<...>>, has several values, for a container field
+//
+// The pairs are viewed, not copied: `map` must outlive the source
+class map_source : public source {
+  std::vector<std::pair<std::string_view, std::string_view>> pairs_;
+  std::string origin_;
+
+public:
+  template <typename Map>
+  explicit map_source(const Map &map, std::string origin = "key/value source")
+      : origin_(std::move(origin)) {
+    const auto size = std::distance(std::begin(map), std::end(map));
+    pairs_.reserve(static_cast<std::size_t>(size));
+    for (const auto &[key, value] : map) {
+      pairs_.emplace_back(key, value);
+    }
+  }
+
+  bool read(details::settings &result) const override {
+    result.origin = origin_;
+    // Pairs with the same key are next to each other, in their original order
+    std::vector<std::size_t> order(pairs_.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+      return pairs_[a].first < pairs_[b].first;
+    });
+
+    std::vector<std::string_view> values;
+    for (std::size_t i = 0; i < order.size();) {
+      const auto key = pairs_[order[i]].first;
+      values.clear();
+      for (; i < order.size() && pairs_[order[i]].first == key; i++) {
+        values.push_back(pairs_[order[i]].second);
+      }
+      result.add(key, values);
+    }
+    return true;
+  }
+};
+
+// Environment variables that start with `prefix`, e.g., `APP_LOG_LEVEL` => `log_level`
+//
+// The rest of the name is lower-cased, and `__` separates nested structs, e.g.,
+// `APP_SERVER__PORT` => `server.port`. Variables that do not name a field are
+// ignored. The environment is scanned once per read
+//
+// Unlike app::env_prefix, which fills the fields that the arguments did not, this
+// source takes its place among the other sources
+class env_source : public source {
+  std::string prefix_;
+
+public:
+  explicit env_source(std::string prefix) : prefix_(std::move(prefix)) {}
+
+  bool read(details::settings &result) const override {
+    result.origin = "environment";
+    result.ignore_unknown_keys = true;
+    result.environment_keys = true;
+    auto entries = details::process_environment();
+    if (entries == nullptr) {
+      return true;
+    }
+    for (; *entries != nullptr; ++entries) {
+      const char *entry = *entries;
+      if (std::strncmp(entry, prefix_.data(), prefix_.size()) != 0) {
+        continue;
+      }
+      const char *equal = std::strchr(entry + prefix_.size(), '=');
+      if (equal == nullptr || equal == entry + prefix_.size()) {
+        continue;
+      }
+
+      // `SERVER__PORT` => `SERVER.PORT`, i.e., `PORT` in table `SERVER`
+      auto &key = result.strings.emplace_back();
+      for (const char *c = entry + prefix_.size(); c != equal; ++c) {
+        if (c[0] == '_' && c + 1 != equal && c[1] == '_') {
+          key += '.';
+          ++c;
+        } else {
+          key += *c;
+        }
+      }
+      const std::string_view value(equal + 1);
+      result.add(key, std::initializer_list<std::string_view>{value});
+    }
+    return true;
+  }
+};
+
+} // namespace structopt
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace structopt {
+
+namespace details {
+struct parser;
+}
+
+// A positional field whose values are handed to a callback as they are parsed,
+// instead of being collected into a container, e.g.,
+//
+//   struct Options {
+//     structopt::stream<std::string> files = [](std::string file) { index(file); };
+//   };
+//
+// Values are converted like the elements of a std::vector<T> field. Memory use does
+// not grow with the number of values
+template <typename T> class stream {
+  std::function<void(T &&)> sink_;
+  std::size_t size_{0};
+
+  friend struct structopt::details::parser;
+
+public:
+  using value_type = T;
+
+  // Values are parsed, and checked, but dropped
+  stream() = default;
+
+  // `sink` is called with every value, in order
+  template <typename F, typename = typename std::enable_if<!std::is_same<
+                            typename std::decay<F>::type, stream>::value>::type>
+  stream(F &&sink) : sink_(std::forward<F>(sink)) {}
+
+  // Number of values passed to the sink by the last parse
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+};
+
+} // namespace structopt
@@ -1,7 +1,6 @@
 
 #pragma once
 #include <optional>
-#include <structopt/visitor.hpp>
 
 namespace structopt {
 
@@ -11,7 +10,6 @@ struct parser;
 
 class sub_command {
   std::optional<bool> invoked_;
-  details::visitor visitor_;
 
   friend struct structopt::details::parser;
 
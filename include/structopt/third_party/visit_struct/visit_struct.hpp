@@ -12,6 +12,7 @@
  * run-time overhead.
  */
 
+#include <cstddef>
 #include <utility>
 #include <type_traits>
 
@@ -94,6 +95,62 @@ struct accessor {
   }
 };
 
+// Indexed access to the members of a visitable struct (structopt: needs C++17)
+//
+// Looking up a member was overload resolution over one overload per member. In a
+// pack, __type_pack_element finds it in constant time; the fallback is still linear
+// in the number of members, so code that visits every member expands member_list
+namespace detail {
+
+#if defined(__has_builtin)
+#  if __has_builtin(__type_pack_element)
+#    define VISIT_STRUCT_HAS_TYPE_PACK_ELEMENT
+#  endif
+#endif
+
+#ifdef VISIT_STRUCT_HAS_TYPE_PACK_ELEMENT
+template <std::size_t I, typename... Ts>
+using nth_type = __type_pack_element<I, Ts...>;
+#else
+template <std::size_t I, typename T>
+struct indexed { using type = T; };
+
+template <typename Indices, typename... Ts>
+struct indexer;
+
+template <std::size_t... I, typename... Ts>
+struct indexer<std::index_sequence<I...>, Ts...> : indexed<I, Ts>... {};
+
+template <std::size_t I, typename T>
+indexed<I, T> select(const indexed<I, T> &);
+
+template <std::size_t I, typename... Ts>
+using nth_type = typename decltype(select<I>(
+    std::declval<const indexer<std::index_sequence_for<Ts...>, Ts...> &>()))::type;
+#endif
+
+} // end namespace detail
+
+// The type of a member, from its member pointer type
+template <typename MemPtr>
+struct member_type;
+
+template <typename T, typename S>
+struct member_type<T S::*> { using type = T; };
+
+template <typename MemPtr>
+using member_type_t = typename member_type<MemPtr>::type;
+
+// The member pointers of a struct, e.g., member_list<nullptr, &S::a, &S::b>
+//
+// The leading nullptr lets a map-macro put a comma before each member. Expanding
+// `Pointers` visits every member in one instantiation
+template <std::nullptr_t, auto... Pointers>
+struct member_list {
+  template <std::size_t idx>
+  using at = detail::nth_type<idx, std::integral_constant<decltype(Pointers), Pointers>...>;
+};
+
 //
 // User-interface
 //
@@ -271,6 +328,10 @@ struct type_at_s {
 template <int idx, typename S>
 using type_at = typename type_at_s<idx, S>::type;
 
+// Get the member pointers, as a visit_struct::member_list
+template <typename S>
+using members = typename traits::visitable<traits::clean_t<S>>::members;
+
 // Get name of structure
 template <typename S>
 VISIT_STRUCT_CONSTEXPR auto get_name() ->
@@ -306,9 +367,11 @@ VISIT_STRUCT_CONSTEXPR auto get_name(S &&) -> decltype(get_name<S>()) {
 
 /*** Generated code ***/
 
-static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
-
 #define VISIT_STRUCT_EXPAND(x) x
+
+#if defined(_MSC_VER) && !defined(__clang__)
+// at most 127 macro arguments
+static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
 #define VISIT_STRUCT_PP_ARG_N( \
         _1, _2, _3, _4, _5, _6, _7, _8, _9, _10,\
         _11, _12, _13, _14, _15, _16, _17, _18, _19, _20,\
@@ -325,6 +388,217 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
         29, 28, 27, 26, 25, 24, 23, 22, 21, 20,  \
         19, 18, 17, 16, 15, 14, 13, 12, 11, 10,  \
         9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#else
+static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 1024;
+#define VISIT_STRUCT_PP_ARG_N( \
+        _1, _2, _3, _4, _5, _6, _7, _8, _9, _10,\
+        _11, _12, _13, _14, _15, _16, _17, _18, _19, _20,\
+        _21, _22, _23, _24, _25, _26, _27, _28, _29, _30,\
+        _31, _32, _33, _34, _35, _36, _37, _38, _39, _40,\
+        _41, _42, _43, _44, _45, _46, _47, _48, _49, _50,\
+        _51, _52, _53, _54, _55, _56, _57, _58, _59, _60,\
+        _61, _62, _63, _64, _65, _66, _67, _68, _69, _70,\
+        _71, _72, _73, _74, _75, _76, _77, _78, _79, _80,\
+        _81, _82, _83, _84, _85, _86, _87, _88, _89, _90,\
+        _91, _92, _93, _94, _95, _96, _97, _98, _99, _100,\
+        _101, _102, _103, _104, _105, _106, _107, _108, _109, _110,\
+        _111, _112, _113, _114, _115, _116, _117, _118, _119, _120,\
+        _121, _122, _123, _124, _125, _126, _127, _128, _129, _130,\
+        _131, _132, _133, _134, _135, _136, _137, _138, _139, _140,\
+        _141, _142, _143, _144, _145, _146, _147, _148, _149, _150,\
+        _151, _152, _153, _154, _155, _156, _157, _158, _159, _160,\
+        _161, _162, _163, _164, _165, _166, _167, _168, _169, _170,\
+        _171, _172, _173, _174, _175, _176, _177, _178, _179, _180,\
+        _181, _182, _183, _184, _185, _186, _187, _188, _189, _190,\
+        _191, _192, _193, _194, _195, _196, _197, _198, _199, _200,\
+        _201, _202, _203, _204, _205, _206, _207, _208, _209, _210,\
+        _211, _212, _213, _214, _215, _216, _217, _218, _219, _220,\
+        _221, _222, _223, _224, _225, _226, _227, _228, _229, _230,\
+        _231, _232, _233, _234, _235, _236, _237, _238, _239, _240,\
+        _241, _242, _243, _244, _245, _246, _247, _248, _249, _250,\
+        _251, _252, _253, _254, _255, _256, _257, _258, _259, _260,\
+        _261, _262, _263, _264, _265, _266, _267, _268, _269, _270,\
+        _271, _272, _273, _274, _275, _276, _277, _278, _279, _280,\
+        _281, _282, _283, _284, _285, _286, _287, _288, _289, _290,\
+        _291, _292, _293, _294, _295, _296, _297, _298, _299, _300,\
+        _301, _302, _303, _304, _305, _306, _307, _308, _309, _310,\
+        _311, _312, _313, _314, _315, _316, _317, _318, _319, _320,\
+        _321, _322, _323, _324, _325, _326, _327, _328, _329, _330,\
+        _331, _332, _333, _334, _335, _336, _337, _338, _339, _340,\
+        _341, _342, _343, _344, _345, _346, _347, _348, _349, _350,\
+        _351, _352, _353, _354, _355, _356, _357, _358, _359, _360,\
+        _361, _362, _363, _364, _365, _366, _367, _368, _369, _370,\
+        _371, _372, _373, _374, _375, _376, _377, _378, _379, _380,\
+        _381, _382, _383, _384, _385, _386, _387, _388, _389, _390,\
+        _391, _392, _393, _394, _395, _396, _397, _398, _399, _400,\
+        _401, _402, _403, _404, _405, _406, _407, _408, _409, _410,\
+        _411, _412, _413, _414, _415, _416, _417, _418, _419, _420,\
+        _421, _422, _423, _424, _425, _426, _427, _428, _429, _430,\
+        _431, _432, _433, _434, _435, _436, _437, _438, _439, _440,\
+        _441, _442, _443, _444, _445, _446, _447, _448, _449, _450,\
+        _451, _452, _453, _454, _455, _456, _457, _458, _459, _460,\
+        _461, _462, _463, _464, _465, _466, _467, _468, _469, _470,\
+        _471, _472, _473, _474, _475, _476, _477, _478, _479, _480,\
+        _481, _482, _483, _484, _485, _486, _487, _488, _489, _490,\
+        _491, _492, _493, _494, _495, _496, _497, _498, _499, _500,\
+        _501, _502, _503, _504, _505, _506, _507, _508, _509, _510,\
+        _511, _512, _513, _514, _515, _516, _517, _518, _519, _520,\
+        _521, _522, _523, _524, _525, _526, _527, _528, _529, _530,\
+        _531, _532, _533, _534, _535, _536, _537, _538, _539, _540,\
+        _541, _542, _543, _544, _545, _546, _547, _548, _549, _550,\
+        _551, _552, _553, _554, _555, _556, _557, _558, _559, _560,\
+        _561, _562, _563, _564, _565, _566, _567, _568, _569, _570,\
+        _571, _572, _573, _574, _575, _576, _577, _578, _579, _580,\
+        _581, _582, _583, _584, _585, _586, _587, _588, _589, _590,\
+        _591, _592, _593, _594, _595, _596, _597, _598, _599, _600,\
+        _601, _602, _603, _604, _605, _606, _607, _608, _609, _610,\
+        _611, _612, _613, _614, _615, _616, _617, _618, _619, _620,\
+        _621, _622, _623, _624, _625, _626, _627, _628, _629, _630,\
+        _631, _632, _633, _634, _635, _636, _637, _638, _639, _640,\
+        _641, _642, _643, _644, _645, _646, _647, _648, _649, _650,\
+        _651, _652, _653, _654, _655, _656, _657, _658, _659, _660,\
+        _661, _662, _663, _664, _665, _666, _667, _668, _669, _670,\
+        _671, _672, _673, _674, _675, _676, _677, _678, _679, _680,\
+        _681, _682, _683, _684, _685, _686, _687, _688, _689, _690,\
+        _691, _692, _693, _694, _695, _696, _697, _698, _699, _700,\
+        _701, _702, _703, _704, _705, _706, _707, _708, _709, _710,\
+        _711, _712, _713, _714, _715, _716, _717, _718, _719, _720,\
+        _721, _722, _723, _724, _725, _726, _727, _728, _729, _730,\
+        _731, _732, _733, _734, _735, _736, _737, _738, _739, _740,\
+        _741, _742, _743, _744, _745, _746, _747, _748, _749, _750,\
+        _751, _752, _753, _754, _755, _756, _757, _758, _759, _760,\
+        _761, _762, _763, _764, _765, _766, _767, _768, _769, _770,\
+        _771, _772, _773, _774, _775, _776, _777, _778, _779, _780,\
+        _781, _782, _783, _784, _785, _786, _787, _788, _789, _790,\
+        _791, _792, _793, _794, _795, _796, _797, _798, _799, _800,\
+        _801, _802, _803, _804, _805, _806, _807, _808, _809, _810,\
+        _811, _812, _813, _814, _815, _816, _817, _818, _819, _820,\
+        _821, _822, _823, _824, _825, _826, _827, _828, _829, _830,\
+        _831, _832, _833, _834, _835, _836, _837, _838, _839, _840,\
+        _841, _842, _843, _844, _845, _846, _847, _848, _849, _850,\
+        _851, _852, _853, _854, _855, _856, _857, _858, _859, _860,\
+        _861, _862, _863, _864, _865, _866, _867, _868, _869, _870,\
+        _871, _872, _873, _874, _875, _876, _877, _878, _879, _880,\
+        _881, _882, _883, _884, _885, _886, _887, _888, _889, _890,\
+        _891, _892, _893, _894, _895, _896, _897, _898, _899, _900,\
+        _901, _902, _903, _904, _905, _906, _907, _908, _909, _910,\
+        _911, _912, _913, _914, _915, _916, _917, _918, _919, _920,\
+        _921, _922, _923, _924, _925, _926, _927, _928, _929, _930,\
+        _931, _932, _933, _934, _935, _936, _937, _938, _939, _940,\
+        _941, _942, _943, _944, _945, _946, _947, _948, _949, _950,\
+        _951, _952, _953, _954, _955, _956, _957, _958, _959, _960,\
+        _961, _962, _963, _964, _965, _966, _967, _968, _969, _970,\
+        _971, _972, _973, _974, _975, _976, _977, _978, _979, _980,\
+        _981, _982, _983, _984, _985, _986, _987, _988, _989, _990,\
+        _991, _992, _993, _994, _995, _996, _997, _998, _999, _1000,\
+        _1001, _1002, _1003, _1004, _1005, _1006, _1007, _1008, _1009, _1010,\
+        _1011, _1012, _1013, _1014, _1015, _1016, _1017, _1018, _1019, _1020,\
+        _1021, _1022, _1023, _1024, N, ...) N
+#define VISIT_STRUCT_PP_NARG(...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_PP_ARG_N(__VA_ARGS__,  \
+        1024, 1023, 1022, 1021, 1020, 1019, 1018, 1017, 1016, 1015,  \
+        1014, 1013, 1012, 1011, 1010, 1009, 1008, 1007, 1006, 1005,  \
+        1004, 1003, 1002, 1001, 1000, 999, 998, 997, 996, 995,  \
+        994, 993, 992, 991, 990, 989, 988, 987, 986, 985,  \
+        984, 983, 982, 981, 980, 979, 978, 977, 976, 975,  \
+        974, 973, 972, 971, 970, 969, 968, 967, 966, 965,  \
+        964, 963, 962, 961, 960, 959, 958, 957, 956, 955,  \
+        954, 953, 952, 951, 950, 949, 948, 947, 946, 945,  \
+        944, 943, 942, 941, 940, 939, 938, 937, 936, 935,  \
+        934, 933, 932, 931, 930, 929, 928, 927, 926, 925,  \
+        924, 923, 922, 921, 920, 919, 918, 917, 916, 915,  \
+        914, 913, 912, 911, 910, 909, 908, 907, 906, 905,  \
+        904, 903, 902, 901, 900, 899, 898, 897, 896, 895,  \
+        894, 893, 892, 891, 890, 889, 888, 887, 886, 885,  \
+        884, 883, 882, 881, 880, 879, 878, 877, 876, 875,  \
+        874, 873, 872, 871, 870, 869, 868, 867, 866, 865,  \
+        864, 863, 862, 861, 860, 859, 858, 857, 856, 855,  \
+        854, 853, 852, 851, 850, 849, 848, 847, 846, 845,  \
+        844, 843, 842, 841, 840, 839, 838, 837, 836, 835,  \
+        834, 833, 832, 831, 830, 829, 828, 827, 826, 825,  \
+        824, 823, 822, 821, 820, 819, 818, 817, 816, 815,  \
+        814, 813, 812, 811, 810, 809, 808, 807, 806, 805,  \
+        804, 803, 802, 801, 800, 799, 798, 797, 796, 795,  \
+        794, 793, 792, 791, 790, 789, 788, 787, 786, 785,  \
+        784, 783, 782, 781, 780, 779, 778, 777, 776, 775,  \
+        774, 773, 772, 771, 770, 769, 768, 767, 766, 765,  \
+        764, 763, 762, 761, 760, 759, 758, 757, 756, 755,  \
+        754, 753, 752, 751, 750, 749, 748, 747, 746, 745,  \
+        744, 743, 742, 741, 740, 739, 738, 737, 736, 735,  \
+        734, 733, 732, 731, 730, 729, 728, 727, 726, 725,  \
+        724, 723, 722, 721, 720, 719, 718, 717, 716, 715,  \
+        714, 713, 712, 711, 710, 709, 708, 707, 706, 705,  \
+        704, 703, 702, 701, 700, 699, 698, 697, 696, 695,  \
+        694, 693, 692, 691, 690, 689, 688, 687, 686, 685,  \
+        684, 683, 682, 681, 680, 679, 678, 677, 676, 675,  \
+        674, 673, 672, 671, 670, 669, 668, 667, 666, 665,  \
+        664, 663, 662, 661, 660, 659, 658, 657, 656, 655,  \
+        654, 653, 652, 651, 650, 649, 648, 647, 646, 645,  \
+        644, 643, 642, 641, 640, 639, 638, 637, 636, 635,  \
+        634, 633, 632, 631, 630, 629, 628, 627, 626, 625,  \
+        624, 623, 622, 621, 620, 619, 618, 617, 616, 615,  \
+        614, 613, 612, 611, 610, 609, 608, 607, 606, 605,  \
+        604, 603, 602, 601, 600, 599, 598, 597, 596, 595,  \
+        594, 593, 592, 591, 590, 589, 588, 587, 586, 585,  \
+        584, 583, 582, 581, 580, 579, 578, 577, 576, 575,  \
+        574, 573, 572, 571, 570, 569, 568, 567, 566, 565,  \
+        564, 563, 562, 561, 560, 559, 558, 557, 556, 555,  \
+        554, 553, 552, 551, 550, 549, 548, 547, 546, 545,  \
+        544, 543, 542, 541, 540, 539, 538, 537, 536, 535,  \
+        534, 533, 532, 531, 530, 529, 528, 527, 526, 525,  \
+        524, 523, 522, 521, 520, 519, 518, 517, 516, 515,  \
+        514, 513, 512, 511, 510, 509, 508, 507, 506, 505,  \
+        504, 503, 502, 501, 500, 499, 498, 497, 496, 495,  \
+        494, 493, 492, 491, 490, 489, 488, 487, 486, 485,  \
+        484, 483, 482, 481, 480, 479, 478, 477, 476, 475,  \
+        474, 473, 472, 471, 470, 469, 468, 467, 466, 465,  \
+        464, 463, 462, 461, 460, 459, 458, 457, 456, 455,  \
+        454, 453, 452, 451, 450, 449, 448, 447, 446, 445,  \
+        444, 443, 442, 441, 440, 439, 438, 437, 436, 435,  \
+        434, 433, 432, 431, 430, 429, 428, 427, 426, 425,  \
+        424, 423, 422, 421, 420, 419, 418, 417, 416, 415,  \
+        414, 413, 412, 411, 410, 409, 408, 407, 406, 405,  \
+        404, 403, 402, 401, 400, 399, 398, 397, 396, 395,  \
+        394, 393, 392, 391, 390, 389, 388, 387, 386, 385,  \
+        384, 383, 382, 381, 380, 379, 378, 377, 376, 375,  \
+        374, 373, 372, 371, 370, 369, 368, 367, 366, 365,  \
+        364, 363, 362, 361, 360, 359, 358, 357, 356, 355,  \
+        354, 353, 352, 351, 350, 349, 348, 347, 346, 345,  \
+        344, 343, 342, 341, 340, 339, 338, 337, 336, 335,  \
+        334, 333, 332, 331, 330, 329, 328, 327, 326, 325,  \
+        324, 323, 322, 321, 320, 319, 318, 317, 316, 315,  \
+        314, 313, 312, 311, 310, 309, 308, 307, 306, 305,  \
+        304, 303, 302, 301, 300, 299, 298, 297, 296, 295,  \
+        294, 293, 292, 291, 290, 289, 288, 287, 286, 285,  \
+        284, 283, 282, 281, 280, 279, 278, 277, 276, 275,  \
+        274, 273, 272, 271, 270, 269, 268, 267, 266, 265,  \
+        264, 263, 262, 261, 260, 259, 258, 257, 256, 255,  \
+        254, 253, 252, 251, 250, 249, 248, 247, 246, 245,  \
+        244, 243, 242, 241, 240, 239, 238, 237, 236, 235,  \
+        234, 233, 232, 231, 230, 229, 228, 227, 226, 225,  \
+        224, 223, 222, 221, 220, 219, 218, 217, 216, 215,  \
+        214, 213, 212, 211, 210, 209, 208, 207, 206, 205,  \
+        204, 203, 202, 201, 200, 199, 198, 197, 196, 195,  \
+        194, 193, 192, 191, 190, 189, 188, 187, 186, 185,  \
+        184, 183, 182, 181, 180, 179, 178, 177, 176, 175,  \
+        174, 173, 172, 171, 170, 169, 168, 167, 166, 165,  \
+        164, 163, 162, 161, 160, 159, 158, 157, 156, 155,  \
+        154, 153, 152, 151, 150, 149, 148, 147, 146, 145,  \
+        144, 143, 142, 141, 140, 139, 138, 137, 136, 135,  \
+        134, 133, 132, 131, 130, 129, 128, 127, 126, 125,  \
+        124, 123, 122, 121, 120, 119, 118, 117, 116, 115,  \
+        114, 113, 112, 111, 110, 109, 108, 107, 106, 105,  \
+        104, 103, 102, 101, 100, 99, 98, 97, 96, 95,  \
+        94, 93, 92, 91, 90, 89, 88, 87, 86, 85,  \
+        84, 83, 82, 81, 80, 79, 78, 77, 76, 75,  \
+        74, 73, 72, 71, 70, 69, 68, 67, 66, 65,  \
+        64, 63, 62, 61, 60, 59, 58, 57, 56, 55,  \
+        54, 53, 52, 51, 50, 49, 48, 47, 46, 45,  \
+        44, 43, 42, 41, 40, 39, 38, 37, 36, 35,  \
+        34, 33, 32, 31, 30, 29, 28, 27, 26, 25,  \
+        24, 23, 22, 21, 20, 19, 18, 17, 16, 15,  \
+        14, 13, 12, 11, 10, 9, 8, 7, 6, 5,  \
+        4, 3, 2, 1, 0))
+#endif
 
 /* need extra level to force extra eval */
 #define VISIT_STRUCT_CONCAT_(a,b) a ## b
@@ -395,11 +669,983 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
 #define VISIT_STRUCT_APPLYF62(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62)
 #define VISIT_STRUCT_APPLYF63(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63)
 #define VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64)
-#define VISIT_STRUCT_APPLYF65(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65)
-#define VISIT_STRUCT_APPLYF66(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66)
-#define VISIT_STRUCT_APPLYF67(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,_67) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66) f(_67)
-#define VISIT_STRUCT_APPLYF68(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,_67,_68) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66) f(_67) f(_68)
-#define VISIT_STRUCT_APPLYF69(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,_67,_68,_69) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66) f(_67) f(_68) f(_69)
+
+#define VISIT_STRUCT_APPLY_BLOCK1(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK2(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK3(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK4(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK5(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK6(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK7(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK8(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK9(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK10(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK11(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK12(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK13(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK14(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK15(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+
+#define VISIT_STRUCT_APPLYF65(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF1,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF66(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF2,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF67(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF3,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF68(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF4,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF69(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF5,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF70(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF6,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF71(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF7,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF72(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF8,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF73(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF9,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF74(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF10,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF75(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF11,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF76(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF12,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF77(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF13,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF78(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF14,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF79(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF15,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF80(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF16,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF81(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF17,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF82(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF18,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF83(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF19,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF84(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF20,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF85(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF21,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF86(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF22,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF87(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF23,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF88(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF24,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF89(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF25,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF90(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF26,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF91(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF27,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF92(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF28,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF93(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF29,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF94(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF30,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF95(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF31,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF96(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF32,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF97(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF33,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF98(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF34,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF99(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF35,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF100(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF36,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF101(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF37,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF102(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF38,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF103(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF39,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF104(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF40,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF105(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF41,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF106(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF42,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF107(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF43,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF108(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF44,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF109(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF45,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF110(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF46,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF111(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF47,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF112(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF48,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF113(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF49,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF114(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF50,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF115(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF51,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF116(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF52,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF117(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF53,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF118(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF54,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF119(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF55,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF120(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF56,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF121(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF57,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF122(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF58,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF123(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF59,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF124(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF60,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF125(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF61,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF126(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF62,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF127(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF63,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF128(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF64,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF129(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF65,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF130(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF66,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF131(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF67,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF132(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF68,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF133(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF69,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF134(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF70,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF135(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF71,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF136(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF72,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF137(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF73,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF138(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF74,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF139(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF75,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF140(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF76,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF141(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF77,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF142(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF78,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF143(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF79,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF144(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF80,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF145(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF81,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF146(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF82,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF147(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF83,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF148(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF84,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF149(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF85,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF150(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF86,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF151(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF87,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF152(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF88,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF153(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF89,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF154(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF90,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF155(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF91,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF156(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF92,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF157(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF93,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF158(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF94,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF159(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF95,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF160(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF96,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF161(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF97,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF162(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF98,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF163(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF99,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF164(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF100,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF165(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF101,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF166(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF102,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF167(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF103,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF168(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF104,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF169(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF105,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF170(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF106,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF171(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF107,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF172(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF108,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF173(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF109,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF174(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF110,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF175(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF111,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF176(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF112,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF177(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF113,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF178(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF114,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF179(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF115,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF180(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF116,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF181(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF117,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF182(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF118,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF183(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF119,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF184(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF120,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF185(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF121,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF186(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF122,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF187(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF123,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF188(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF124,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF189(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF125,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF190(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF126,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF191(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF127,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF192(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF128,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF193(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF129,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF194(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF130,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF195(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF131,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF196(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF132,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF197(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF133,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF198(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF134,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF199(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF135,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF200(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF136,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF201(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF137,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF202(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF138,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF203(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF139,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF204(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF140,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF205(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF141,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF206(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF142,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF207(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF143,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF208(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF144,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF209(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF145,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF210(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF146,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF211(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF147,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF212(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF148,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF213(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF149,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF214(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF150,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF215(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF151,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF216(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF152,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF217(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF153,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF218(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF154,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF219(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF155,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF220(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF156,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF221(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF157,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF222(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF158,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF223(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF159,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF224(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF160,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF225(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF161,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF226(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF162,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF227(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF163,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF228(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF164,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF229(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF165,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF230(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF166,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF231(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF167,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF232(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF168,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF233(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF169,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF234(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF170,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF235(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF171,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF236(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF172,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF237(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF173,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF238(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF174,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF239(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF175,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF240(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF176,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF241(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF177,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF242(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF178,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF243(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF179,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF244(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF180,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF245(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF181,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF246(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF182,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF247(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF183,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF248(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF184,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF249(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF185,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF250(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF186,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF251(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF187,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF252(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF188,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF253(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF189,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF254(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF190,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF255(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF191,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF256(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF192,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF257(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF193,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF258(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF194,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF259(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF195,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF260(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF196,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF261(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF197,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF262(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF198,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF263(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF199,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF264(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF200,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF265(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF201,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF266(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF202,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF267(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF203,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF268(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF204,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF269(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF205,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF270(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF206,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF271(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF207,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF272(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF208,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF273(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF209,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF274(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF210,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF275(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF211,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF276(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF212,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF277(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF213,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF278(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF214,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF279(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF215,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF280(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF216,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF281(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF217,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF282(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF218,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF283(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF219,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF284(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF220,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF285(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF221,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF286(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF222,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF287(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF223,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF288(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF224,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF289(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF225,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF290(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF226,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF291(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF227,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF292(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF228,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF293(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF229,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF294(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF230,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF295(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF231,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF296(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF232,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF297(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF233,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF298(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF234,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF299(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF235,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF300(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF236,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF301(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF237,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF302(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF238,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF303(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF239,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF304(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF240,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF305(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF241,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF306(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF242,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF307(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF243,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF308(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF244,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF309(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF245,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF310(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF246,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF311(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF247,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF312(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF248,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF313(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF249,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF314(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF250,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF315(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF251,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF316(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF252,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF317(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF253,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF318(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF254,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF319(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF255,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF320(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF256,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF321(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF257,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF322(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF258,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF323(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF259,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF324(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF260,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF325(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF261,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF326(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF262,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF327(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF263,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF328(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF264,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF329(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF265,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF330(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF266,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF331(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF267,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF332(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF268,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF333(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF269,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF334(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF270,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF335(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF271,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF336(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF272,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF337(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF273,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF338(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF274,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF339(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF275,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF340(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF276,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF341(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF277,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF342(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF278,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF343(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF279,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF344(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF280,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF345(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF281,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF346(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF282,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF347(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF283,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF348(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF284,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF349(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF285,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF350(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF286,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF351(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF287,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF352(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF288,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF353(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF289,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF354(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF290,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF355(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF291,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF356(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF292,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF357(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF293,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF358(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF294,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF359(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF295,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF360(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF296,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF361(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF297,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF362(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF298,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF363(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF299,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF364(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF300,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF365(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF301,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF366(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF302,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF367(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF303,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF368(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF304,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF369(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF305,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF370(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF306,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF371(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF307,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF372(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF308,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF373(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF309,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF374(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF310,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF375(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF311,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF376(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF312,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF377(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF313,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF378(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF314,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF379(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF315,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF380(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF316,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF381(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF317,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF382(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF318,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF383(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF319,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF384(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF320,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF385(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF321,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF386(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF322,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF387(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF323,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF388(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF324,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF389(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF325,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF390(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF326,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF391(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF327,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF392(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF328,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF393(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF329,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF394(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF330,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF395(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF331,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF396(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF332,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF397(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF333,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF398(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF334,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF399(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF335,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF400(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF336,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF401(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF337,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF402(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF338,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF403(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF339,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF404(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF340,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF405(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF341,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF406(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF342,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF407(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF343,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF408(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF344,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF409(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF345,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF410(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF346,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF411(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF347,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF412(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF348,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF413(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF349,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF414(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF350,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF415(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF351,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF416(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF352,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF417(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF353,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF418(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF354,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF419(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF355,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF420(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF356,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF421(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF357,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF422(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF358,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF423(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF359,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF424(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF360,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF425(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF361,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF426(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF362,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF427(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF363,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF428(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF364,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF429(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF365,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF430(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF366,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF431(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF367,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF432(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF368,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF433(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF369,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF434(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF370,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF435(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF371,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF436(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF372,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF437(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF373,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF438(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF374,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF439(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF375,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF440(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF376,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF441(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF377,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF442(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF378,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF443(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF379,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF444(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF380,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF445(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF381,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF446(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF382,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF447(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF383,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF448(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF384,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF449(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF385,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF450(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF386,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF451(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF387,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF452(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF388,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF453(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF389,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF454(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF390,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF455(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF391,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF456(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF392,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF457(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF393,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF458(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF394,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF459(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF395,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF460(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF396,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF461(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF397,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF462(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF398,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF463(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF399,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF464(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF400,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF465(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF401,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF466(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF402,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF467(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF403,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF468(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF404,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF469(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF405,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF470(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF406,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF471(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF407,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF472(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF408,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF473(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF409,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF474(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF410,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF475(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF411,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF476(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF412,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF477(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF413,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF478(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF414,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF479(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF415,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF480(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF416,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF481(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF417,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF482(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF418,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF483(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF419,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF484(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF420,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF485(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF421,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF486(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF422,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF487(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF423,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF488(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF424,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF489(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF425,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF490(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF426,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF491(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF427,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF492(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF428,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF493(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF429,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF494(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF430,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF495(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF431,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF496(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF432,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF497(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF433,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF498(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF434,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF499(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF435,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF500(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF436,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF501(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF437,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF502(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF438,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF503(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF439,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF504(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF440,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF505(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF441,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF506(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF442,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF507(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF443,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF508(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF444,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF509(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF445,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF510(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF446,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF511(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF447,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF512(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF448,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF513(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF449,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF514(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF450,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF515(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF451,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF516(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF452,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF517(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF453,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF518(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF454,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF519(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF455,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF520(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF456,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF521(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF457,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF522(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF458,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF523(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF459,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF524(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF460,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF525(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF461,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF526(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF462,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF527(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF463,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF528(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF464,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF529(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF465,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF530(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF466,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF531(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF467,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF532(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF468,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF533(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF469,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF534(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF470,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF535(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF471,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF536(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF472,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF537(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF473,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF538(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF474,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF539(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF475,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF540(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF476,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF541(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF477,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF542(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF478,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF543(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF479,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF544(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF480,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF545(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF481,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF546(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF482,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF547(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF483,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF548(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF484,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF549(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF485,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF550(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF486,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF551(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF487,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF552(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF488,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF553(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF489,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF554(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF490,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF555(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF491,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF556(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF492,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF557(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF493,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF558(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF494,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF559(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF495,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF560(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF496,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF561(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF497,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF562(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF498,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF563(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF499,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF564(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF500,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF565(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF501,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF566(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF502,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF567(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF503,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF568(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF504,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF569(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF505,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF570(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF506,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF571(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF507,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF572(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF508,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF573(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF509,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF574(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF510,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF575(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF511,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF576(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF512,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF577(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF513,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF578(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF514,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF579(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF515,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF580(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF516,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF581(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF517,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF582(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF518,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF583(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF519,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF584(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF520,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF585(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF521,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF586(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF522,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF587(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF523,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF588(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF524,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF589(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF525,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF590(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF526,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF591(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF527,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF592(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF528,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF593(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF529,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF594(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF530,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF595(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF531,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF596(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF532,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF597(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF533,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF598(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF534,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF599(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF535,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF600(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF536,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF601(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF537,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF602(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF538,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF603(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF539,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF604(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF540,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF605(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF541,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF606(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF542,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF607(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF543,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF608(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF544,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF609(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF545,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF610(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF546,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF611(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF547,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF612(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF548,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF613(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF549,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF614(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF550,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF615(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF551,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF616(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF552,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF617(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF553,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF618(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF554,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF619(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF555,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF620(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF556,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF621(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF557,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF622(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF558,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF623(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF559,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF624(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF560,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF625(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF561,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF626(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF562,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF627(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF563,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF628(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF564,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF629(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF565,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF630(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF566,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF631(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF567,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF632(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF568,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF633(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF569,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF634(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF570,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF635(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF571,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF636(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF572,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF637(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF573,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF638(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF574,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF639(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF575,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF640(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF576,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF641(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF577,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF642(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF578,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF643(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF579,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF644(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF580,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF645(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF581,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF646(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF582,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF647(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF583,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF648(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF584,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF649(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF585,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF650(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF586,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF651(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF587,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF652(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF588,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF653(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF589,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF654(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF590,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF655(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF591,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF656(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF592,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF657(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF593,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF658(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF594,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF659(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF595,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF660(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF596,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF661(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF597,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF662(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF598,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF663(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF599,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF664(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF600,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF665(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF601,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF666(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF602,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF667(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF603,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF668(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF604,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF669(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF605,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF670(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF606,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF671(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF607,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF672(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF608,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF673(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF609,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF674(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF610,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF675(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF611,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF676(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF612,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF677(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF613,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF678(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF614,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF679(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF615,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF680(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF616,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF681(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF617,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF682(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF618,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF683(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF619,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF684(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF620,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF685(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF621,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF686(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF622,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF687(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF623,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF688(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF624,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF689(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF625,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF690(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF626,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF691(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF627,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF692(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF628,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF693(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF629,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF694(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF630,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF695(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF631,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF696(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF632,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF697(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF633,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF698(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF634,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF699(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF635,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF700(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF636,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF701(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF637,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF702(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF638,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF703(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF639,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF704(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF640,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF705(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF641,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF706(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF642,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF707(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF643,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF708(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF644,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF709(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF645,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF710(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF646,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF711(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF647,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF712(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF648,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF713(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF649,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF714(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF650,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF715(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF651,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF716(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF652,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF717(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF653,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF718(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF654,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF719(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF655,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF720(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF656,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF721(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF657,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF722(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF658,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF723(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF659,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF724(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF660,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF725(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF661,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF726(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF662,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF727(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF663,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF728(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF664,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF729(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF665,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF730(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF666,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF731(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF667,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF732(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF668,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF733(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF669,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF734(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF670,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF735(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF671,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF736(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF672,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF737(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF673,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF738(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF674,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF739(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF675,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF740(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF676,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF741(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF677,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF742(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF678,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF743(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF679,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF744(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF680,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF745(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF681,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF746(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF682,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF747(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF683,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF748(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF684,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF749(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF685,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF750(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF686,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF751(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF687,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF752(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF688,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF753(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF689,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF754(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF690,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF755(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF691,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF756(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF692,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF757(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF693,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF758(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF694,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF759(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF695,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF760(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF696,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF761(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF697,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF762(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF698,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF763(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF699,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF764(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF700,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF765(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF701,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF766(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF702,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF767(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF703,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF768(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF704,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF769(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF705,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF770(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF706,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF771(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF707,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF772(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF708,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF773(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF709,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF774(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF710,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF775(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF711,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF776(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF712,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF777(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF713,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF778(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF714,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF779(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF715,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF780(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF716,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF781(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF717,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF782(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF718,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF783(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF719,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF784(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF720,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF785(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF721,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF786(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF722,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF787(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF723,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF788(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF724,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF789(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF725,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF790(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF726,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF791(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF727,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF792(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF728,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF793(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF729,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF794(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF730,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF795(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF731,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF796(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF732,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF797(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF733,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF798(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF734,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF799(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF735,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF800(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF736,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF801(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF737,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF802(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF738,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF803(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF739,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF804(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF740,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF805(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF741,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF806(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF742,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF807(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF743,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF808(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF744,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF809(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF745,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF810(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF746,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF811(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF747,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF812(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF748,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF813(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF749,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF814(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF750,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF815(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF751,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF816(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF752,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF817(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF753,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF818(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF754,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF819(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF755,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF820(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF756,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF821(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF757,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF822(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF758,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF823(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF759,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF824(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF760,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF825(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF761,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF826(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF762,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF827(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF763,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF828(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF764,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF829(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF765,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF830(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF766,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF831(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF767,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF832(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF768,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF833(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF769,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF834(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF770,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF835(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF771,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF836(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF772,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF837(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF773,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF838(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF774,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF839(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF775,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF840(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF776,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF841(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF777,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF842(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF778,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF843(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF779,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF844(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF780,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF845(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF781,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF846(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF782,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF847(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF783,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF848(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF784,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF849(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF785,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF850(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF786,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF851(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF787,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF852(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF788,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF853(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF789,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF854(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF790,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF855(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF791,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF856(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF792,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF857(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF793,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF858(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF794,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF859(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF795,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF860(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF796,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF861(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF797,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF862(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF798,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF863(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF799,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF864(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF800,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF865(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF801,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF866(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF802,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF867(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF803,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF868(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF804,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF869(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF805,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF870(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF806,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF871(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF807,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF872(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF808,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF873(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF809,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF874(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF810,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF875(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF811,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF876(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF812,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF877(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF813,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF878(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF814,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF879(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF815,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF880(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF816,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF881(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF817,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF882(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF818,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF883(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF819,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF884(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF820,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF885(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF821,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF886(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF822,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF887(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF823,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF888(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF824,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF889(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF825,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF890(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF826,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF891(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF827,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF892(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF828,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF893(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF829,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF894(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF830,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF895(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF831,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF896(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF832,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF897(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF833,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF898(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF834,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF899(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF835,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF900(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF836,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF901(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF837,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF902(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF838,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF903(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF839,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF904(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF840,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF905(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF841,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF906(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF842,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF907(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF843,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF908(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF844,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF909(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF845,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF910(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF846,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF911(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF847,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF912(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF848,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF913(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF849,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF914(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF850,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF915(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF851,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF916(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF852,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF917(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF853,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF918(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF854,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF919(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF855,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF920(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF856,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF921(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF857,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF922(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF858,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF923(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF859,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF924(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF860,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF925(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF861,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF926(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF862,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF927(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF863,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF928(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF864,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF929(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF865,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF930(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF866,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF931(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF867,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF932(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF868,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF933(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF869,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF934(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF870,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF935(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF871,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF936(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF872,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF937(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF873,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF938(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF874,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF939(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF875,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF940(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF876,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF941(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF877,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF942(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF878,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF943(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF879,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF944(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF880,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF945(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF881,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF946(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF882,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF947(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF883,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF948(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF884,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF949(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF885,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF950(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF886,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF951(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF887,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF952(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF888,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF953(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF889,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF954(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF890,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF955(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF891,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF956(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF892,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF957(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF893,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF958(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF894,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF959(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF895,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF960(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF896,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF961(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF897,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF962(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF898,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF963(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF899,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF964(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF900,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF965(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF901,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF966(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF902,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF967(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF903,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF968(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF904,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF969(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF905,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF970(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF906,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF971(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF907,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF972(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF908,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF973(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF909,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF974(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF910,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF975(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF911,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF976(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF912,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF977(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF913,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF978(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF914,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF979(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF915,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF980(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF916,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF981(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF917,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF982(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF918,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF983(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF919,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF984(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF920,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF985(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF921,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF986(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF922,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF987(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF923,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF988(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF924,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF989(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF925,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF990(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF926,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF991(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF927,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF992(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF928,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF993(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF929,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF994(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF930,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF995(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF931,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF996(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF932,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF997(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF933,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF998(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF934,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF999(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF935,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1000(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF936,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1001(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF937,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1002(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF938,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1003(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF939,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1004(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF940,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1005(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF941,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1006(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF942,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1007(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF943,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1008(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF944,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1009(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF945,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1010(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF946,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1011(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF947,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1012(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF948,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1013(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF949,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1014(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF950,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1015(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF951,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1016(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF952,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1017(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF953,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1018(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF954,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1019(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF955,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1020(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF956,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1021(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF957,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1022(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF958,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1023(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF959,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1024(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF960,f,__VA_ARGS__))
 
 #define VISIT_STRUCT_APPLY_F_(M, ...) VISIT_STRUCT_EXPAND(M(__VA_ARGS__))
 #define VISIT_STRUCT_PP_MAP(f, ...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_F_(VISIT_STRUCT_CONCAT(VISIT_STRUCT_APPLYF, VISIT_STRUCT_PP_NARG(__VA_ARGS__)), f, __VA_ARGS__))
@@ -429,6 +1675,12 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
 #define VISIT_STRUCT_MEMBER_HELPER_PAIR(MEMBER_NAME)                                               \
   std::forward<V>(visitor)(#MEMBER_NAME, std::forward<S1>(s1).MEMBER_NAME, std::forward<S2>(s2).MEMBER_NAME);
 
+#define VISIT_STRUCT_MEMBER_NAME(MEMBER_NAME)                                                      \
+  #MEMBER_NAME,
+
+#define VISIT_STRUCT_MEMBER_POINTER(MEMBER_NAME)                                                   \
+  , &this_type::MEMBER_NAME
+
 #define VISIT_STRUCT_MAKE_GETTERS(MEMBER_NAME)                                                     \
   template <typename S>                                                                            \
   static VISIT_STRUCT_CONSTEXPR auto                                                               \
@@ -437,27 +1689,11 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
     return std::forward<S>(s).MEMBER_NAME;                                                         \
   }                                                                                                \
                                                                                                    \
-  static VISIT_STRUCT_CONSTEXPR auto                                                               \
-    get_name(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                             \
-      decltype(#MEMBER_NAME) {                                                                     \
-    return #MEMBER_NAME;                                                                           \
-  }                                                                                                \
-                                                                                                   \
-  static VISIT_STRUCT_CONSTEXPR auto                                                               \
-    get_pointer(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                          \
-      decltype(&this_type::MEMBER_NAME) {                                                          \
-    return &this_type::MEMBER_NAME;                                                                \
-  }                                                                                                \
-                                                                                                   \
   static VISIT_STRUCT_CONSTEXPR auto                                                               \
     get_accessor(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                         \
       visit_struct::accessor<decltype(&this_type::MEMBER_NAME), &this_type::MEMBER_NAME > {        \
     return {};                                                                                     \
-  }                                                                                                \
-                                                                                                   \
-  static auto                                                                                      \
-    type_at(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                              \
-      visit_struct::type_c<decltype(this_type::MEMBER_NAME)>;
+  }
 
 
 // This macro specializes the trait, provides "apply" method which does the work.
@@ -527,6 +1763,28 @@ struct visitable<STRUCT_NAME, void> {
                                                                                                    \
   VISIT_STRUCT_PP_MAP(VISIT_STRUCT_MAKE_GETTERS, __VA_ARGS__)                                      \
                                                                                                    \
+  static VISIT_STRUCT_CONSTEXPR const char * const member_names[] = {                              \
+    VISIT_STRUCT_PP_MAP(VISIT_STRUCT_MEMBER_NAME, __VA_ARGS__)                                     \
+  };                                                                                               \
+                                                                                                   \
+  using members = visit_struct::member_list<nullptr                                                \
+    VISIT_STRUCT_PP_MAP(VISIT_STRUCT_MEMBER_POINTER, __VA_ARGS__)>;                                \
+                                                                                                   \
+  template <int idx>                                                                               \
+  static VISIT_STRUCT_CONSTEXPR const char * get_name(std::integral_constant<int, idx>) {          \
+    return member_names[idx];                                                                      \
+  }                                                                                                \
+                                                                                                   \
+  template <int idx>                                                                               \
+  static VISIT_STRUCT_CONSTEXPR auto get_pointer(std::integral_constant<int, idx>) ->              \
+    typename members::template at<idx>::value_type {                                               \
+    return members::template at<idx>::value;                                                       \
+  }                                                                                                \
+                                                                                                   \
+  template <int idx>                                                                               \
+  static auto type_at(std::integral_constant<int, idx>) -> visit_struct::type_c<                   \
+    visit_struct::member_type_t<typename members::template at<idx>::value_type>>;                 \
+                                                                                                   \
   static VISIT_STRUCT_CONSTEXPR const bool value = true;                                           \
 };                                                                                                 \
                                                                                                    \
@@ -0,0 +1,89 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// Views into the command-line arguments, e.g., `argv`
+//
+// The parser never copies the arguments themselves; only fields of an owning
+// type (e.g., std::string) allocate
+using tokens = std::vector<std::string_view>;
+
+// Reads the command-line arguments front to back
+//
+// The cursor does not own the arguments - it views a token list that must
+// outlive it. Moving a cursor between parsers, e.g., into the parser of a
+// sub-command and back, is O(1) however many arguments are left
+//
+// A token that expands into several tokens, e.g., `-abc` => `-a -b -c` or
+// `--foo=bar` => `--foo bar`, is split lazily: its parts are queued in front of
+// the remaining arguments instead of being inserted into the argument list, so
+// an expansion costs O(parts) regardless of how many arguments follow it
+class token_cursor {
+  const std::string_view *arguments_{nullptr};
+  std::size_t size_{0};                   // number of tokens in `arguments_`
+  std::size_t index_{0};                  // next token in `arguments_`
+  std::vector<std::string_view> pending_; // expanded tokens, next token last
+  std::size_t position_{0};               // number of tokens consumed so far
+
+public:
+  token_cursor() = default;
+
+  explicit token_cursor(const tokens &arguments, std::size_t index = 0)
+      : arguments_(arguments.data()), size_(arguments.size()), index_(index) {}
+
+  bool empty() const { return pending_.empty() && index_ >= size_; }
+
+  // Number of tokens left
+  std::size_t size() const {
+    return pending_.size() + (index_ < size_ ? size_ - index_ : 0);
+  }
+
+  // The next token; the cursor must not be empty
+  std::string_view peek() const {
+    return pending_.empty() ? arguments_[index_] : pending_.back();
+  }
+
+  // The token `offset` tokens after the next one; `offset` must be less than size()
+  std::string_view peek(std::size_t offset) const {
+    return offset < pending_.size() ? pending_[pending_.size() - 1 - offset]
+                                    : arguments_[index_ + offset - pending_.size()];
+  }
+
+  // Consume the next token
+  void advance() {
+    if (pending_.empty()) {
+      index_ += 1;
+    } else {
+      pending_.pop_back();
+    }
+    position_ += 1;
+  }
+
+  // Consume the next `count` tokens; there must be at least `count` left
+  void advance(std::size_t count) {
+    const auto expanded = std::min(count, pending_.size());
+    pending_.resize(pending_.size() - expanded);
+    index_ += count - expanded;
+    position_ += count;
+  }
+
+  // Make `token` the next token
+  void push_front(std::string_view token) { pending_.push_back(token); }
+
+  // Index of the next token in the arguments
+  // For a part of an expanded token, this is the index of the expanded token
+  std::size_t index() const { return pending_.empty() ? index_ : index_ - 1; }
+
+  // Changes whenever a token is consumed, e.g., to detect that parsing stalled
+  std::size_t position() const { return position_; }
+};
+
+} // namespace details
+
+} // namespace structopt
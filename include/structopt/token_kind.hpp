@@ -0,0 +1,138 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace structopt {
+
+namespace details {
+
+enum class token_kind : std::uint8_t {
+  literal,          // e.g., `foo.txt`, `-`
+  number,           // e.g., `42`, `-3.15`, `+2E-4`, `0x5B`, `-0b101`
+  double_dash,      // `--`
+  short_flag,       // e.g., `-v`
+  flag_cluster,     // e.g., `-abc`; could also be a single-dash long name, `-verbose`
+  long_option,      // e.g., `--verbose`
+  delimited_option, // e.g., `--foo=bar`, `-std:c++17`
+};
+
+// States of the number recognizer in classify_token
+enum class number_state : std::uint8_t {
+  start,
+  sign,            // `-`
+  zero,            // `0`, could be followed by a prefix
+  hex_prefix,      // `0x`
+  hex_digits,      // `0x5B`
+  binary_prefix,   // `0b`
+  binary_digits,   // `0b0101`
+  digits,          // `42`
+  dot,             // `.`, no digits yet
+  fraction,        // `42.` or `42.5` or `.5`
+  exponent,        // `42e`
+  exponent_sign,   // `42e-`
+  exponent_digits, // `42e-3`
+  invalid
+};
+
+constexpr bool is_decimal_digit(char c) { return c >= '0' && c <= '9'; }
+
+constexpr bool is_hex_digit(char c) {
+  return is_decimal_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+constexpr number_state next_number_state(number_state state, char c) {
+  switch (state) {
+  case number_state::start:
+    if (c == '-' || c == '+') {
+      return number_state::sign;
+    }
+    [[fallthrough]];
+  case number_state::sign:
+    if (c == '0') {
+      return number_state::zero;
+    } else if (is_decimal_digit(c)) {
+      return number_state::digits;
+    }
+    return c == '.' ? number_state::dot : number_state::invalid;
+  case number_state::zero:
+    if (c == 'x') {
+      return number_state::hex_prefix;
+    } else if (c == 'b') {
+      return number_state::binary_prefix;
+    }
+    [[fallthrough]];
+  case number_state::digits:
+    if (is_decimal_digit(c)) {
+      return number_state::digits;
+    } else if (c == '.') {
+      return number_state::fraction;
+    }
+    return c == 'e' || c == 'E' ? number_state::exponent : number_state::invalid;
+  case number_state::hex_prefix:
+  case number_state::hex_digits:
+    return is_hex_digit(c) ? number_state::hex_digits : number_state::invalid;
+  case number_state::binary_prefix:
+  case number_state::binary_digits:
+    return c == '0' || c == '1' ? number_state::binary_digits : number_state::invalid;
+  case number_state::dot:
+    return is_decimal_digit(c) ? number_state::fraction : number_state::invalid;
+  case number_state::fraction:
+    if (is_decimal_digit(c)) {
+      return number_state::fraction;
+    }
+    return c == 'e' || c == 'E' ? number_state::exponent : number_state::invalid;
+  case number_state::exponent:
+    if (c == '-' || c == '+') {
+      return number_state::exponent_sign;
+    }
+    [[fallthrough]];
+  case number_state::exponent_sign:
+  case number_state::exponent_digits:
+    return is_decimal_digit(c) ? number_state::exponent_digits : number_state::invalid;
+  default:
+    return number_state::invalid;
+  }
+}
+
+constexpr bool is_accepting(number_state state) {
+  return state == number_state::zero || state == number_state::hex_digits ||
+         state == number_state::binary_digits || state == number_state::digits ||
+         state == number_state::fraction || state == number_state::exponent_digits;
+}
+
+// Classify a command-line token in a single scan
+//
+// The scan stops as soon as the kind is known, e.g., at the first character of
+// `foo.txt` that cannot be part of a number
+constexpr token_kind classify_token(std::string_view token) {
+  const bool dash = token.size() >= 2 && token[0] == '-';
+  auto state = number_state::start;
+  for (std::size_t i = 0; i < token.size(); i++) {
+    const char c = token[i];
+    if (state != number_state::invalid) {
+      state = next_number_state(state, c);
+    }
+    if (state == number_state::invalid) {
+      if (!dash) {
+        return token_kind::literal;
+      } else if (c == '=' || c == ':') {
+        return token_kind::delimited_option;
+      }
+    }
+  }
+
+  if (is_accepting(state)) {
+    return token_kind::number;
+  } else if (!dash) {
+    return token_kind::literal;
+  } else if (token[1] == '-') {
+    return token.size() == 2 ? token_kind::double_dash : token_kind::long_option;
+  } else {
+    return token.size() == 2 ? token_kind::short_flag : token_kind::flag_cluster;
+  }
+}
+
+} // namespace details
+
+} // namespace structopt
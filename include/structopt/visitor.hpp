@@ -1,15 +1,22 @@
 
 #pragma once
 #include <algorithm>
-#include <iostream>
+#include <array>
+#include <cstddef>
 #include <optional>
+#include <ostream>
 #include <queue>
 #include <string>
 #include <string_view>
+#include <structopt/field_table.hpp>
 #include <structopt/is_specialization.hpp>
+#include <structopt/is_stl_container.hpp>
+#include <structopt/lazy_vector.hpp>
+#include <structopt/stream.hpp>
 #include <structopt/string.hpp>
 #include <structopt/third_party/visit_struct/visit_struct.hpp>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace structopt {
@@ -18,81 +25,46 @@ class app;
 
 namespace details {
 
+// Field names of a STRUCTOPT struct, grouped by kind
 struct visitor {
-  std::string name;
-  std::string version;
-  std::optional<std::string> help;
   std::vector<std::string_view> field_names;
-  std::deque<std::string_view> positional_field_names; // mutated by parser
+  std::deque<std::string_view> positional_field_names;
   std::deque<std::string_view> positional_field_names_for_help;
   std::deque<std::string_view> vector_like_positional_field_names;
   std::deque<std::string_view> flag_field_names;
   std::deque<std::string_view> optional_field_names;
   std::deque<std::string_view> nested_struct_field_names;
 
-  visitor() = default;
-
-  explicit visitor(std::string name, std::string version)
-      : name(std::move(name)), version(std::move(version)) {}
-
-  explicit visitor(std::string name, std::string version, std::string help)
-      : name(std::move(name)), version(std::move(version)),
-        help(std::move(help)) {}
-
-  // Visitor function for std::optional - could be an option or a flag
-  template <typename T>
-  inline typename std::enable_if<structopt::is_specialization<T, std::optional>::value,
-                                 void>::type
-  operator()(std::string_view name, T &) {
+  void add_field(std::string_view name, field_kind kind, bool vector_like) {
     field_names.push_back(name);
-    if constexpr (std::is_same<typename T::value_type, bool>::value) {
+    switch (kind) {
+    case field_kind::flag:
       flag_field_names.push_back(name);
-    } else {
+      break;
+    case field_kind::optional:
       optional_field_names.push_back(name);
+      break;
+    case field_kind::positional:
+      positional_field_names.push_back(name);
+      positional_field_names_for_help.push_back(name);
+      if (vector_like) {
+        // keep track of vector-like fields as these (even though positional)
+        // can be happy without any arguments
+        vector_like_positional_field_names.push_back(name);
+      }
+      break;
+    case field_kind::nested_struct:
+      nested_struct_field_names.push_back(name);
+      break;
     }
   }
 
-  // Visitor function for any positional field (not std::optional)
-  template <typename T>
-  inline typename std::enable_if<!structopt::is_specialization<T, std::optional>::value &&
-                                     !visit_struct::traits::is_visitable<T>::value,
-                                 void>::type
-  operator()(std::string_view name, T &) {
-    field_names.push_back(name);
-    positional_field_names.push_back(name);
-    positional_field_names_for_help.push_back(name);
-    if constexpr (structopt::is_specialization<T, std::deque>::value ||
-                  structopt::is_specialization<T, std::list>::value ||
-                  structopt::is_specialization<T, std::vector>::value ||
-                  structopt::is_specialization<T, std::set>::value ||
-                  structopt::is_specialization<T, std::multiset>::value ||
-                  structopt::is_specialization<T, std::unordered_set>::value ||
-                  structopt::is_specialization<T, std::unordered_multiset>::value ||
-                  structopt::is_specialization<T, std::queue>::value ||
-                  structopt::is_specialization<T, std::stack>::value ||
-                  structopt::is_specialization<T, std::priority_queue>::value) {
-      // keep track of vector-like fields as these (even though positional)
-      // can be happy without any arguments
-      vector_like_positional_field_names.push_back(name);
-    }
-  }
-
-  // Visitor function for nested structs
-  template <typename T>
-  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, void>::type
-  operator()(std::string_view name, T &) {
-    field_names.push_back(name);
-    nested_struct_field_names.push_back(name);
-  }
-
-  bool is_field_name(std::string_view field_name) {
-    return std::find(field_names.begin(), field_names.end(), field_name) !=
-           field_names.end();
-  }
-
-  void print_help(std::ostream &os) const {
-    if (help.has_value() && help.value().size() > 0) {
-      os << help.value();
+  // `name` is the name of the program (or sub-command)
+  // If `help` is not empty, it is printed instead of the generated help
+  void print_help(std::ostream &os, std::string_view name,
+                  std::string_view help = "") const {
+    if (help.size() > 0) {
+      os << help;
     } else {
       os << "\nUSAGE: " << name << " ";
 
@@ -190,6 +162,51 @@ struct visitor {
   }
 };
 
+// Containers that take any number of positional values, including none
+template <typename T>
+struct is_vector_like
+    : std::integral_constant<
+          bool, structopt::is_specialization<T, std::deque>::value ||
+                    structopt::is_specialization<T, std::list>::value ||
+                    structopt::is_specialization<T, std::vector>::value ||
+                    structopt::is_specialization<T, std::set>::value ||
+                    structopt::is_specialization<T, std::multiset>::value ||
+                    structopt::is_specialization<T, std::unordered_set>::value ||
+                    structopt::is_specialization<T, std::unordered_multiset>::value ||
+                    structopt::is_specialization<T, std::queue>::value ||
+                    structopt::is_specialization<T, std::stack>::value ||
+                    structopt::is_specialization<T, std::priority_queue>::value ||
+                    structopt::is_specialization<T, structopt::stream>::value ||
+                    structopt::is_specialization<T, structopt::lazy_vector>::value> {};
+
+template <auto... Pointers>
+constexpr std::array<bool, sizeof...(Pointers)>
+make_vector_like(visit_struct::member_list<nullptr, Pointers...>) {
+  return {{is_vector_like<visit_struct::member_type_t<decltype(Pointers)>>::value...}};
+}
+
+// The field names of `T` are collected once, on first use, and shared
+// (read-only) by every parse of `T`
+//
+// The names are read from the constexpr field table, in a loop, so that a struct
+// does not generate code per field here
+template <typename T> const visitor &schema() {
+  static const visitor result = [] {
+    using fields = field_table_of<T>;
+    static constexpr auto vector_like = make_vector_like(visit_struct::members<T>{});
+    visitor result;
+    for (std::size_t i = 0; i < fields::size; i++) {
+      result.add_field(fields::names[i], fields::kinds[i], vector_like[i]);
+    }
+
+    // add `help` and `version` optional arguments
+    result.optional_field_names.push_back("help");
+    result.optional_field_names.push_back("version");
+    return result;
+  }();
+  return result;
+}
+
 } // namespace details
 
 } // namespace structopt
@@ -12,6 +12,7 @@
  * run-time overhead.
  */
 
+#include <cstddef>
 #include <utility>
 #include <type_traits>
 
@@ -94,6 +95,62 @@ struct accessor {
   }
 };
 
+// Indexed access to the members of a visitable struct (structopt: needs C++17)
+//
+// Looking up a member was overload resolution over one overload per member. In a
+// pack, __type_pack_element finds it in constant time; the fallback is still linear
+// in the number of members, so code that visits every member expands member_list
+namespace detail {
+
+#if defined(__has_builtin)
+#  if __has_builtin(__type_pack_element)
+#    define VISIT_STRUCT_HAS_TYPE_PACK_ELEMENT
+#  endif
+#endif
+
+#ifdef VISIT_STRUCT_HAS_TYPE_PACK_ELEMENT
+template <std::size_t I, typename... Ts>
+using nth_type = __type_pack_element<I, Ts...>;
+#else
+template <std::size_t I, typename T>
+struct indexed { using type = T; };
+
+template <typename Indices, typename... Ts>
+struct indexer;
+
+template <std::size_t... I, typename... Ts>
+struct indexer<std::index_sequence<I...>, Ts...> : indexed<I, Ts>... {};
+
+template <std::size_t I, typename T>
+indexed<I, T> select(const indexed<I, T> &);
+
+template <std::size_t I, typename... Ts>
+using nth_type = typename decltype(select<I>(
+    std::declval<const indexer<std::index_sequence_for<Ts...>, Ts...> &>()))::type;
+#endif
+
+} // end namespace detail
+
+// The type of a member, from its member pointer type
+template <typename MemPtr>
+struct member_type;
+
+template <typename T, typename S>
+struct member_type<T S::*> { using type = T; };
+
+template <typename MemPtr>
+using member_type_t = typename member_type<MemPtr>::type;
+
+// The member pointers of a struct, e.g., member_list<nullptr, &S::a, &S::b>
+//
+// The leading nullptr lets a map-macro put a comma before each member. Expanding
+// `Pointers` visits every member in one instantiation
+template <std::nullptr_t, auto... Pointers>
+struct member_list {
+  template <std::size_t idx>
+  using at = detail::nth_type<idx, std::integral_constant<decltype(Pointers), Pointers>...>;
+};
+
 //
 // User-interface
 //
@@ -271,6 +328,10 @@ struct type_at_s {
 template <int idx, typename S>
 using type_at = typename type_at_s<idx, S>::type;
 
+// Get the member pointers, as a visit_struct::member_list
+template <typename S>
+using members = typename traits::visitable<traits::clean_t<S>>::members;
+
 // Get name of structure
 template <typename S>
 VISIT_STRUCT_CONSTEXPR auto get_name() ->
@@ -306,9 +367,11 @@ VISIT_STRUCT_CONSTEXPR auto get_name(S &&) -> decltype(get_name<S>()) {
 
 /*** Generated code ***/
 
-static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
-
 #define VISIT_STRUCT_EXPAND(x) x
+
+#if defined(_MSC_VER) && !defined(__clang__)
+// at most 127 macro arguments
+static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
 #define VISIT_STRUCT_PP_ARG_N( \
         _1, _2, _3, _4, _5, _6, _7, _8, _9, _10,\
         _11, _12, _13, _14, _15, _16, _17, _18, _19, _20,\
@@ -325,6 +388,217 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
         29, 28, 27, 26, 25, 24, 23, 22, 21, 20,  \
         19, 18, 17, 16, 15, 14, 13, 12, 11, 10,  \
         9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#else
+static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 1024;
+#define VISIT_STRUCT_PP_ARG_N( \
+        _1, _2, _3, _4, _5, _6, _7, _8, _9, _10,\
+        _11, _12, _13, _14, _15, _16, _17, _18, _19, _20,\
+        _21, _22, _23, _24, _25, _26, _27, _28, _29, _30,\
+        _31, _32, _33, _34, _35, _36, _37, _38, _39, _40,\
+        _41, _42, _43, _44, _45, _46, _47, _48, _49, _50,\
+        _51, _52, _53, _54, _55, _56, _57, _58, _59, _60,\
+        _61, _62, _63, _64, _65, _66, _67, _68, _69, _70,\
+        _71, _72, _73, _74, _75, _76, _77, _78, _79, _80,\
+        _81, _82, _83, _84, _85, _86, _87, _88, _89, _90,\
+        _91, _92, _93, _94, _95, _96, _97, _98, _99, _100,\
+        _101, _102, _103, _104, _105, _106, _107, _108, _109, _110,\
+        _111, _112, _113, _114, _115, _116, _117, _118, _119, _120,\
+        _121, _122, _123, _124, _125, _126, _127, _128, _129, _130,\
+        _131, _132, _133, _134, _135, _136, _137, _138, _139, _140,\
+        _141, _142, _143, _144, _145, _146, _147, _148, _149, _150,\
+        _151, _152, _153, _154, _155, _156, _157, _158, _159, _160,\
+        _161, _162, _163, _164, _165, _166, _167, _168, _169, _170,\
+        _171, _172, _173, _174, _175, _176, _177, _178, _179, _180,\
+        _181, _182, _183, _184, _185, _186, _187, _188, _189, _190,\
+        _191, _192, _193, _194, _195, _196, _197, _198, _199, _200,\
+        _201, _202, _203, _204, _205, _206, _207, _208, _209, _210,\
+        _211, _212, _213, _214, _215, _216, _217, _218, _219, _220,\
+        _221, _222, _223, _224, _225, _226, _227, _228, _229, _230,\
+        _231, _232, _233, _234, _235, _236, _237, _238, _239, _240,\
+        _241, _242, _243, _244, _245, _246, _247, _248, _249, _250,\
+        _251, _252, _253, _254, _255, _256, _257, _258, _259, _260,\
+        _261, _262, _263, _264, _265, _266, _267, _268, _269, _270,\
+        _271, _272, _273, _274, _275, _276, _277, _278, _279, _280,\
+        _281, _282, _283, _284, _285, _286, _287, _288, _289, _290,\
+        _291, _292, _293, _294, _295, _296, _297, _298, _299, _300,\
+        _301, _302, _303, _304, _305, _306, _307, _308, _309, _310,\
+        _311, _312, _313, _314, _315, _316, _317, _318, _319, _320,\
+        _321, _322, _323, _324, _325, _326, _327, _328, _329, _330,\
+        _331, _332, _333, _334, _335, _336, _337, _338, _339, _340,\
+        _341, _342, _343, _344, _345, _346, _347, _348, _349, _350,\
+        _351, _352, _353, _354, _355, _356, _357, _358, _359, _360,\
+        _361, _362, _363, _364, _365, _366, _367, _368, _369, _370,\
+        _371, _372, _373, _374, _375, _376, _377, _378, _379, _380,\
+        _381, _382, _383, _384, _385, _386, _387, _388, _389, _390,\
+        _391, _392, _393, _394, _395, _396, _397, _398, _399, _400,\
+        _401, _402, _403, _404, _405, _406, _407, _408, _409, _410,\
+        _411, _412, _413, _414, _415, _416, _417, _418, _419, _420,\
+        _421, _422, _423, _424, _425, _426, _427, _428, _429, _430,\
+        _431, _432, _433, _434, _435, _436, _437, _438, _439, _440,\
+        _441, _442, _443, _444, _445, _446, _447, _448, _449, _450,\
+        _451, _452, _453, _454, _455, _456, _457, _458, _459, _460,\
+        _461, _462, _463, _464, _465, _466, _467, _468, _469, _470,\
+        _471, _472, _473, _474, _475, _476, _477, _478, _479, _480,\
+        _481, _482, _483, _484, _485, _486, _487, _488, _489, _490,\
+        _491, _492, _493, _494, _495, _496, _497, _498, _499, _500,\
+        _501, _502, _503, _504, _505, _506, _507, _508, _509, _510,\
+        _511, _512, _513, _514, _515, _516, _517, _518, _519, _520,\
+        _521, _522, _523, _524, _525, _526, _527, _528, _529, _530,\
+        _531, _532, _533, _534, _535, _536, _537, _538, _539, _540,\
+        _541, _542, _543, _544, _545, _546, _547, _548, _549, _550,\
+        _551, _552, _553, _554, _555, _556, _557, _558, _559, _560,\
+        _561, _562, _563, _564, _565, _566, _567, _568, _569, _570,\
+        _571, _572, _573, _574, _575, _576, _577, _578, _579, _580,\
+        _581, _582, _583, _584, _585, _586, _587, _588, _589, _590,\
+        _591, _592, _593, _594, _595, _596, _597, _598, _599, _600,\
+        _601, _602, _603, _604, _605, _606, _607, _608, _609, _610,\
+        _611, _612, _613, _614, _615, _616, _617, _618, _619, _620,\
+        _621, _622, _623, _624, _625, _626, _627, _628, _629, _630,\
+        _631, _632, _633, _634, _635, _636, _637, _638, _639, _640,\
+        _641, _642, _643, _644, _645, _646, _647, _648, _649, _650,\
+        _651, _652, _653, _654, _655, _656, _657, _658, _659, _660,\
+        _661, _662, _663, _664, _665, _666, _667, _668, _669, _670,\
+        _671, _672, _673, _674, _675, _676, _677, _678, _679, _680,\
+        _681, _682, _683, _684, _685, _686, _687, _688, _689, _690,\
+        _691, _692, _693, _694, _695, _696, _697, _698, _699, _700,\
+        _701, _702, _703, _704, _705, _706, _707, _708, _709, _710,\
+        _711, _712, _713, _714, _715, _716, _717, _718, _719, _720,\
+        _721, _722, _723, _724, _725, _726, _727, _728, _729, _730,\
+        _731, _732, _733, _734, _735, _736, _737, _738, _739, _740,\
+        _741, _742, _743, _744, _745, _746, _747, _748, _749, _750,\
+        _751, _752, _753, _754, _755, _756, _757, _758, _759, _760,\
+        _761, _762, _763, _764, _765, _766, _767, _768, _769, _770,\
+        _771, _772, _773, _774, _775, _776, _777, _778, _779, _780,\
+        _781, _782, _783, _784, _785, _786, _787, _788, _789, _790,\
+        _791, _792, _793, _794, _795, _796, _797, _798, _799, _800,\
+        _801, _802, _803, _804, _805, _806, _807, _808, _809, _810,\
+        _811, _812, _813, _814, _815, _816, _817, _818, _819, _820,\
+        _821, _822, _823, _824, _825, _826, _827, _828, _829, _830,\
+        _831, _832, _833, _834, _835, _836, _837, _838, _839, _840,\
+        _841, _842, _843, _844, _845, _846, _847, _848, _849, _850,\
+        _851, _852, _853, _854, _855, _856, _857, _858, _859, _860,\
+        _861, _862, _863, _864, _865, _866, _867, _868, _869, _870,\
+        _871, _872, _873, _874, _875, _876, _877, _878, _879, _880,\
+        _881, _882, _883, _884, _885, _886, _887, _888, _889, _890,\
+        _891, _892, _893, _894, _895, _896, _897, _898, _899, _900,\
+        _901, _902, _903, _904, _905, _906, _907, _908, _909, _910,\
+        _911, _912, _913, _914, _915, _916, _917, _918, _919, _920,\
+        _921, _922, _923, _924, _925, _926, _927, _928, _929, _930,\
+        _931, _932, _933, _934, _935, _936, _937, _938, _939, _940,\
+        _941, _942, _943, _944, _945, _946, _947, _948, _949, _950,\
+        _951, _952, _953, _954, _955, _956, _957, _958, _959, _960,\
+        _961, _962, _963, _964, _965, _966, _967, _968, _969, _970,\
+        _971, _972, _973, _974, _975, _976, _977, _978, _979, _980,\
+        _981, _982, _983, _984, _985, _986, _987, _988, _989, _990,\
+        _991, _992, _993, _994, _995, _996, _997, _998, _999, _1000,\
+        _1001, _1002, _1003, _1004, _1005, _1006, _1007, _1008, _1009, _1010,\
+        _1011, _1012, _1013, _1014, _1015, _1016, _1017, _1018, _1019, _1020,\
+        _1021, _1022, _1023, _1024, N, ...) N
+#define VISIT_STRUCT_PP_NARG(...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_PP_ARG_N(__VA_ARGS__,  \
+        1024, 1023, 1022, 1021, 1020, 1019, 1018, 1017, 1016, 1015,  \
+        1014, 1013, 1012, 1011, 1010, 1009, 1008, 1007, 1006, 1005,  \
+        1004, 1003, 1002, 1001, 1000, 999, 998, 997, 996, 995,  \
+        994, 993, 992, 991, 990, 989, 988, 987, 986, 985,  \
+        984, 983, 982, 981, 980, 979, 978, 977, 976, 975,  \
+        974, 973, 972, 971, 970, 969, 968, 967, 966, 965,  \
+        964, 963, 962, 961, 960, 959, 958, 957, 956, 955,  \
+        954, 953, 952, 951, 950, 949, 948, 947, 946, 945,  \
+        944, 943, 942, 941, 940, 939, 938, 937, 936, 935,  \
+        934, 933, 932, 931, 930, 929, 928, 927, 926, 925,  \
+        924, 923, 922, 921, 920, 919, 918, 917, 916, 915,  \
+        914, 913, 912, 911, 910, 909, 908, 907, 906, 905,  \
+        904, 903, 902, 901, 900, 899, 898, 897, 896, 895,  \
+        894, 893, 892, 891, 890, 889, 888, 887, 886, 885,  \
+        884, 883, 882, 881, 880, 879, 878, 877, 876, 875,  \
+        874, 873, 872, 871, 870, 869, 868, 867, 866, 865,  \
+        864, 863, 862, 861, 860, 859, 858, 857, 856, 855,  \
+        854, 853, 852, 851, 850, 849, 848, 847, 846, 845,  \
+        844, 843, 842, 841, 840, 839, 838, 837, 836, 835,  \
+        834, 833, 832, 831, 830, 829, 828, 827, 826, 825,  \
+        824, 823, 822, 821, 820, 819, 818, 817, 816, 815,  \
+        814, 813, 812, 811, 810, 809, 808, 807, 806, 805,  \
+        804, 803, 802, 801, 800, 799, 798, 797, 796, 795,  \
+        794, 793, 792, 791, 790, 789, 788, 787, 786, 785,  \
+        784, 783, 782, 781, 780, 779, 778, 777, 776, 775,  \
+        774, 773, 772, 771, 770, 769, 768, 767, 766, 765,  \
+        764, 763, 762, 761, 760, 759, 758, 757, 756, 755,  \
+        754, 753, 752, 751, 750, 749, 748, 747, 746, 745,  \
+        744, 743, 742, 741, 740, 739, 738, 737, 736, 735,  \
+        734, 733, 732, 731, 730, 729, 728, 727, 726, 725,  \
+        724, 723, 722, 721, 720, 719, 718, 717, 716, 715,  \
+        714, 713, 712, 711, 710, 709, 708, 707, 706, 705,  \
+        704, 703, 702, 701, 700, 699, 698, 697, 696, 695,  \
+        694, 693, 692, 691, 690, 689, 688, 687, 686, 685,  \
+        684, 683, 682, 681, 680, 679, 678, 677, 676, 675,  \
+        674, 673, 672, 671, 670, 669, 668, 667, 666, 665,  \
+        664, 663, 662, 661, 660, 659, 658, 657, 656, 655,  \
+        654, 653, 652, 651, 650, 649, 648, 647, 646, 645,  \
+        644, 643, 642, 641, 640, 639, 638, 637, 636, 635,  \
+        634, 633, 632, 631, 630, 629, 628, 627, 626, 625,  \
+        624, 623, 622, 621, 620, 619, 618, 617, 616, 615,  \
+        614, 613, 612, 611, 610, 609, 608, 607, 606, 605,  \
+        604, 603, 602, 601, 600, 599, 598, 597, 596, 595,  \
+        594, 593, 592, 591, 590, 589, 588, 587, 586, 585,  \
+        584, 583, 582, 581, 580, 579, 578, 577, 576, 575,  \
+        574, 573, 572, 571, 570, 569, 568, 567, 566, 565,  \
+        564, 563, 562, 561, 560, 559, 558, 557, 556, 555,  \
+        554, 553, 552, 551, 550, 549, 548, 547, 546, 545,  \
+        544, 543, 542, 541, 540, 539, 538, 537, 536, 535,  \
+        534, 533, 532, 531, 530, 529, 528, 527, 526, 525,  \
+        524, 523, 522, 521, 520, 519, 518, 517, 516, 515,  \
+        514, 513, 512, 511, 510, 509, 508, 507, 506, 505,  \
+        504, 503, 502, 501, 500, 499, 498, 497, 496, 495,  \
+        494, 493, 492, 491, 490, 489, 488, 487, 486, 485,  \
+        484, 483, 482, 481, 480, 479, 478, 477, 476, 475,  \
+        474, 473, 472, 471, 470, 469, 468, 467, 466, 465,  \
+        464, 463, 462, 461, 460, 459, 458, 457, 456, 455,  \
+        454, 453, 452, 451, 450, 449, 448, 447, 446, 445,  \
+        444, 443, 442, 441, 440, 439, 438, 437, 436, 435,  \
+        434, 433, 432, 431, 430, 429, 428, 427, 426, 425,  \
+        424, 423, 422, 421, 420, 419, 418, 417, 416, 415,  \
+        414, 413, 412, 411, 410, 409, 408, 407, 406, 405,  \
+        404, 403, 402, 401, 400, 399, 398, 397, 396, 395,  \
+        394, 393, 392, 391, 390, 389, 388, 387, 386, 385,  \
+        384, 383, 382, 381, 380, 379, 378, 377, 376, 375,  \
+        374, 373, 372, 371, 370, 369, 368, 367, 366, 365,  \
+        364, 363, 362, 361, 360, 359, 358, 357, 356, 355,  \
+        354, 353, 352, 351, 350, 349, 348, 347, 346, 345,  \
+        344, 343, 342, 341, 340, 339, 338, 337, 336, 335,  \
+        334, 333, 332, 331, 330, 329, 328, 327, 326, 325,  \
+        324, 323, 322, 321, 320, 319, 318, 317, 316, 315,  \
+        314, 313, 312, 311, 310, 309, 308, 307, 306, 305,  \
+        304, 303, 302, 301, 300, 299, 298, 297, 296, 295,  \
+        294, 293, 292, 291, 290, 289, 288, 287, 286, 285,  \
+        284, 283, 282, 281, 280, 279, 278, 277, 276, 275,  \
+        274, 273, 272, 271, 270, 269, 268, 267, 266, 265,  \
+        264, 263, 262, 261, 260, 259, 258, 257, 256, 255,  \
+        254, 253, 252, 251, 250, 249, 248, 247, 246, 245,  \
+        244, 243, 242, 241, 240, 239, 238, 237, 236, 235,  \
+        234, 233, 232, 231, 230, 229, 228, 227, 226, 225,  \
+        224, 223, 222, 221, 220, 219, 218, 217, 216, 215,  \
+        214, 213, 212, 211, 210, 209, 208, 207, 206, 205,  \
+        204, 203, 202, 201, 200, 199, 198, 197, 196, 195,  \
+        194, 193, 192, 191, 190, 189, 188, 187, 186, 185,  \
+        184, 183, 182, 181, 180, 179, 178, 177, 176, 175,  \
+        174, 173, 172, 171, 170, 169, 168, 167, 166, 165,  \
+        164, 163, 162, 161, 160, 159, 158, 157, 156, 155,  \
+        154, 153, 152, 151, 150, 149, 148, 147, 146, 145,  \
+        144, 143, 142, 141, 140, 139, 138, 137, 136, 135,  \
+        134, 133, 132, 131, 130, 129, 128, 127, 126, 125,  \
+        124, 123, 122, 121, 120, 119, 118, 117, 116, 115,  \
+        114, 113, 112, 111, 110, 109, 108, 107, 106, 105,  \
+        104, 103, 102, 101, 100, 99, 98, 97, 96, 95,  \
+        94, 93, 92, 91, 90, 89, 88, 87, 86, 85,  \
+        84, 83, 82, 81, 80, 79, 78, 77, 76, 75,  \
+        74, 73, 72, 71, 70, 69, 68, 67, 66, 65,  \
+        64, 63, 62, 61, 60, 59, 58, 57, 56, 55,  \
+        54, 53, 52, 51, 50, 49, 48, 47, 46, 45,  \
+        44, 43, 42, 41, 40, 39, 38, 37, 36, 35,  \
+        34, 33, 32, 31, 30, 29, 28, 27, 26, 25,  \
+        24, 23, 22, 21, 20, 19, 18, 17, 16, 15,  \
+        14, 13, 12, 11, 10, 9, 8, 7, 6, 5,  \
+        4, 3, 2, 1, 0))
+#endif
 
 /* need extra level to force extra eval */
 #define VISIT_STRUCT_CONCAT_(a,b) a ## b
@@ -395,11 +669,983 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
 #define VISIT_STRUCT_APPLYF62(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62)
 #define VISIT_STRUCT_APPLYF63(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63)
 #define VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64)
-#define VISIT_STRUCT_APPLYF65(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65)
-#define VISIT_STRUCT_APPLYF66(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66)
-#define VISIT_STRUCT_APPLYF67(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,_67) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66) f(_67)
-#define VISIT_STRUCT_APPLYF68(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,_67,_68) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66) f(_67) f(_68)
-#define VISIT_STRUCT_APPLYF69(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,_67,_68,_69) f(_1) f(_2) f(_3) f(_4) f(_5) f(_6) f(_7) f(_8) f(_9) f(_10) f(_11) f(_12) f(_13) f(_14) f(_15) f(_16) f(_17) f(_18) f(_19) f(_20) f(_21) f(_22) f(_23) f(_24) f(_25) f(_26) f(_27) f(_28) f(_29) f(_30) f(_31) f(_32) f(_33) f(_34) f(_35) f(_36) f(_37) f(_38) f(_39) f(_40) f(_41) f(_42) f(_43) f(_44) f(_45) f(_46) f(_47) f(_48) f(_49) f(_50) f(_51) f(_52) f(_53) f(_54) f(_55) f(_56) f(_57) f(_58) f(_59) f(_60) f(_61) f(_62) f(_63) f(_64) f(_65) f(_66) f(_67) f(_68) f(_69)
+
+#define VISIT_STRUCT_APPLY_BLOCK1(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK2(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK3(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK4(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK5(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK6(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK7(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK8(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK9(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK10(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK11(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK12(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK13(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK14(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLY_BLOCK15(NEXT,f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,...) VISIT_STRUCT_APPLYF64(f,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))
+
+#define VISIT_STRUCT_APPLYF65(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF1,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF66(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF2,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF67(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF3,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF68(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF4,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF69(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF5,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF70(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF6,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF71(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF7,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF72(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF8,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF73(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF9,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF74(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF10,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF75(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF11,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF76(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF12,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF77(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF13,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF78(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF14,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF79(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF15,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF80(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF16,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF81(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF17,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF82(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF18,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF83(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF19,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF84(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF20,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF85(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF21,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF86(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF22,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF87(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF23,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF88(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF24,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF89(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF25,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF90(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF26,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF91(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF27,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF92(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF28,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF93(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF29,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF94(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF30,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF95(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF31,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF96(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF32,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF97(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF33,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF98(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF34,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF99(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF35,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF100(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF36,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF101(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF37,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF102(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF38,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF103(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF39,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF104(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF40,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF105(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF41,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF106(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF42,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF107(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF43,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF108(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF44,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF109(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF45,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF110(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF46,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF111(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF47,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF112(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF48,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF113(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF49,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF114(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF50,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF115(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF51,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF116(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF52,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF117(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF53,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF118(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF54,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF119(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF55,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF120(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF56,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF121(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF57,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF122(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF58,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF123(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF59,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF124(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF60,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF125(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF61,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF126(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF62,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF127(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF63,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF128(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK1(VISIT_STRUCT_APPLYF64,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF129(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF65,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF130(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF66,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF131(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF67,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF132(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF68,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF133(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF69,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF134(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF70,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF135(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF71,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF136(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF72,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF137(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF73,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF138(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF74,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF139(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF75,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF140(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF76,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF141(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF77,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF142(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF78,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF143(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF79,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF144(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF80,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF145(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF81,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF146(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF82,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF147(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF83,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF148(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF84,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF149(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF85,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF150(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF86,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF151(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF87,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF152(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF88,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF153(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF89,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF154(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF90,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF155(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF91,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF156(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF92,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF157(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF93,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF158(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF94,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF159(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF95,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF160(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF96,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF161(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF97,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF162(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF98,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF163(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF99,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF164(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF100,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF165(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF101,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF166(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF102,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF167(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF103,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF168(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF104,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF169(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF105,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF170(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF106,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF171(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF107,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF172(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF108,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF173(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF109,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF174(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF110,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF175(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF111,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF176(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF112,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF177(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF113,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF178(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF114,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF179(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF115,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF180(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF116,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF181(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF117,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF182(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF118,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF183(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF119,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF184(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF120,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF185(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF121,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF186(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF122,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF187(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF123,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF188(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF124,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF189(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF125,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF190(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF126,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF191(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF127,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF192(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK2(VISIT_STRUCT_APPLYF128,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF193(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF129,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF194(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF130,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF195(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF131,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF196(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF132,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF197(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF133,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF198(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF134,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF199(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF135,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF200(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF136,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF201(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF137,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF202(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF138,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF203(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF139,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF204(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF140,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF205(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF141,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF206(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF142,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF207(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF143,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF208(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF144,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF209(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF145,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF210(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF146,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF211(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF147,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF212(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF148,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF213(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF149,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF214(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF150,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF215(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF151,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF216(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF152,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF217(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF153,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF218(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF154,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF219(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF155,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF220(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF156,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF221(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF157,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF222(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF158,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF223(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF159,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF224(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF160,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF225(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF161,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF226(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF162,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF227(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF163,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF228(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF164,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF229(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF165,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF230(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF166,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF231(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF167,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF232(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF168,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF233(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF169,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF234(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF170,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF235(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF171,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF236(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF172,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF237(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF173,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF238(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF174,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF239(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF175,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF240(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF176,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF241(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF177,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF242(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF178,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF243(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF179,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF244(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF180,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF245(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF181,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF246(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF182,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF247(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF183,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF248(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF184,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF249(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF185,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF250(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF186,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF251(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF187,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF252(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF188,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF253(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF189,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF254(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF190,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF255(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF191,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF256(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK3(VISIT_STRUCT_APPLYF192,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF257(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF193,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF258(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF194,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF259(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF195,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF260(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF196,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF261(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF197,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF262(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF198,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF263(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF199,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF264(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF200,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF265(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF201,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF266(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF202,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF267(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF203,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF268(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF204,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF269(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF205,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF270(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF206,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF271(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF207,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF272(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF208,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF273(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF209,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF274(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF210,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF275(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF211,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF276(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF212,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF277(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF213,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF278(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF214,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF279(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF215,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF280(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF216,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF281(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF217,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF282(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF218,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF283(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF219,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF284(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF220,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF285(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF221,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF286(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF222,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF287(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF223,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF288(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF224,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF289(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF225,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF290(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF226,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF291(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF227,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF292(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF228,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF293(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF229,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF294(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF230,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF295(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF231,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF296(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF232,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF297(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF233,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF298(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF234,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF299(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF235,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF300(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF236,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF301(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF237,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF302(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF238,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF303(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF239,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF304(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF240,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF305(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF241,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF306(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF242,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF307(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF243,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF308(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF244,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF309(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF245,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF310(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF246,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF311(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF247,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF312(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF248,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF313(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF249,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF314(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF250,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF315(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF251,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF316(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF252,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF317(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF253,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF318(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF254,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF319(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF255,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF320(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK4(VISIT_STRUCT_APPLYF256,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF321(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF257,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF322(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF258,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF323(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF259,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF324(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF260,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF325(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF261,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF326(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF262,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF327(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF263,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF328(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF264,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF329(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF265,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF330(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF266,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF331(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF267,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF332(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF268,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF333(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF269,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF334(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF270,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF335(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF271,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF336(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF272,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF337(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF273,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF338(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF274,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF339(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF275,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF340(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF276,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF341(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF277,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF342(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF278,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF343(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF279,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF344(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF280,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF345(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF281,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF346(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF282,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF347(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF283,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF348(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF284,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF349(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF285,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF350(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF286,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF351(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF287,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF352(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF288,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF353(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF289,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF354(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF290,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF355(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF291,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF356(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF292,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF357(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF293,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF358(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF294,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF359(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF295,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF360(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF296,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF361(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF297,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF362(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF298,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF363(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF299,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF364(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF300,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF365(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF301,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF366(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF302,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF367(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF303,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF368(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF304,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF369(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF305,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF370(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF306,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF371(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF307,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF372(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF308,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF373(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF309,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF374(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF310,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF375(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF311,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF376(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF312,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF377(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF313,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF378(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF314,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF379(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF315,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF380(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF316,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF381(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF317,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF382(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF318,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF383(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF319,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF384(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK5(VISIT_STRUCT_APPLYF320,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF385(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF321,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF386(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF322,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF387(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF323,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF388(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF324,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF389(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF325,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF390(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF326,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF391(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF327,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF392(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF328,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF393(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF329,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF394(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF330,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF395(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF331,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF396(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF332,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF397(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF333,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF398(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF334,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF399(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF335,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF400(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF336,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF401(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF337,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF402(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF338,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF403(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF339,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF404(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF340,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF405(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF341,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF406(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF342,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF407(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF343,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF408(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF344,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF409(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF345,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF410(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF346,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF411(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF347,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF412(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF348,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF413(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF349,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF414(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF350,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF415(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF351,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF416(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF352,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF417(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF353,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF418(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF354,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF419(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF355,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF420(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF356,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF421(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF357,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF422(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF358,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF423(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF359,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF424(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF360,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF425(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF361,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF426(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF362,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF427(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF363,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF428(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF364,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF429(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF365,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF430(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF366,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF431(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF367,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF432(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF368,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF433(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF369,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF434(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF370,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF435(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF371,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF436(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF372,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF437(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF373,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF438(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF374,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF439(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF375,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF440(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF376,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF441(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF377,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF442(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF378,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF443(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF379,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF444(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF380,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF445(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF381,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF446(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF382,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF447(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF383,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF448(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK6(VISIT_STRUCT_APPLYF384,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF449(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF385,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF450(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF386,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF451(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF387,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF452(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF388,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF453(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF389,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF454(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF390,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF455(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF391,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF456(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF392,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF457(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF393,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF458(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF394,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF459(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF395,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF460(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF396,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF461(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF397,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF462(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF398,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF463(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF399,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF464(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF400,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF465(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF401,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF466(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF402,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF467(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF403,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF468(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF404,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF469(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF405,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF470(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF406,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF471(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF407,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF472(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF408,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF473(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF409,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF474(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF410,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF475(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF411,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF476(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF412,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF477(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF413,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF478(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF414,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF479(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF415,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF480(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF416,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF481(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF417,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF482(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF418,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF483(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF419,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF484(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF420,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF485(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF421,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF486(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF422,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF487(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF423,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF488(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF424,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF489(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF425,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF490(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF426,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF491(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF427,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF492(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF428,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF493(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF429,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF494(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF430,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF495(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF431,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF496(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF432,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF497(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF433,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF498(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF434,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF499(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF435,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF500(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF436,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF501(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF437,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF502(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF438,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF503(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF439,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF504(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF440,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF505(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF441,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF506(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF442,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF507(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF443,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF508(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF444,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF509(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF445,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF510(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF446,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF511(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF447,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF512(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK7(VISIT_STRUCT_APPLYF448,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF513(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF449,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF514(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF450,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF515(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF451,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF516(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF452,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF517(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF453,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF518(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF454,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF519(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF455,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF520(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF456,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF521(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF457,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF522(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF458,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF523(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF459,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF524(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF460,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF525(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF461,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF526(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF462,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF527(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF463,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF528(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF464,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF529(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF465,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF530(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF466,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF531(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF467,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF532(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF468,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF533(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF469,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF534(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF470,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF535(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF471,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF536(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF472,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF537(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF473,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF538(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF474,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF539(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF475,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF540(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF476,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF541(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF477,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF542(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF478,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF543(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF479,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF544(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF480,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF545(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF481,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF546(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF482,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF547(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF483,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF548(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF484,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF549(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF485,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF550(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF486,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF551(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF487,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF552(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF488,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF553(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF489,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF554(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF490,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF555(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF491,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF556(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF492,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF557(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF493,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF558(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF494,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF559(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF495,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF560(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF496,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF561(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF497,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF562(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF498,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF563(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF499,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF564(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF500,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF565(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF501,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF566(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF502,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF567(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF503,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF568(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF504,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF569(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF505,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF570(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF506,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF571(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF507,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF572(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF508,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF573(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF509,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF574(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF510,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF575(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF511,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF576(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK8(VISIT_STRUCT_APPLYF512,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF577(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF513,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF578(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF514,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF579(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF515,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF580(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF516,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF581(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF517,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF582(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF518,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF583(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF519,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF584(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF520,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF585(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF521,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF586(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF522,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF587(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF523,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF588(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF524,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF589(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF525,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF590(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF526,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF591(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF527,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF592(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF528,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF593(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF529,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF594(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF530,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF595(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF531,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF596(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF532,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF597(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF533,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF598(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF534,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF599(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF535,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF600(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF536,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF601(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF537,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF602(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF538,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF603(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF539,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF604(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF540,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF605(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF541,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF606(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF542,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF607(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF543,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF608(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF544,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF609(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF545,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF610(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF546,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF611(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF547,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF612(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF548,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF613(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF549,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF614(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF550,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF615(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF551,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF616(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF552,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF617(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF553,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF618(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF554,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF619(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF555,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF620(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF556,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF621(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF557,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF622(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF558,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF623(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF559,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF624(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF560,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF625(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF561,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF626(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF562,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF627(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF563,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF628(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF564,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF629(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF565,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF630(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF566,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF631(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF567,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF632(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF568,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF633(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF569,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF634(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF570,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF635(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF571,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF636(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF572,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF637(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF573,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF638(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF574,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF639(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF575,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF640(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK9(VISIT_STRUCT_APPLYF576,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF641(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF577,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF642(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF578,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF643(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF579,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF644(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF580,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF645(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF581,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF646(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF582,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF647(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF583,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF648(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF584,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF649(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF585,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF650(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF586,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF651(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF587,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF652(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF588,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF653(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF589,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF654(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF590,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF655(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF591,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF656(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF592,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF657(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF593,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF658(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF594,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF659(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF595,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF660(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF596,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF661(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF597,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF662(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF598,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF663(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF599,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF664(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF600,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF665(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF601,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF666(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF602,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF667(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF603,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF668(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF604,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF669(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF605,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF670(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF606,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF671(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF607,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF672(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF608,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF673(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF609,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF674(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF610,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF675(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF611,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF676(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF612,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF677(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF613,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF678(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF614,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF679(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF615,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF680(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF616,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF681(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF617,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF682(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF618,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF683(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF619,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF684(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF620,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF685(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF621,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF686(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF622,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF687(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF623,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF688(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF624,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF689(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF625,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF690(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF626,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF691(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF627,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF692(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF628,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF693(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF629,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF694(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF630,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF695(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF631,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF696(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF632,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF697(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF633,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF698(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF634,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF699(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF635,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF700(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF636,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF701(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF637,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF702(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF638,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF703(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF639,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF704(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK10(VISIT_STRUCT_APPLYF640,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF705(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF641,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF706(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF642,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF707(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF643,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF708(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF644,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF709(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF645,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF710(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF646,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF711(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF647,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF712(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF648,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF713(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF649,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF714(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF650,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF715(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF651,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF716(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF652,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF717(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF653,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF718(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF654,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF719(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF655,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF720(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF656,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF721(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF657,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF722(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF658,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF723(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF659,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF724(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF660,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF725(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF661,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF726(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF662,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF727(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF663,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF728(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF664,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF729(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF665,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF730(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF666,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF731(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF667,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF732(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF668,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF733(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF669,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF734(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF670,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF735(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF671,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF736(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF672,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF737(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF673,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF738(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF674,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF739(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF675,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF740(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF676,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF741(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF677,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF742(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF678,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF743(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF679,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF744(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF680,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF745(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF681,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF746(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF682,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF747(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF683,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF748(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF684,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF749(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF685,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF750(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF686,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF751(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF687,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF752(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF688,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF753(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF689,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF754(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF690,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF755(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF691,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF756(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF692,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF757(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF693,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF758(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF694,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF759(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF695,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF760(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF696,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF761(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF697,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF762(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF698,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF763(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF699,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF764(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF700,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF765(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF701,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF766(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF702,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF767(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF703,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF768(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK11(VISIT_STRUCT_APPLYF704,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF769(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF705,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF770(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF706,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF771(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF707,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF772(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF708,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF773(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF709,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF774(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF710,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF775(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF711,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF776(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF712,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF777(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF713,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF778(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF714,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF779(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF715,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF780(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF716,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF781(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF717,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF782(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF718,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF783(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF719,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF784(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF720,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF785(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF721,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF786(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF722,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF787(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF723,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF788(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF724,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF789(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF725,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF790(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF726,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF791(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF727,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF792(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF728,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF793(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF729,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF794(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF730,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF795(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF731,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF796(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF732,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF797(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF733,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF798(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF734,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF799(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF735,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF800(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF736,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF801(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF737,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF802(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF738,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF803(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF739,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF804(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF740,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF805(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF741,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF806(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF742,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF807(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF743,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF808(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF744,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF809(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF745,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF810(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF746,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF811(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF747,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF812(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF748,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF813(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF749,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF814(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF750,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF815(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF751,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF816(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF752,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF817(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF753,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF818(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF754,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF819(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF755,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF820(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF756,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF821(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF757,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF822(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF758,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF823(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF759,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF824(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF760,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF825(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF761,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF826(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF762,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF827(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF763,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF828(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF764,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF829(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF765,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF830(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF766,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF831(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF767,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF832(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK12(VISIT_STRUCT_APPLYF768,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF833(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF769,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF834(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF770,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF835(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF771,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF836(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF772,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF837(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF773,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF838(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF774,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF839(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF775,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF840(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF776,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF841(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF777,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF842(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF778,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF843(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF779,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF844(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF780,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF845(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF781,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF846(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF782,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF847(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF783,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF848(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF784,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF849(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF785,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF850(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF786,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF851(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF787,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF852(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF788,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF853(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF789,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF854(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF790,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF855(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF791,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF856(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF792,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF857(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF793,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF858(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF794,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF859(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF795,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF860(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF796,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF861(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF797,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF862(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF798,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF863(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF799,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF864(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF800,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF865(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF801,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF866(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF802,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF867(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF803,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF868(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF804,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF869(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF805,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF870(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF806,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF871(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF807,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF872(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF808,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF873(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF809,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF874(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF810,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF875(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF811,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF876(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF812,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF877(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF813,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF878(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF814,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF879(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF815,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF880(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF816,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF881(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF817,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF882(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF818,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF883(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF819,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF884(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF820,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF885(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF821,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF886(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF822,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF887(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF823,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF888(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF824,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF889(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF825,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF890(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF826,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF891(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF827,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF892(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF828,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF893(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF829,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF894(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF830,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF895(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF831,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF896(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK13(VISIT_STRUCT_APPLYF832,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF897(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF833,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF898(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF834,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF899(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF835,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF900(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF836,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF901(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF837,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF902(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF838,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF903(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF839,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF904(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF840,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF905(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF841,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF906(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF842,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF907(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF843,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF908(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF844,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF909(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF845,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF910(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF846,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF911(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF847,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF912(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF848,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF913(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF849,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF914(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF850,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF915(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF851,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF916(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF852,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF917(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF853,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF918(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF854,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF919(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF855,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF920(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF856,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF921(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF857,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF922(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF858,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF923(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF859,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF924(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF860,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF925(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF861,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF926(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF862,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF927(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF863,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF928(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF864,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF929(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF865,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF930(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF866,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF931(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF867,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF932(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF868,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF933(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF869,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF934(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF870,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF935(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF871,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF936(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF872,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF937(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF873,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF938(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF874,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF939(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF875,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF940(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF876,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF941(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF877,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF942(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF878,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF943(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF879,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF944(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF880,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF945(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF881,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF946(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF882,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF947(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF883,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF948(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF884,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF949(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF885,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF950(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF886,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF951(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF887,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF952(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF888,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF953(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF889,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF954(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF890,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF955(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF891,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF956(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF892,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF957(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF893,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF958(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF894,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF959(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF895,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF960(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK14(VISIT_STRUCT_APPLYF896,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF961(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF897,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF962(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF898,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF963(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF899,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF964(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF900,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF965(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF901,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF966(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF902,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF967(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF903,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF968(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF904,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF969(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF905,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF970(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF906,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF971(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF907,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF972(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF908,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF973(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF909,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF974(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF910,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF975(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF911,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF976(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF912,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF977(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF913,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF978(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF914,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF979(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF915,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF980(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF916,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF981(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF917,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF982(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF918,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF983(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF919,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF984(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF920,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF985(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF921,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF986(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF922,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF987(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF923,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF988(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF924,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF989(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF925,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF990(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF926,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF991(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF927,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF992(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF928,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF993(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF929,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF994(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF930,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF995(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF931,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF996(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF932,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF997(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF933,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF998(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF934,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF999(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF935,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1000(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF936,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1001(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF937,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1002(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF938,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1003(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF939,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1004(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF940,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1005(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF941,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1006(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF942,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1007(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF943,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1008(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF944,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1009(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF945,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1010(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF946,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1011(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF947,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1012(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF948,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1013(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF949,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1014(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF950,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1015(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF951,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1016(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF952,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1017(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF953,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1018(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF954,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1019(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF955,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1020(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF956,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1021(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF957,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1022(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF958,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1023(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF959,f,__VA_ARGS__))
+#define VISIT_STRUCT_APPLYF1024(f,...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_BLOCK15(VISIT_STRUCT_APPLYF960,f,__VA_ARGS__))
 
 #define VISIT_STRUCT_APPLY_F_(M, ...) VISIT_STRUCT_EXPAND(M(__VA_ARGS__))
 #define VISIT_STRUCT_PP_MAP(f, ...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_F_(VISIT_STRUCT_CONCAT(VISIT_STRUCT_APPLYF, VISIT_STRUCT_PP_NARG(__VA_ARGS__)), f, __VA_ARGS__))
@@ -429,6 +1675,12 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
 #define VISIT_STRUCT_MEMBER_HELPER_PAIR(MEMBER_NAME)                                               \
   std::forward<V>(visitor)(#MEMBER_NAME, std::forward<S1>(s1).MEMBER_NAME, std::forward<S2>(s2).MEMBER_NAME);
 
+#define VISIT_STRUCT_MEMBER_NAME(MEMBER_NAME)                                                      \
+  #MEMBER_NAME,
+
+#define VISIT_STRUCT_MEMBER_POINTER(MEMBER_NAME)                                                   \
+  , &this_type::MEMBER_NAME
+
 #define VISIT_STRUCT_MAKE_GETTERS(MEMBER_NAME)                                                     \
   template <typename S>                                                                            \
   static VISIT_STRUCT_CONSTEXPR auto                                                               \
@@ -437,27 +1689,11 @@ static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = 69;
     return std::forward<S>(s).MEMBER_NAME;                                                         \
   }                                                                                                \
                                                                                                    \
-  static VISIT_STRUCT_CONSTEXPR auto                                                               \
-    get_name(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                             \
-      decltype(#MEMBER_NAME) {                                                                     \
-    return #MEMBER_NAME;                                                                           \
-  }                                                                                                \
-                                                                                                   \
-  static VISIT_STRUCT_CONSTEXPR auto                                                               \
-    get_pointer(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                          \
-      decltype(&this_type::MEMBER_NAME) {                                                          \
-    return &this_type::MEMBER_NAME;                                                                \
-  }                                                                                                \
-                                                                                                   \
   static VISIT_STRUCT_CONSTEXPR auto                                                               \
     get_accessor(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                         \
       visit_struct::accessor<decltype(&this_type::MEMBER_NAME), &this_type::MEMBER_NAME > {        \
     return {};                                                                                     \
-  }                                                                                                \
-                                                                                                   \
-  static auto                                                                                      \
-    type_at(std::integral_constant<int, fields_enum::MEMBER_NAME>) ->                              \
-      visit_struct::type_c<decltype(this_type::MEMBER_NAME)>;
+  }
 
 
 // This macro specializes the trait, provides "apply" method which does the work.
@@ -527,6 +1763,28 @@ struct visitable<STRUCT_NAME, void> {
                                                                                                    \
   VISIT_STRUCT_PP_MAP(VISIT_STRUCT_MAKE_GETTERS, __VA_ARGS__)                                      \
                                                                                                    \
+  static VISIT_STRUCT_CONSTEXPR const char * const member_names[] = {                              \
+    VISIT_STRUCT_PP_MAP(VISIT_STRUCT_MEMBER_NAME, __VA_ARGS__)                                     \
+  };                                                                                               \
+                                                                                                   \
+  using members = visit_struct::member_list<nullptr                                                \
+    VISIT_STRUCT_PP_MAP(VISIT_STRUCT_MEMBER_POINTER, __VA_ARGS__)>;                                \
+                                                                                                   \
+  template <int idx>                                                                               \
+  static VISIT_STRUCT_CONSTEXPR const char * get_name(std::integral_constant<int, idx>) {          \
+    return member_names[idx];                                                                      \
+  }                                                                                                \
+                                                                                                   \
+  template <int idx>                                                                               \
+  static VISIT_STRUCT_CONSTEXPR auto get_pointer(std::integral_constant<int, idx>) ->              \
+    typename members::template at<idx>::value_type {                                               \
+    return members::template at<idx>::value;                                                       \
+  }                                                                                                \
+                                                                                                   \
+  template <int idx>                                                                               \
+  static auto type_at(std::integral_constant<int, idx>) -> visit_struct::type_c<                   \
+    visit_struct::member_type_t<typename members::template at<idx>::value_type>>;                 \
+                                                                                                   \
   static VISIT_STRUCT_CONSTEXPR const bool value = true;                                           \
 };                                                                                                 \
                                                                                                    \
@@ -2165,7 +3423,52 @@ inline std::string string_to_kebab(std::string_view str) {
 
 } // namespace details
 
+} // namespace structopt#pragma once
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace structopt {
+
+namespace details {
+struct parser;
+}
+
+// A positional field whose values are handed to a callback as they are parsed,
+// instead of being collected into a container, e.g.,
+//
+//   struct Options {
+//     structopt::stream<std::string> files = [](std::string file) { index(file); };
+//   };
+//
+// Values are converted like the elements of a std::vector<T> field. Memory use does
+// not grow with the number of values
+template <typename T> class stream {
+  std::function<void(T &&)> sink_;
+  std::size_t size_{0};
+
+  friend struct structopt::details::parser;
+
+public:
+  using value_type = T;
+
+  // Values are parsed, and checked, but dropped
+  stream() = default;
+
+  // `sink` is called with every value, in order
+  template <typename F, typename = typename std::enable_if<!std::is_same<
+                            typename std::decay<F>::type, stream>::value>::type>
+  stream(F &&sink) : sink_(std::forward<F>(sink)) {}
+
+  // Number of values passed to the sink by the last parse
+  std::size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+};
+
 } // namespace structopt
+
 #pragma once
 #include <string_view>
 
@@ -2273,232 +3576,3008 @@ static inline bool is_valid_number(std::string_view input) {
 } // namespace details
 
 } // namespace structopt
-
 #pragma once
-#include <algorithm>
-#include <iostream>
-#include <optional>
-#include <queue>
-#include <string>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
-// #include <structopt/is_specialization.hpp>
-// #include <structopt/string.hpp>
-// #include <structopt/third_party/visit_struct/visit_struct.hpp>
-#include <type_traits>
-#include <vector>
 
 namespace structopt {
 
-class app;
-
 namespace details {
 
-struct visitor {
-  std::string name;
-  std::string version;
-  std::optional<std::string> help;
-  std::vector<std::string_view> field_names;
-  std::deque<std::string_view> positional_field_names; // mutated by parser
-  std::deque<std::string_view> positional_field_names_for_help;
-  std::deque<std::string_view> vector_like_positional_field_names;
-  std::deque<std::string_view> flag_field_names;
-  std::deque<std::string_view> optional_field_names;
-  std::deque<std::string_view> nested_struct_field_names;
+enum class token_kind : std::uint8_t {
+  literal,          // e.g., `foo.txt`, `-`
+  number,           // e.g., `42`, `-3.15`, `+2E-4`, `0x5B`, `-0b101`
+  double_dash,      // `--`
+  short_flag,       // e.g., `-v`
+  flag_cluster,     // e.g., `-abc`; could also be a single-dash long name, `-verbose`
+  long_option,      // e.g., `--verbose`
+  delimited_option, // e.g., `--foo=bar`, `-std:c++17`
+};
 
-  visitor() = default;
+// States of the number recognizer in classify_token
+enum class number_state : std::uint8_t {
+  start,
+  sign,            // `-`
+  zero,            // `0`, could be followed by a prefix
+  hex_prefix,      // `0x`
+  hex_digits,      // `0x5B`
+  binary_prefix,   // `0b`
+  binary_digits,   // `0b0101`
+  digits,          // `42`
+  dot,             // `.`, no digits yet
+  fraction,        // `42.` or `42.5` or `.5`
+  exponent,        // `42e`
+  exponent_sign,   // `42e-`
+  exponent_digits, // `42e-3`
+  invalid
+};
 
-  explicit visitor(std::string name, std::string version)
-      : name(std::move(name)), version(std::move(version)) {}
+constexpr bool is_decimal_digit(char c) { return c >= '0' && c <= '9'; }
 
-  explicit visitor(std::string name, std::string version, std::string help)
-      : name(std::move(name)), version(std::move(version)),
-        help(std::move(help)) {}
+constexpr bool is_hex_digit(char c) {
+  return is_decimal_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
 
-  // Visitor function for std::optional - could be an option or a flag
-  template <typename T>
-  inline typename std::enable_if<structopt::is_specialization<T, std::optional>::value,
-                                 void>::type
-  operator()(std::string_view name, T &) {
-    field_names.push_back(name);
-    if constexpr (std::is_same<typename T::value_type, bool>::value) {
-      flag_field_names.push_back(name);
-    } else {
-      optional_field_names.push_back(name);
+constexpr number_state next_number_state(number_state state, char c) {
+  switch (state) {
+  case number_state::start:
+    if (c == '-' || c == '+') {
+      return number_state::sign;
+    }
+    [[fallthrough]];
+  case number_state::sign:
+    if (c == '0') {
+      return number_state::zero;
+    } else if (is_decimal_digit(c)) {
+      return number_state::digits;
+    }
+    return c == '.' ? number_state::dot : number_state::invalid;
+  case number_state::zero:
+    if (c == 'x') {
+      return number_state::hex_prefix;
+    } else if (c == 'b') {
+      return number_state::binary_prefix;
+    }
+    [[fallthrough]];
+  case number_state::digits:
+    if (is_decimal_digit(c)) {
+      return number_state::digits;
+    } else if (c == '.') {
+      return number_state::fraction;
+    }
+    return c == 'e' || c == 'E' ? number_state::exponent : number_state::invalid;
+  case number_state::hex_prefix:
+  case number_state::hex_digits:
+    return is_hex_digit(c) ? number_state::hex_digits : number_state::invalid;
+  case number_state::binary_prefix:
+  case number_state::binary_digits:
+    return c == '0' || c == '1' ? number_state::binary_digits : number_state::invalid;
+  case number_state::dot:
+    return is_decimal_digit(c) ? number_state::fraction : number_state::invalid;
+  case number_state::fraction:
+    if (is_decimal_digit(c)) {
+      return number_state::fraction;
+    }
+    return c == 'e' || c == 'E' ? number_state::exponent : number_state::invalid;
+  case number_state::exponent:
+    if (c == '-' || c == '+') {
+      return number_state::exponent_sign;
     }
+    [[fallthrough]];
+  case number_state::exponent_sign:
+  case number_state::exponent_digits:
+    return is_decimal_digit(c) ? number_state::exponent_digits : number_state::invalid;
+  default:
+    return number_state::invalid;
   }
+}
 
-  // Visitor function for any positional field (not std::optional)
-  template <typename T>
-  inline typename std::enable_if<!structopt::is_specialization<T, std::optional>::value &&
-                                     !visit_struct::traits::is_visitable<T>::value,
-                                 void>::type
-  operator()(std::string_view name, T &) {
-    field_names.push_back(name);
-    positional_field_names.push_back(name);
-    positional_field_names_for_help.push_back(name);
-    if constexpr (structopt::is_specialization<T, std::deque>::value ||
-                  structopt::is_specialization<T, std::list>::value ||
-                  structopt::is_specialization<T, std::vector>::value ||
-                  structopt::is_specialization<T, std::set>::value ||
-                  structopt::is_specialization<T, std::multiset>::value ||
-                  structopt::is_specialization<T, std::unordered_set>::value ||
-                  structopt::is_specialization<T, std::unordered_multiset>::value ||
-                  structopt::is_specialization<T, std::queue>::value ||
-                  structopt::is_specialization<T, std::stack>::value ||
-                  structopt::is_specialization<T, std::priority_queue>::value) {
-      // keep track of vector-like fields as these (even though positional)
-      // can be happy without any arguments
-      vector_like_positional_field_names.push_back(name);
-    }
-  }
-
-  // Visitor function for nested structs
-  template <typename T>
-  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, void>::type
-  operator()(std::string_view name, T &) {
-    field_names.push_back(name);
-    nested_struct_field_names.push_back(name);
-  }
+constexpr bool is_accepting(number_state state) {
+  return state == number_state::zero || state == number_state::hex_digits ||
+         state == number_state::binary_digits || state == number_state::digits ||
+         state == number_state::fraction || state == number_state::exponent_digits;
+}
 
-  bool is_field_name(std::string_view field_name) {
-    return std::find(field_names.begin(), field_names.end(), field_name) !=
-           field_names.end();
+// Classify a command-line token in a single scan
+//
+// The scan stops as soon as the kind is known, e.g., at the first character of
+// `foo.txt` that cannot be part of a number
+constexpr token_kind classify_token(std::string_view token) {
+  const bool dash = token.size() >= 2 && token[0] == '-';
+  auto state = number_state::start;
+  for (std::size_t i = 0; i < token.size(); i++) {
+    const char c = token[i];
+    if (state != number_state::invalid) {
+      state = next_number_state(state, c);
+    }
+    if (state == number_state::invalid) {
+      if (!dash) {
+        return token_kind::literal;
+      } else if (c == '=' || c == ':') {
+        return token_kind::delimited_option;
+      }
+    }
   }
 
-  void print_help(std::ostream &os) const {
-    if (help.has_value() && help.value().size() > 0) {
-      os << help.value();
-    } else {
-      os << "\nUSAGE: " << name << " ";
-
-      if (flag_field_names.empty() == false) {
-        os << "[FLAGS] ";
-      }
+  if (is_accepting(state)) {
+    return token_kind::number;
+  } else if (!dash) {
+    return token_kind::literal;
+  } else if (token[1] == '-') {
+    return token.size() == 2 ? token_kind::double_dash : token_kind::long_option;
+  } else {
+    return token.size() == 2 ? token_kind::short_flag : token_kind::flag_cluster;
+  }
+}
 
-      if (optional_field_names.empty() == false) {
-        os << "[OPTIONS] ";
-      }
+} // namespace details
 
-      if (nested_struct_field_names.empty() == false) {
-        os << "[SUBCOMMANDS] ";
-      }
+} // namespace structopt
+#pragma once
+#include <charconv>
+#include <limits>
+#include <string_view>
+// #include <structopt/is_number.hpp>
+#include <system_error>
+#include <type_traits>
 
-      for (auto &field : positional_field_names_for_help) {
-        os << field << " ";
-      }
+#if !defined(__cpp_lib_to_chars)
+// std::from_chars for floating-point types is not available
+#include <cmath>
+#include <locale>
+#include <sstream>
+#include <string>
+#endif
 
-      bool has_h = false;
-      bool has_v = false;
-      if (flag_field_names.empty() == false) {
-        os << "\n\nFLAGS:\n";
-        for (auto &flag : flag_field_names) {
+namespace structopt {
 
-          // Generate kebab case and present as flag
-          auto kebab_case = details::string_to_kebab(flag);
-          std::string long_form = "";
-          if (kebab_case != flag) {
-            long_form = kebab_case;
-          } else {
-            long_form = flag;
-          }
+namespace details {
 
-          os << "    -" << flag[0] << ", --" << flag << "\n";
+// Arithmetic types that are parsed as numbers
+// Character types are read as characters, e.g., `-c x`, and bool has its own rules
+template <typename T>
+struct is_number_type
+    : std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                       !std::is_same<T, bool>::value &&
+                                       !std::is_same<T, char>::value &&
+                                       !std::is_same<T, signed char>::value &&
+                                       !std::is_same<T, unsigned char>::value &&
+                                       !std::is_same<T, wchar_t>::value &&
+                                       !std::is_same<T, char16_t>::value &&
+                                       !std::is_same<T, char32_t>::value> {};
+
+// `.` followed by zero or more digits, e.g., the `.7` in `42.7`
+inline bool is_fractional_part(std::string_view input) {
+  return !input.empty() && input[0] == '.' &&
+         input.find_first_not_of("0123456789", 1) == std::string_view::npos;
+}
 
-          switch (flag[0]) {
-          case 'h':
-            has_h = true;
-            break;
-          case 'v':
-            has_v = true;
-            break;
-          }
-        }
-      } else {
-        os << "\n";
-      }
+// Parse an integer, e.g., `42`, `-42`, `+42`, `0x2A`, `052` or `0b101010`
+// A decimal number with a fractional part, e.g., `42.7`, is truncated to `42`
+//
+// Returns std::errc::invalid_argument if `input` is not a number (or has trailing
+// characters) and std::errc::result_out_of_range if it does not fit in `T`
+template <typename T> std::errc parse_integer(std::string_view input, T &result) {
+  bool negative = false;
+  if (!input.empty() && (input[0] == '-' || input[0] == '+')) {
+    negative = input[0] == '-';
+    input.remove_prefix(1);
+  }
 
-      if (optional_field_names.empty() == false) {
-        os << "\nOPTIONS:\n";
-        for (auto &option : optional_field_names) {
+  int base = 10;
+  if (is_hex_notation(input)) {
+    base = 16;
+    input.remove_prefix(2); // remove "0x"
+  } else if (is_binary_notation(input)) {
+    base = 2;
+    input.remove_prefix(2); // remove "0b"
+  } else if (is_octal_notation(input)) {
+    base = 8;
+    input.remove_prefix(1); // remove "0"
+  }
 
-          // Generate kebab case and present as option
-          auto kebab_case = details::string_to_kebab(option);
-          std::string long_form = "";
-          if (kebab_case != option) {
-            long_form = kebab_case;
-          } else {
-            long_form = option;
-          }
+  // Parse the magnitude; the sign is applied below
+  using unsigned_type = typename std::make_unsigned<T>::type;
+  unsigned_type magnitude{};
+  const auto last = input.data() + input.size();
+  const auto [ptr, ec] = std::from_chars(input.data(), last, magnitude, base);
+  if (ec != std::errc()) {
+    return ec;
+  }
+  if (ptr != last &&
+      !(base == 10 && is_fractional_part(std::string_view(ptr, last - ptr)))) {
+    // trailing characters, e.g., `42abc`
+    return std::errc::invalid_argument;
+  }
 
-          if ((has_v && option == "version") || (has_h && option == "help")) {
-            os << "    --" << long_form << " <" << option << ">\n";
-          } else {
-            os << "    -" << option[0] << ", --" << long_form << " <" << option << ">"
-               << "\n";
-          }
+  constexpr auto max = static_cast<unsigned_type>((std::numeric_limits<T>::max)());
+  if (!negative) {
+    if (magnitude > max) {
+      return std::errc::result_out_of_range;
+    }
+    result = static_cast<T>(magnitude);
+  } else if (magnitude == 0) {
+    result = 0;
+  } else if constexpr (std::is_unsigned<T>::value) {
+    return std::errc::result_out_of_range;
+  } else {
+    if (magnitude - 1 > max) {
+      return std::errc::result_out_of_range;
+    }
+    // -(magnitude - 1) - 1 does not overflow for the smallest value of `T`
+    result = static_cast<T>(-static_cast<T>(magnitude - 1) - 1);
+  }
+  return std::errc();
+}
 
-          switch (option[0]) {
-          case 'h':
-            has_h = true;
-            break;
-          case 'v':
-            has_v = true;
-            break;
-          }
-        }
-      }
+// Parse a floating-point number, e.g., `-3.15`, `+2.717`, `2E-4` or `.5`
+//
+// Same error reporting as parse_integer
+template <typename T> std::errc parse_floating_point(std::string_view input, T &result) {
+  // std::from_chars does not accept a leading `+`
+  if (input.size() > 1 && input[0] == '+' && input[1] != '-') {
+    input.remove_prefix(1);
+  }
 
-      if (nested_struct_field_names.empty() == false) {
-        os << "\nSUBCOMMANDS:\n";
-        for (auto &sc : nested_struct_field_names) {
-          os << "    " << sc << "\n";
-        }
-      }
+#if defined(__cpp_lib_to_chars)
+  const auto last = input.data() + input.size();
+  const auto [ptr, ec] = std::from_chars(input.data(), last, result);
+  if (ec != std::errc()) {
+    return ec;
+  }
+  if (ptr != last) {
+    // trailing characters, e.g., `1.5abc`
+    return std::errc::invalid_argument;
+  }
+  return std::errc();
+#else
+  if (input.empty() || input[0] == '+' ||
+      std::isspace(static_cast<unsigned char>(input[0]))) {
+    return std::errc::invalid_argument;
+  }
+  std::istringstream ss{std::string{input}};
+  ss.imbue(std::locale::classic());
+  T value{};
+  ss >> value;
+  if (ss.fail()) {
+    // out-of-range values are reported as the largest value of `T`
+    return std::fabs(value) == (std::numeric_limits<T>::max)()
+               ? std::errc::result_out_of_range
+               : std::errc::invalid_argument;
+  }
+  if (ss.peek() != std::char_traits<char>::eof()) {
+    // trailing characters, e.g., `1.5abc`
+    return std::errc::invalid_argument;
+  }
+  result = value;
+  return std::errc();
+#endif
+}
 
-      if (positional_field_names_for_help.empty() == false) {
-        os << "\nARGS:\n";
-        for (auto &arg : positional_field_names_for_help) {
-          os << "    " << arg << "\n";
-        }
-      }
-    }
+// Locale-independent, non-allocating conversion of `input` to a number
+template <typename T> std::errc parse_number(std::string_view input, T &result) {
+  static_assert(is_number_type<T>::value, "parse_number: unsupported type");
+  if constexpr (std::is_integral<T>::value) {
+    return parse_integer(input, result);
+  } else {
+    return parse_floating_point(input, result);
   }
-};
+}
 
 } // namespace details
 
 } // namespace structopt
-
 #pragma once
-#include <exception>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+// #include <structopt/is_specialization.hpp>
+// #include <structopt/third_party/visit_struct/visit_struct.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace structopt {
+
+namespace details {
+
+enum class field_kind : std::uint8_t { flag, optional, positional, nested_struct };
+
+template <typename T> constexpr field_kind get_field_kind() {
+  if constexpr (structopt::is_specialization<T, std::optional>::value) {
+    if constexpr (std::is_same<typename T::value_type, bool>::value) {
+      return field_kind::flag;
+    } else {
+      return field_kind::optional;
+    }
+  } else if constexpr (visit_struct::traits::is_visitable<T>::value) {
+    return field_kind::nested_struct;
+  } else {
+    return field_kind::positional;
+  }
+}
+
+// FNV-1a hash of a field name where `-` and `_` hash the same,
+// e.g., `log-level` and `log_level` refer to the same field
+constexpr std::uint32_t hash_field_name(std::string_view name) {
+  std::uint32_t hash = 2166136261u;
+  for (auto c : name) {
+    hash = (hash ^ static_cast<unsigned char>(c == '-' ? '_' : c)) * 16777619u;
+  }
+  return hash;
+}
+
+// Effectively s1.replace('-', '_') == s2.replace('-', '_')
+constexpr bool equal_field_names(std::string_view s1, std::string_view s2) {
+  if (s1.size() != s2.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < s1.size(); i++) {
+    const char c1 = s1[i] == '-' ? '_' : s1[i];
+    const char c2 = s2[i] == '-' ? '_' : s2[i];
+    if (c1 != c2) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Field indices are stored as 16-bit values to keep the tables small
+using field_index_t = std::uint16_t;
+constexpr field_index_t no_field = static_cast<field_index_t>(-1);
+
+// A set of field indices of a struct, e.g., the options given in the arguments
+using field_set = std::bitset<visit_struct::max_visitable_members>;
+
+// Smallest power of two that leaves the hash table at most half full
+constexpr std::size_t field_slot_count(std::size_t num_fields) {
+  std::size_t result = 2;
+  while (result < num_fields * 2) {
+    result *= 2;
+  }
+  return result;
+}
+
+// Open addressing (linear probing) hash table: slot => field index
+template <std::size_t Slots, std::size_t N>
+constexpr std::array<field_index_t, Slots>
+make_field_slots(const std::array<std::string_view, N> &names) {
+  std::array<field_index_t, Slots> result{};
+  for (auto &slot : result) {
+    slot = no_field;
+  }
+  for (std::size_t i = 0; i < N; i++) {
+    auto slot = hash_field_name(names[i]) & (Slots - 1);
+    while (result[slot] != no_field) {
+      slot = (slot + 1) & (Slots - 1);
+    }
+    result[slot] = static_cast<field_index_t>(i);
+  }
+  return result;
+}
+
+// First character => index of the first field (of one of the given kinds)
+// that starts with that character
+template <std::size_t N>
+constexpr std::array<field_index_t, 256>
+make_short_names(const std::array<std::string_view, N> &names,
+                 const std::array<field_kind, N> &kinds, bool flags, bool options,
+                 bool others) {
+  std::array<field_index_t, 256> result{};
+  for (auto &entry : result) {
+    entry = no_field;
+  }
+  for (std::size_t i = 0; i < N; i++) {
+    const bool included = (kinds[i] == field_kind::flag && flags) ||
+                          (kinds[i] == field_kind::optional && options) ||
+                          (kinds[i] != field_kind::flag &&
+                           kinds[i] != field_kind::optional && others);
+    const auto c = static_cast<unsigned char>(names[i][0]);
+    if (included && result[c] == no_field) {
+      result[c] = static_cast<field_index_t>(i);
+    }
+  }
+  return result;
+}
+
+// Compile-time lookup table of the fields of a STRUCTOPT struct
+//
+// Resolving a (long, kebab-case or short) name to a field index is a constant-time
+// table lookup and never allocates
+struct field_table {
+  std::size_t size;
+  const std::string_view *names;
+  const field_kind *kinds;
+  const field_index_t *slots;
+  std::size_t slot_mask;
+  const field_index_t *short_names;          // any field
+  const field_index_t *short_flag_or_option; // flags and options
+  const field_index_t *short_option;         // options, not flags
+
+  // `log_level` or `log-level` => index of `log_level`
+  constexpr field_index_t find(std::string_view name) const {
+    auto slot = hash_field_name(name) & slot_mask;
+    while (slots[slot] != no_field) {
+      if (equal_field_names(names[slots[slot]], name)) {
+        return slots[slot];
+      }
+      slot = (slot + 1) & slot_mask;
+    }
+    return no_field;
+  }
+
+  // `-log-level`, `--log_level`, etc. => index of `log_level`
+  constexpr field_index_t find_long(std::string_view next) const {
+    if (next.size() > 1 && next[0] == '-') {
+      // remove up to two leading dashes
+      next.remove_prefix(next[1] == '-' ? 2 : 1);
+      return find(next);
+    }
+    return no_field;
+  }
+
+  // `-l` => index of the first field that starts with `l`
+  constexpr field_index_t find_short(std::string_view next,
+                                     const field_index_t *table) const {
+    if (next.size() == 2 && next[0] == '-') {
+      return table[static_cast<unsigned char>(next[1])];
+    }
+    return no_field;
+  }
+
+  constexpr bool is_flag_or_option(field_index_t index) const {
+    return kinds[index] == field_kind::flag || kinds[index] == field_kind::optional;
+  }
+};
+
+template <typename T, std::size_t... I>
+constexpr std::array<std::string_view, sizeof...(I)>
+make_field_names(std::index_sequence<I...>) {
+  return {{std::string_view(visit_struct::get_name<I, T>())...}};
+}
+
+// Expands the member pointers of the struct at once, rather than looking up each
+// field by index, which is linear in the number of fields on some compilers
+template <auto... Pointers>
+constexpr std::array<field_kind, sizeof...(Pointers)>
+make_field_kinds(visit_struct::member_list<nullptr, Pointers...>) {
+  return {{get_field_kind<visit_struct::member_type_t<decltype(Pointers)>>()...}};
+}
+
+template <typename T> struct field_table_of {
+  static constexpr std::size_t size = visit_struct::field_count<T>();
+  static constexpr std::size_t slot_count = field_slot_count(size);
+
+  static constexpr auto names = make_field_names<T>(std::make_index_sequence<size>{});
+  static constexpr auto kinds = make_field_kinds(visit_struct::members<T>{});
+  static constexpr auto slots = make_field_slots<slot_count>(names);
+  static constexpr auto short_names = make_short_names(names, kinds, true, true, true);
+  static constexpr auto short_flag_or_option =
+      make_short_names(names, kinds, true, true, false);
+  static constexpr auto short_option = make_short_names(names, kinds, false, true, false);
+
+  static constexpr field_table value{size,
+                                     names.data(),
+                                     kinds.data(),
+                                     slots.data(),
+                                     slot_count - 1,
+                                     short_names.data(),
+                                     short_flag_or_option.data(),
+                                     short_option.data()};
+};
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// `num_threads`, or one thread per core if 0
+inline std::size_t resolve_thread_count(std::size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return num_threads;
+}
+
+// Calls `f(i)` for every `i` in [0, count) on up to `num_threads` threads, the
+// calling thread included
+//
+// Indices are handed out one at a time through a shared counter, so `f` should do
+// a block of work per index. The first exception thrown by `f` is rethrown once
+// every thread has finished. If a thread cannot be started, the threads that were
+// started and the calling thread do the rest
+template <typename F>
+void parallel_for(std::size_t count, std::size_t num_threads, F &&f) {
+  num_threads = std::min(resolve_thread_count(num_threads), count);
+  if (num_threads <= 1) {
+    for (std::size_t i = 0; i < count; i++) {
+      f(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::exception_ptr exception;
+  std::atomic_flag exception_stored = ATOMIC_FLAG_INIT;
+  const auto worker = [&] {
+    try {
+      for (auto i = next++; i < count; i = next++) {
+        f(i);
+      }
+    } catch (...) {
+      // e.g., std::bad_alloc, or a throwing operator>> of a field type
+      if (!exception_stored.test_and_set()) {
+        exception = std::current_exception();
+      }
+      next = count;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  try {
+    threads.reserve(num_threads - 1);
+    for (std::size_t i = 1; i < num_threads; i++) {
+      threads.emplace_back(worker);
+    }
+  } catch (...) {
+    // e.g., std::system_error when the process is out of threads; the started
+    // threads must still be joined, so carry on with fewer
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+// #include <structopt/parallel_for.hpp>
+// #include <structopt/parse_number.hpp>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+struct parser;
+}
+
+// A vector field whose elements are converted when they are first accessed
+//
+// Parsing only copies the text of the values, back to back in one buffer. An
+// element is converted by the first operator[] or at() that reads it, or by
+// materialize(), which converts the remaining elements on several threads.
+// Invalid values are reported on access: std::invalid_argument, or std::out_of_range
+// for numbers that do not fit in a `T`
+//
+// Converting on access writes to the vector; call materialize() before reading
+// the same lazy_vector from several threads
+template <typename T> class lazy_vector {
+  static_assert(details::is_number_type<T>::value || std::is_same<T, std::string>::value,
+                "structopt::lazy_vector<T> supports numbers and std::string");
+
+  std::string text_;              // the values, back to back
+  std::vector<std::size_t> ends_; // end of each value in `text_`
+  std::string_view name_;         // of the field, for error messages
+  mutable std::vector<T> values_;
+  mutable std::vector<std::uint8_t> converted_;
+
+  friend struct structopt::details::parser;
+
+  void reserve(std::size_t size, std::size_t text_size) {
+    ends_.reserve(size);
+    text_.reserve(text_size);
+  }
+
+  void push_back(std::string_view token) {
+    text_.append(token);
+    ends_.push_back(text_.size());
+  }
+
+  void convert(std::size_t i) const {
+    const auto input = token(i);
+    if constexpr (std::is_same<T, std::string>::value) {
+      values_[i].assign(input);
+    } else {
+      const auto ec = details::parse_number(input, values_[i]);
+      if (ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("Error: failed to parse numeric argument `" +
+                                std::string(name_) + "`. `" + std::string(input) +
+                                "` is out of range.");
+      } else if (ec != std::errc()) {
+        throw std::invalid_argument("Error: failed to parse numeric argument `" +
+                                    std::string(name_) + "`. `" + std::string(input) +
+                                    "` is invalid.");
+      }
+    }
+    converted_[i] = 1;
+  }
+
+  static void lower_to(std::atomic<std::size_t> &minimum, std::size_t value) {
+    auto current = minimum.load();
+    while (value < current && !minimum.compare_exchange_weak(current, value)) {
+    }
+  }
+
+  void allocate() const {
+    if (values_.size() != ends_.size()) {
+      values_.resize(ends_.size());
+      converted_.assign(ends_.size(), 0);
+    }
+  }
+
+public:
+  using value_type = T;
+
+  std::size_t size() const { return ends_.size(); }
+
+  bool empty() const { return ends_.empty(); }
+
+  // The text of element `i`, not converted
+  std::string_view token(std::size_t i) const {
+    const auto begin = i == 0 ? 0 : ends_[i - 1];
+    return std::string_view(text_).substr(begin, ends_[i] - begin);
+  }
+
+  const T &operator[](std::size_t i) const {
+    allocate();
+    if (!converted_[i]) {
+      convert(i);
+    }
+    return values_[i];
+  }
+
+  const T &at(std::size_t i) const {
+    if (i >= size()) {
+      throw std::out_of_range("structopt::lazy_vector::at");
+    }
+    return (*this)[i];
+  }
+
+  // Convert every element not converted yet, on `num_threads` threads (0 = one per
+  // core). Throws for the first invalid element, after converting the others
+  const lazy_vector &materialize(std::size_t num_threads = 0) const {
+    allocate();
+    constexpr std::size_t block_size = 4096;
+    std::atomic<std::size_t> first_invalid{size()};
+    details::parallel_for(
+        (size() + block_size - 1) / block_size, num_threads, [&](std::size_t block) {
+          const auto last = std::min(size(), (block + 1) * block_size);
+          for (auto i = block * block_size; i < last; i++) {
+            if (converted_[i]) {
+              continue;
+            }
+            try {
+              convert(i);
+            } catch (const std::logic_error &) {
+              // std::invalid_argument or std::out_of_range
+              lower_to(first_invalid, i);
+            }
+          }
+        });
+    if (first_invalid < size()) {
+      // throws again
+      convert(first_invalid);
+    }
+    return *this;
+  }
+
+  // Every element, converted
+  const std::vector<T> &values(std::size_t num_threads = 0) const {
+    return materialize(num_threads).values_;
+  }
+};
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// Views into the command-line arguments, e.g., `argv`
+//
+// The parser never copies the arguments themselves; only fields of an owning
+// type (e.g., std::string) allocate
+using tokens = std::vector<std::string_view>;
+
+// Reads the command-line arguments front to back
+//
+// The cursor does not own the arguments - it views a token list that must
+// outlive it. Moving a cursor between parsers, e.g., into the parser of a
+// sub-command and back, is O(1) however many arguments are left
+//
+// A token that expands into several tokens, e.g., `-abc` => `-a -b -c` or
+// `--foo=bar` => `--foo bar`, is split lazily: its parts are queued in front of
+// the remaining arguments instead of being inserted into the argument list, so
+// an expansion costs O(parts) regardless of how many arguments follow it
+class token_cursor {
+  const std::string_view *arguments_{nullptr};
+  std::size_t size_{0};                   // number of tokens in `arguments_`
+  std::size_t index_{0};                  // next token in `arguments_`
+  std::vector<std::string_view> pending_; // expanded tokens, next token last
+  std::size_t position_{0};               // number of tokens consumed so far
+
+public:
+  token_cursor() = default;
+
+  explicit token_cursor(const tokens &arguments, std::size_t index = 0)
+      : arguments_(arguments.data()), size_(arguments.size()), index_(index) {}
+
+  bool empty() const { return pending_.empty() && index_ >= size_; }
+
+  // Number of tokens left
+  std::size_t size() const {
+    return pending_.size() + (index_ < size_ ? size_ - index_ : 0);
+  }
+
+  // The next token; the cursor must not be empty
+  std::string_view peek() const {
+    return pending_.empty() ? arguments_[index_] : pending_.back();
+  }
+
+  // The token `offset` tokens after the next one; `offset` must be less than size()
+  std::string_view peek(std::size_t offset) const {
+    return offset < pending_.size() ? pending_[pending_.size() - 1 - offset]
+                                    : arguments_[index_ + offset - pending_.size()];
+  }
+
+  // Consume the next token
+  void advance() {
+    if (pending_.empty()) {
+      index_ += 1;
+    } else {
+      pending_.pop_back();
+    }
+    position_ += 1;
+  }
+
+  // Consume the next `count` tokens; there must be at least `count` left
+  void advance(std::size_t count) {
+    const auto expanded = std::min(count, pending_.size());
+    pending_.resize(pending_.size() - expanded);
+    index_ += count - expanded;
+    position_ += count;
+  }
+
+  // Make `token` the next token
+  void push_front(std::string_view token) { pending_.push_back(token); }
+
+  // Index of the next token in the arguments
+  // For a part of an expanded token, this is the index of the expanded token
+  std::size_t index() const { return pending_.empty() ? index_ : index_ - 1; }
+
+  // Changes whenever a token is consumed, e.g., to detect that parsing stalled
+  std::size_t position() const { return position_; }
+};
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+// #include <structopt/parallel_for.hpp>
+// #include <structopt/token_cursor.hpp>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace structopt {
+
+namespace details {
+
+// Identifies a file independent of the path used to open it
+struct file_id {
+  std::uint64_t device{0};
+  std::uint64_t inode{0};
+
+  bool operator==(const file_id &other) const {
+    return device == other.device && inode == other.inode;
+  }
+};
+
+// A regular file mapped into memory, copy-on-write
+//
+// The mapping is writable, but writes are private: they never reach the file.
+// Only the pages that are written to are copied
+class mapped_file {
+  char *data_{nullptr};
+  std::size_t size_{0};
+  file_id id_;
+  bool is_open_{false};
+
+public:
+  mapped_file() = default;
+
+  // Not open if `path` is not a regular file that can be read
+  explicit mapped_file(const std::string &path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      return;
+    }
+    BY_HANDLE_FILE_INFORMATION info;
+    if (GetFileInformationByHandle(file, &info) &&
+        !(info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+      id_ = {info.dwVolumeSerialNumber,
+             (std::uint64_t(info.nFileIndexHigh) << 32) | info.nFileIndexLow};
+      size_ = static_cast<std::size_t>((std::uint64_t(info.nFileSizeHigh) << 32) |
+                                       info.nFileSizeLow);
+      is_open_ = true;
+      if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping) {
+          data_ = static_cast<char *>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+          CloseHandle(mapping);
+        }
+        if (!data_) {
+          is_open_ = false;
+          size_ = 0;
+        }
+      }
+    }
+    CloseHandle(file);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat status;
+    if (::fstat(fd, &status) == 0 && S_ISREG(status.st_mode)) {
+      id_ = {static_cast<std::uint64_t>(status.st_dev),
+             static_cast<std::uint64_t>(status.st_ino)};
+      size_ = static_cast<std::size_t>(status.st_size);
+      is_open_ = true;
+      if (size_ > 0) {
+        void *data = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+          // read front to back, exactly once
+          ::madvise(data, size_, MADV_SEQUENTIAL);
+          data_ = static_cast<char *>(data);
+        } else {
+          is_open_ = false;
+          size_ = 0;
+        }
+      }
+    }
+    ::close(fd);
+#endif
+  }
+
+  mapped_file(const mapped_file &) = delete;
+  mapped_file &operator=(const mapped_file &) = delete;
+
+  mapped_file(mapped_file &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+        id_(other.id_), is_open_(std::exchange(other.is_open_, false)) {}
+
+  mapped_file &operator=(mapped_file &&other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(id_, other.id_);
+    std::swap(is_open_, other.is_open_);
+    return *this;
+  }
+
+  ~mapped_file() {
+    if (data_) {
+#ifdef _WIN32
+      UnmapViewOfFile(data_);
+#else
+      ::munmap(data_, size_);
+#endif
+    }
+  }
+
+  bool is_open() const { return is_open_; }
+  char *data() const { return data_; }
+  std::size_t size() const { return size_; }
+  const file_id &id() const { return id_; }
+};
+
+inline bool is_response_file_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Splits `[begin, end)` into raw arguments, i.e., with their quotes and escapes, and
+// calls `on_argument(argument_begin, argument_end, is_quoted)` for each, in order
+//
+// Arguments are separated by whitespace. Single or double quotes group whitespace
+// into an argument and a backslash escapes the next character, also inside quotes
+// - the rules of GCC response files. `is_quoted` is true if the argument has quotes
+// or escapes to remove, see unquote_response_file_argument
+//
+// Returns false if `[begin, end)` ends inside quotes or right after a backslash,
+// i.e., if `end` would not end the last argument of a longer file. Nothing is written
+template <typename F>
+bool split_response_file(char *begin, char *end, F &&on_argument) {
+  char *in = begin;
+  while (true) {
+    while (in != end && is_response_file_space(*in)) {
+      ++in;
+    }
+    if (in == end) {
+      return true;
+    }
+
+    char *const argument = in;
+    bool is_quoted = false;
+    bool is_escaped = false; // ends with an unpaired backslash
+    char quote = 0;
+    for (; in != end; ++in) {
+      const char c = *in;
+      if (c == '\\') {
+        is_quoted = true;
+        if (in + 1 == end) {
+          is_escaped = true;
+        } else {
+          ++in;
+        }
+      } else if (quote) {
+        if (c == quote) {
+          quote = 0;
+        }
+      } else if (c == '\'' || c == '"') {
+        is_quoted = true;
+        quote = c;
+      } else if (is_response_file_space(c)) {
+        break;
+      }
+    }
+    on_argument(argument, in, is_quoted);
+    if (quote || is_escaped) {
+      return false;
+    }
+  }
+}
+
+// Removes the quotes and escapes of a raw argument in place
+//
+// The argument only gets shorter, so it is written over itself
+inline std::string_view unquote_response_file_argument(char *begin, char *end) {
+  char *out = begin;
+  char quote = 0;
+  for (char *in = begin; in != end; ++in) {
+    const char c = *in;
+    if (c == '\\' && in + 1 != end) {
+      // escaped character
+      ++in;
+    } else if (quote) {
+      if (c == quote) {
+        quote = 0;
+        continue;
+      }
+    } else if (c == '\'' || c == '"') {
+      quote = c;
+      continue;
+    }
+    *out++ = *in;
+  }
+  return {begin, static_cast<std::size_t>(out - begin)};
+}
+
+inline std::string_view make_response_file_argument(char *begin, char *end,
+                                                    bool is_quoted) {
+  return is_quoted ? unquote_response_file_argument(begin, end)
+                   : std::string_view(begin, static_cast<std::size_t>(end - begin));
+}
+
+// Where a response file includes itself, directly or through other response files
+struct response_file_cycle {
+  std::size_t token_index; // of the outermost `@file` argument
+  std::string_view token;  // the `@file` argument that closes the cycle
+};
+
+// The response files of a parse
+//
+// Arguments read from a response file are views into its mapping; they are valid
+// as long as this object is. Paths are relative to the working directory
+class response_files {
+  std::vector<mapped_file> files_;
+  std::vector<file_id> expanding_; // files being expanded, outermost first
+  std::size_t num_threads_;
+  std::size_t parallel_threshold_;
+
+  static bool is_response_file_argument(std::string_view argument) {
+    return argument.size() > 1 && argument[0] == '@';
+  }
+
+  // Appends `argument`, or the arguments of `argument` if it is `@path`
+  bool append_argument(std::string_view argument, tokens &result,
+                       std::string_view &cycle) {
+    if (is_response_file_argument(argument)) {
+      return expand_argument(argument, result, cycle);
+    }
+    result.push_back(argument);
+    return true;
+  }
+
+  // Appends the arguments of `@path` to `result`; `argument` itself if `path`
+  // cannot be read. False on a cycle, with `cycle` set to the offending argument
+  bool expand_argument(std::string_view argument, tokens &result,
+                       std::string_view &cycle) {
+    mapped_file file{std::string(argument.substr(1))};
+    if (!file.is_open()) {
+      // e.g., an email address or a file that does not exist
+      result.push_back(argument);
+      return true;
+    }
+    for (const auto &id : expanding_) {
+      if (id == file.id()) {
+        cycle = argument;
+        return false;
+      }
+    }
+    expanding_.push_back(file.id());
+    // the mapping stays put when `files_` grows
+    char *const begin = file.data();
+    char *const end = begin + file.size();
+    files_.push_back(std::move(file));
+
+    bool success = true;
+    const auto size = static_cast<std::size_t>(end - begin);
+    if (resolve_thread_count(num_threads_) > 1 && size >= parallel_threshold_) {
+      success = split_in_parallel(begin, end, result, cycle);
+    } else {
+      split_response_file(begin, end, [&](char *first, char *last, bool is_quoted) {
+        if (success) {
+          success = append_argument(make_response_file_argument(first, last, is_quoted),
+                                    result, cycle);
+        }
+      });
+    }
+    expanding_.pop_back();
+    return success;
+  }
+
+  // Splits a large response file on several threads
+  //
+  // The file is cut into chunks at whitespace, and each chunk is split as if it
+  // started outside of quotes. Chunks are counted in parallel, a chunk that started
+  // inside quotes after all is merged into the one before it, and then the
+  // arguments of every chunk are written to their place in `result` in parallel
+  bool split_in_parallel(char *begin, char *end, tokens &result,
+                         std::string_view &cycle) {
+    const auto num_threads = resolve_thread_count(num_threads_);
+    const auto size = static_cast<std::size_t>(end - begin);
+
+    // Several chunks per thread, in case some are slower
+    std::vector<char *> boundaries{begin};
+    const std::size_t num_chunks = num_threads * 4;
+    for (std::size_t i = 1; i < num_chunks; i++) {
+      char *boundary = std::max(begin + size / num_chunks * i, boundaries.back());
+      while (boundary != end && !is_response_file_space(*boundary)) {
+        ++boundary;
+      }
+      if (boundary != end && boundary != boundaries.back()) {
+        boundaries.push_back(boundary);
+      }
+    }
+    boundaries.push_back(end);
+
+    struct chunk {
+      char *begin;
+      char *end;
+      std::size_t num_arguments;
+      bool ends_outside_quotes;
+    };
+    std::vector<chunk> chunks(boundaries.size() - 1);
+    const auto count_arguments = [](chunk &c) {
+      c.num_arguments = 0;
+      c.ends_outside_quotes =
+          split_response_file(c.begin, c.end, [&c](char *, char *, bool) {
+            c.num_arguments += 1;
+          });
+    };
+    parallel_for(chunks.size(), num_threads, [&](std::size_t i) {
+      chunks[i] = {boundaries[i], boundaries[i + 1], 0, true};
+      count_arguments(chunks[i]);
+    });
+
+    // The first chunk starts outside of quotes. So does every chunk after one
+    // that ends outside of quotes
+    std::vector<chunk> merged{chunks.front()};
+    for (std::size_t i = 1; i < chunks.size(); i++) {
+      if (merged.back().ends_outside_quotes) {
+        merged.push_back(chunks[i]);
+      } else {
+        merged.back().end = chunks[i].end;
+        count_arguments(merged.back());
+      }
+    }
+
+    std::vector<std::size_t> offsets{result.size()};
+    for (const auto &c : merged) {
+      offsets.push_back(offsets.back() + c.num_arguments);
+    }
+    const auto first = result.size();
+    result.resize(offsets.back());
+    parallel_for(merged.size(), num_threads, [&](std::size_t i) {
+      auto out = result.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+      split_response_file(merged[i].begin, merged[i].end,
+                          [&out](char *first, char *last, bool is_quoted) {
+                            *out++ = make_response_file_argument(first, last, is_quoted);
+                          });
+    });
+
+    // Response files in the response file, if any
+    const auto nested = std::find_if(result.begin() + static_cast<std::ptrdiff_t>(first),
+                                     result.end(), is_response_file_argument);
+    if (nested != result.end()) {
+      tokens rest(nested, result.end());
+      result.erase(nested, result.end());
+      for (const auto &argument : rest) {
+        if (!append_argument(argument, result, cycle)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+public:
+  // Response files of at least `parallel_threshold` bytes are split on
+  // `num_threads` threads (0 = one per core)
+  explicit response_files(std::size_t num_threads = 1,
+                          std::size_t parallel_threshold = std::size_t(4) << 20)
+      : num_threads_(num_threads), parallel_threshold_(parallel_threshold) {}
+
+  // Replaces every `@path` argument, but the program name, with the arguments in
+  // the file `path`. Response files may refer to other response files
+  std::optional<response_file_cycle> expand(tokens &arguments) {
+    std::size_t first = 1;
+    while (first < arguments.size() && !is_response_file_argument(arguments[first])) {
+      first += 1;
+    }
+    if (first >= arguments.size()) {
+      // nothing to expand
+      return std::nullopt;
+    }
+
+    tokens result(arguments.begin(), arguments.begin() + first);
+    for (std::size_t i = first; i < arguments.size(); i++) {
+      std::string_view cycle;
+      if (!append_argument(arguments[i], result, cycle)) {
+        return response_file_cycle{i, cycle};
+      }
+    }
+    arguments = std::move(result);
+    return std::nullopt;
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace structopt {
+
+namespace details {
+
+// Reads delimited records from a file descriptor, e.g., the output of
+// `find . -print0` or `ls` on stdin
+//
+// The input is read in large blocks into one buffer, and every record is a view into
+// that buffer - no allocation per record. A record is valid until the next call to
+// next(). The buffer holds `buffer_size` bytes, or the longest record if that is
+// longer, however long the input is
+//
+// Empty records are skipped. With '\n' as the delimiter, a trailing '\r' is removed
+class record_reader {
+  int fd_;
+  char delimiter_;
+  std::vector<char> buffer_;
+  std::size_t begin_{0}; // first byte of the next record
+  std::size_t scan_{0};  // bytes before `scan_` have no delimiter
+  std::size_t end_{0};   // end of the data read so far
+  bool end_of_input_{false};
+  bool failed_{false};
+
+  // Read more of the input after the data in the buffer
+  void fill() {
+    if (begin_ > 0) {
+      // drop the records that have been read
+      std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+      scan_ -= begin_;
+      end_ -= begin_;
+      begin_ = 0;
+    }
+    if (end_ == buffer_.size()) {
+      // a record longer than the buffer
+      buffer_.resize(buffer_.size() * 2);
+    }
+    while (true) {
+#ifdef _WIN32
+      const auto count = ::_read(fd_, buffer_.data() + end_,
+                                 static_cast<unsigned>(buffer_.size() - end_));
+#else
+      const auto count = ::read(fd_, buffer_.data() + end_, buffer_.size() - end_);
+#endif
+      if (count > 0) {
+        end_ += static_cast<std::size_t>(count);
+      } else if (count < 0 && errno == EINTR) {
+        continue;
+      } else {
+        end_of_input_ = true;
+        failed_ = count < 0;
+      }
+      return;
+    }
+  }
+
+  std::string_view record(std::size_t first, std::size_t last) const {
+    if (delimiter_ == '\n' && last > first && buffer_[last - 1] == '\r') {
+      last -= 1;
+    }
+    return {buffer_.data() + first, last - first};
+  }
+
+public:
+  record_reader(int fd, char delimiter, std::size_t buffer_size = 1 << 18)
+      : fd_(fd), delimiter_(delimiter), buffer_(buffer_size > 0 ? buffer_size : 1) {}
+
+  // The next record; nothing at the end of the input, or if reading failed
+  std::optional<std::string_view> next() {
+    while (true) {
+      const auto found = static_cast<const char *>(
+          std::memchr(buffer_.data() + scan_, delimiter_, end_ - scan_));
+      if (found) {
+        const auto first = begin_;
+        const auto last = static_cast<std::size_t>(found - buffer_.data());
+        begin_ = scan_ = last + 1;
+        const auto result = record(first, last);
+        if (!result.empty()) {
+          return result;
+        }
+      } else if (!end_of_input_) {
+        scan_ = end_;
+        fill();
+      } else if (begin_ < end_) {
+        // the last record has no delimiter
+        const auto first = begin_;
+        begin_ = scan_ = end_;
+        const auto result = record(first, end_);
+        if (!result.empty()) {
+          return result;
+        }
+      } else {
+        return std::nullopt;
+      }
+    }
+  }
+
+  // Whether reading the input failed, as opposed to reaching its end
+  bool failed() const { return failed_; }
+};
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+// #include <structopt/field_table.hpp>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <stdlib.h>
+#elif defined(__APPLE__)
+#include <crt_externs.h>
+#else
+#include <unistd.h>
+extern "C" {
+extern char **environ;
+}
+#endif
+
+namespace structopt {
+
+namespace details {
+
+// The environment of the process, `NAME=value` entries ending with a null pointer
+inline char **process_environment() {
+#ifdef _WIN32
+  return _environ;
+#elif defined(__APPLE__)
+  return *_NSGetEnviron();
+#else
+  return environ;
+#endif
+}
+
+// Which environment variable, if any, supplies an optional field that is not given
+// in the arguments
+struct environment_options {
+  std::optional<std::string> prefix; // `PREFIX_` + the upper-case field name
+  std::vector<std::pair<std::string, std::string>> variables; // field => variable
+
+  bool enabled() const { return prefix.has_value() || !variables.empty(); }
+};
+
+// The variable of field `field_name` without the prefix: the upper-case name, with `-`
+// replaced by `_`, e.g., `LOG_LEVEL` for `log_level` and `RETRIES2` for `retries2`
+//
+// Used by both env_prefix and env_source, so that they map the same variable to the
+// same field
+inline std::string environment_name(std::string_view field_name) {
+  std::string result;
+  result.reserve(field_name.size());
+  for (const char c : field_name) {
+    result += c == '-' ? '_'
+                       : static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+  }
+  return result;
+}
+
+// The variable of every field of a struct without the prefix, e.g., `LOG_LEVEL` for
+// `log_level`, sorted; built once per type, whatever the prefix
+class environment_names {
+  std::vector<std::string> suffixes_;  // of each field
+  std::vector<std::size_t> by_suffix_; // indices into `suffixes_`, sorted by suffix
+
+public:
+  explicit environment_names(const field_table &table)
+      : suffixes_(table.size), by_suffix_(table.size) {
+    for (std::size_t i = 0; i < table.size; i++) {
+      suffixes_[i] = environment_name(table.names[i]);
+      by_suffix_[i] = i;
+    }
+    std::sort(by_suffix_.begin(), by_suffix_.end(), [this](std::size_t a, std::size_t b) {
+      return suffixes_[a] < suffixes_[b];
+    });
+  }
+
+  // Calls `f(index)` for every field whose variable ends with `suffix`, e.g.,
+  // `logLevel` and `loglevel` for `LOGLEVEL`
+  template <typename F> void find(std::string_view suffix, F &&f) const {
+    auto match = std::lower_bound(by_suffix_.begin(), by_suffix_.end(), suffix,
+                                  [this](std::size_t index, std::string_view key) {
+                                    return suffixes_[index] < key;
+                                  });
+    for (; match != by_suffix_.end() && suffixes_[*match] == suffix; ++match) {
+      f(*match);
+    }
+  }
+};
+
+template <typename T> const environment_names &environment_names_of() {
+  static const environment_names names(field_table_of<T>::value);
+  return names;
+}
+
+// The values of the environment variables of the `wanted` fields of a struct
+//
+// `environ` is scanned once. Most entries are rejected by their first character; the
+// others are looked up among the explicit variables and, after the prefix, among the
+// names of the fields, in O(log fields). No name is built, and nothing is allocated
+// unless a variable is set. The values are views into the environment, valid until
+// it changes
+class environment {
+  std::vector<std::optional<std::string_view>> values_; // of each field, if any is set
+
+public:
+  environment(const field_table &table, const environment_names &names,
+              const environment_options &options, const field_set &wanted,
+              char **entries) {
+    if (entries == nullptr || wanted.none()) {
+      return;
+    }
+
+    // a field named with `env(field, variable)` does not read the prefixed variable
+    field_set named;
+    std::array<bool, 256> first_characters{};
+    for (const auto &[field, variable] : options.variables) {
+      const auto index = table.find(field);
+      if (index != no_field && !variable.empty()) {
+        named.set(index);
+        first_characters[static_cast<unsigned char>(variable[0])] = true;
+      }
+    }
+    const std::string_view prefix = options.prefix ? *options.prefix : std::string_view{};
+    if (options.prefix.has_value()) {
+      if (prefix.empty()) {
+        first_characters.fill(true);
+      } else {
+        first_characters[static_cast<unsigned char>(prefix[0])] = true;
+      }
+    }
+
+    const auto set = [&](std::size_t index, std::string_view value) {
+      if (values_.empty()) {
+        values_.resize(table.size);
+      }
+      values_[index] = value;
+    };
+    for (auto entry = entries; *entry != nullptr; ++entry) {
+      if (!first_characters[static_cast<unsigned char>(**entry)]) {
+        continue;
+      }
+      // the value is not read, e.g., a long `PATH`, unless it is wanted
+      const char *equal = std::strchr(*entry, '=');
+      if (equal == nullptr) {
+        continue;
+      }
+      const std::string_view name(*entry, static_cast<std::size_t>(equal - *entry));
+      const std::string_view value(equal + 1);
+      // several fields may read the same variable
+      for (const auto &[field, variable] : options.variables) {
+        const auto index = variable == name ? table.find(field) : no_field;
+        if (index != no_field && wanted[index]) {
+          set(index, value);
+        }
+      }
+      if (options.prefix.has_value() && name.size() > prefix.size() &&
+          name.compare(0, prefix.size(), prefix) == 0) {
+        names.find(name.substr(prefix.size()), [&](std::size_t index) {
+          if (wanted[index] && !named[index]) {
+            set(index, value);
+          }
+        });
+      }
+    }
+  }
+
+  // Value of the variable of field `index`, if it is set
+  std::optional<std::string_view> value(std::size_t index) const {
+    return values_.empty() ? std::nullopt : values_[index];
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+// #include <structopt/response_file.hpp>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// The settings of one source, e.g., a config file: values by key, in tables that nest
+// like the structs they fill
+//
+// Keys and values are views, usually into the storage of the source; `files` and
+// `strings` keep storage that the source does not, e.g., a mapped config file, alive
+// as long as the settings
+struct settings {
+  // e.g., `[server]` or a JSON object; table 0 holds the top-level keys
+  struct table {
+    std::size_t parent;
+    std::string_view name;
+  };
+
+  // `key = value` or `key = [value, ...]` in a table
+  struct entry {
+    std::size_t table;
+    std::string_view key;
+    std::size_t first_value; // into `values`
+    std::size_t last_value;
+    std::size_t line; // 0 if the source has no lines
+  };
+
+  std::string origin; // e.g., "config file `app.toml`", for error messages
+  bool ignore_unknown_keys{false}; // e.g., unrelated environment variables
+  // keys are environment variables without the prefix, e.g., `LOG_LEVEL`, and name the
+  // fields that env_prefix would read them into, see details::environment_name
+  bool environment_keys{false};
+  std::vector<table> tables{{0, {}}};
+  std::vector<entry> entries; // grouped by table by group_by_table()
+  std::vector<std::string_view> values;
+
+  std::vector<mapped_file> files;
+  std::deque<std::string> strings;
+
+  // Why and where reading the source failed, if it did
+  const char *error{nullptr};
+  std::size_t line{0};
+
+  bool fail(const char *reason, std::size_t error_line = 0) {
+    error = reason;
+    line = error_line;
+    return false;
+  }
+
+  std::size_t find_table(std::size_t parent, std::string_view name) {
+    for (std::size_t i = 1; i < tables.size(); i++) {
+      if (tables[i].parent == parent && tables[i].name == name) {
+        return i;
+      }
+    }
+    tables.push_back({parent, name});
+    return tables.size() - 1;
+  }
+
+  // `server.tls.enabled` => key `enabled` in table `server.tls`, with `values`
+  template <typename Values> void add(std::string_view path, const Values &new_values) {
+    std::size_t table = 0;
+    for (auto dot = path.find('.'); dot != std::string_view::npos; dot = path.find('.')) {
+      table = find_table(table, path.substr(0, dot));
+      path.remove_prefix(dot + 1);
+    }
+    const auto first_value = values.size();
+    values.insert(values.end(), std::begin(new_values), std::end(new_values));
+    entries.push_back({table, path, first_value, values.size(), 0});
+  }
+
+  // Entries of the same table end up next to each other, still in source order
+  void group_by_table() {
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const entry &a, const entry &b) { return a.table < b.table; });
+  }
+
+  // The entries of table `index`, after group_by_table()
+  std::pair<const entry *, const entry *> entries_of(std::size_t index) const {
+    const auto range = std::equal_range(
+        entries.begin(), entries.end(), entry{index, {}, 0, 0, 0},
+        [](const entry &a, const entry &b) { return a.table < b.table; });
+    return {entries.data() + (range.first - entries.begin()),
+            entries.data() + (range.second - entries.begin())};
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+// #include <structopt/response_file.hpp>
+// #include <structopt/settings.hpp>
+// #include <structopt/token_kind.hpp>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+namespace details {
+
+// Reads a config file into settings
+//
+// Two formats are read: INI and the subset of TOML that looks like it, i.e.,
+// `[table.subtable]` headers, `key = value` lines, `#` and `;` comments, quoted
+// strings and `[a, b]` arrays; and JSON, if the file starts with `{`. Objects are
+// tables, `null` values are skipped
+//
+// The file is mapped into memory, and keys and values are views into the mapping.
+// Quotes and escapes are removed in place, in the copy-on-write mapping, so nothing
+// is copied; the mapping is kept in the settings
+class config_file_reader {
+  settings &result_;
+  char *in_{nullptr};
+  char *end_{nullptr};
+  std::size_t line_{1};
+
+public:
+  explicit config_file_reader(settings &result) : result_(result) {}
+
+  // False if `path` cannot be read or on a syntax error, see `settings::error`
+  bool read(const std::string &path) {
+    result_.origin = "config file `" + path + "`";
+    mapped_file file(path);
+    if (!file.is_open()) {
+      return result_.fail("cannot be read");
+    }
+    in_ = file.data();
+    end_ = in_ + file.size();
+    result_.files.push_back(std::move(file));
+
+    // one entry per line at most
+    result_.entries.reserve(static_cast<std::size_t>(std::count(in_, end_, '\n')) + 1);
+    skip_space();
+    return in_ != end_ && *in_ == '{' ? parse_json() : parse_ini();
+  }
+
+private:
+  bool fail(const char *reason) { return result_.fail(reason, line_); }
+
+  std::size_t find_table(std::size_t parent, std::string_view name) {
+    return result_.find_table(parent, name);
+  }
+
+  void add_entry(std::size_t table, std::string_view key, std::size_t first_value,
+                 std::size_t line) {
+    result_.entries.push_back({table, key, first_value, result_.values.size(), line});
+  }
+
+  // Spaces, tabs and, if `newlines`, line breaks
+  void skip_space(bool newlines = true) {
+    for (; in_ != end_; ++in_) {
+      const char c = *in_;
+      if (c == '\n' && newlines) {
+        line_ += 1;
+      } else if (c != ' ' && c != '\t' && c != '\r') {
+        return;
+      }
+    }
+  }
+
+  void skip_line() {
+    while (in_ != end_ && *in_ != '\n') {
+      ++in_;
+    }
+  }
+
+  // Spaces, tabs, comments and line breaks, e.g., between the values of an array
+  void skip_space_and_comments() {
+    skip_space();
+    while (in_ != end_ && (*in_ == '#' || *in_ == ';')) {
+      skip_line();
+      skip_space();
+    }
+  }
+
+  bool at_end_of_line() {
+    skip_space(false);
+    if (in_ != end_ && (*in_ == '#' || *in_ == ';')) {
+      skip_line();
+    }
+    return in_ == end_ || *in_ == '\n';
+  }
+
+  static void append_utf8(char *&out, std::uint32_t code_point) {
+    if (code_point < 0x80) {
+      *out++ = static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+      *out++ = static_cast<char>(0xC0 | (code_point >> 6));
+      *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+      *out++ = static_cast<char>(0xE0 | (code_point >> 12));
+      *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+      *out++ = static_cast<char>(0xF0 | (code_point >> 18));
+      *out++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+      *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+  }
+
+  bool read_hex(std::size_t digits, std::uint32_t &result) {
+    result = 0;
+    for (std::size_t i = 0; i < digits; i++, ++in_) {
+      if (in_ == end_ || !is_hex_digit(*in_)) {
+        return false;
+      }
+      const char c = *in_;
+      result = result * 16 + static_cast<std::uint32_t>(
+                                 c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+    }
+    return true;
+  }
+
+  // A double-quoted string, unescaped in place; `in_` is at the opening quote
+  // Escapes are those of JSON, which TOML shares
+  bool read_quoted_string(std::string_view &result) {
+    char *const begin = ++in_;
+    char *out = begin;
+    while (true) {
+      if (in_ == end_ || *in_ == '\n') {
+        return fail("unterminated string");
+      }
+      const char c = *in_++;
+      if (c == '"') {
+        break;
+      } else if (c != '\\') {
+        *out++ = c;
+        continue;
+      }
+      if (in_ == end_) {
+        return fail("unterminated string");
+      }
+      switch (*in_++) {
+      case '"':
+        *out++ = '"';
+        break;
+      case '\\':
+        *out++ = '\\';
+        break;
+      case '/':
+        *out++ = '/';
+        break;
+      case 'b':
+        *out++ = '\b';
+        break;
+      case 'f':
+        *out++ = '\f';
+        break;
+      case 'n':
+        *out++ = '\n';
+        break;
+      case 'r':
+        *out++ = '\r';
+        break;
+      case 't':
+        *out++ = '\t';
+        break;
+      case 'u': {
+        std::uint32_t code_point;
+        if (!read_hex(4, code_point)) {
+          return fail("invalid escape sequence");
+        }
+        if (code_point >= 0xD800 && code_point < 0xDC00 && end_ - in_ >= 6 &&
+            in_[0] == '\\' && in_[1] == 'u') {
+          // a UTF-16 surrogate pair, as JSON writes characters outside the BMP
+          in_ += 2;
+          std::uint32_t low;
+          if (!read_hex(4, low) || low < 0xDC00 || low >= 0xE000) {
+            return fail("invalid escape sequence");
+          }
+          code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+        }
+        // never longer than the escape sequence
+        append_utf8(out, code_point);
+        break;
+      }
+      default:
+        return fail("invalid escape sequence");
+      }
+    }
+    result = {begin, static_cast<std::size_t>(out - begin)};
+    return true;
+  }
+
+  // A single-quoted string, as is; `in_` is at the opening quote
+  bool read_literal_string(std::string_view &result) {
+    char *const begin = ++in_;
+    while (in_ != end_ && *in_ != '\'' && *in_ != '\n') {
+      ++in_;
+    }
+    if (in_ == end_ || *in_ != '\'') {
+      return fail("unterminated string");
+    }
+    result = {begin, static_cast<std::size_t>(in_++ - begin)};
+    return true;
+  }
+
+  // An unquoted value, e.g., `42`, `true` or, in INI, `hello world`
+  // Ends at the end of the line, a comment or any of `delimiters`
+  std::string_view read_bare_value(std::string_view delimiters) {
+    char *const begin = in_;
+    char *last = in_; // after the last character that is not a space
+    for (; in_ != end_ && *in_ != '\n'; ++in_) {
+      const char c = *in_;
+      const bool is_comment =
+          (c == '#' || c == ';') && (in_ == begin || in_[-1] == ' ' || in_[-1] == '\t');
+      if (is_comment || delimiters.find(c) != std::string_view::npos) {
+        break;
+      }
+      if (c != ' ' && c != '\t' && c != '\r') {
+        last = in_ + 1;
+      }
+    }
+    return {begin, static_cast<std::size_t>(last - begin)};
+  }
+
+  bool read_ini_value(std::string_view delimiters) {
+    std::string_view value;
+    if (in_ != end_ && *in_ == '"') {
+      if (!read_quoted_string(value)) {
+        return false;
+      }
+    } else if (in_ != end_ && *in_ == '\'') {
+      if (!read_literal_string(value)) {
+        return false;
+      }
+    } else {
+      value = read_bare_value(delimiters);
+    }
+    result_.values.push_back(value);
+    return true;
+  }
+
+  // `name` or `a.b.c`, e.g., a key or a table header, up to `terminator`
+  // Every part but the last is a table, looked up or added under `table`
+  bool read_dotted_name(std::size_t &table, std::string_view &name, char terminator) {
+    while (true) {
+      skip_space(false);
+      char *const begin = in_;
+      while (in_ != end_ && *in_ != '.' && *in_ != terminator && *in_ != '\n' &&
+             *in_ != ' ' && *in_ != '\t') {
+        ++in_;
+      }
+      name = {begin, static_cast<std::size_t>(in_ - begin)};
+      skip_space(false);
+      if (name.empty()) {
+        return fail("expected a name");
+      }
+      if (in_ == end_ || *in_ != '.') {
+        break;
+      }
+      ++in_;
+      table = find_table(table, name);
+    }
+    if (in_ == end_ || *in_ != terminator) {
+      return fail(terminator == '=' ? "expected `=` after the key" : "expected `]`");
+    }
+    ++in_;
+    return true;
+  }
+
+  bool parse_ini() {
+    std::size_t table = 0;
+    while (true) {
+      skip_space_and_comments();
+      if (in_ == end_) {
+        return true;
+      }
+      if (*in_ == '[') {
+        // [table] or [table.subtable]
+        ++in_;
+        if (in_ != end_ && *in_ == '[') {
+          return fail("arrays of tables are not supported");
+        }
+        table = 0;
+        std::string_view name;
+        if (!read_dotted_name(table, name, ']')) {
+          return false;
+        }
+        table = find_table(table, name);
+      } else {
+        const auto entry_line = line_;
+        auto entry_table = table;
+        std::string_view key;
+        if (!read_dotted_name(entry_table, key, '=')) {
+          return false;
+        }
+        skip_space(false);
+        const auto first_value = result_.values.size();
+        if (in_ != end_ && *in_ == '[') {
+          ++in_;
+          skip_space_and_comments();
+          while (in_ != end_ && *in_ != ']') {
+            if (!read_ini_value(",]")) {
+              return false;
+            }
+            skip_space_and_comments();
+            if (in_ != end_ && *in_ == ',') {
+              ++in_;
+              skip_space_and_comments();
+            } else if (in_ == end_ || *in_ != ']') {
+              return fail("expected `,` or `]` in array");
+            }
+          }
+          if (in_ == end_) {
+            return fail("unterminated array");
+          }
+          ++in_;
+        } else if (!read_ini_value({})) {
+          return false;
+        }
+        add_entry(entry_table, key, first_value, entry_line);
+      }
+      if (!at_end_of_line()) {
+        return fail("unexpected characters at the end of the line");
+      }
+    }
+  }
+
+  // A JSON string, number, `true` or `false`
+  bool read_json_value() {
+    if (in_ != end_ && *in_ == '"') {
+      std::string_view value;
+      if (!read_quoted_string(value)) {
+        return false;
+      }
+      result_.values.push_back(value);
+      return true;
+    }
+    const auto value = read_bare_value(",}] \t\r");
+    if (value.empty() || value == "null") {
+      return fail("expected a string, number or boolean");
+    }
+    result_.values.push_back(value);
+    return true;
+  }
+
+  // An object; `in_` is at the opening brace
+  bool parse_json_object(std::size_t table) {
+    ++in_;
+    skip_space();
+    if (in_ != end_ && *in_ == '}') {
+      ++in_;
+      return true;
+    }
+    while (true) {
+      skip_space();
+      if (in_ == end_ || *in_ != '"') {
+        return fail("expected a string key");
+      }
+      const auto entry_line = line_;
+      std::string_view key;
+      if (!read_quoted_string(key)) {
+        return false;
+      }
+      skip_space();
+      if (in_ == end_ || *in_ != ':') {
+        return fail("expected `:` after the key");
+      }
+      ++in_;
+      skip_space();
+
+      const auto first_value = result_.values.size();
+      if (in_ != end_ && *in_ == '{') {
+        if (!parse_json_object(find_table(table, key))) {
+          return false;
+        }
+      } else if (in_ != end_ && *in_ == '[') {
+        ++in_;
+        skip_space();
+        while (in_ != end_ && *in_ != ']') {
+          if (!read_json_value()) {
+            return false;
+          }
+          skip_space();
+          if (in_ != end_ && *in_ == ',') {
+            ++in_;
+            skip_space();
+          } else if (in_ == end_ || *in_ != ']') {
+            return fail("expected `,` or `]` in array");
+          }
+        }
+        if (in_ == end_) {
+          return fail("unterminated array");
+        }
+        ++in_;
+        add_entry(table, key, first_value, entry_line);
+      } else if (end_ - in_ >= 4 && std::string_view(in_, 4) == "null") {
+        // not set
+        in_ += 4;
+      } else {
+        if (!read_json_value()) {
+          return false;
+        }
+        add_entry(table, key, first_value, entry_line);
+      }
+
+      skip_space();
+      if (in_ != end_ && *in_ == ',') {
+        ++in_;
+      } else if (in_ != end_ && *in_ == '}') {
+        ++in_;
+        return true;
+      } else {
+        return fail("expected `,` or `}` in object");
+      }
+    }
+  }
+
+  bool parse_json() {
+    if (!parse_json_object(0)) {
+      return false;
+    }
+    skip_space();
+    return in_ == end_ || fail("unexpected characters after the object");
+  }
+};
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <string_view>
+// #include <structopt/config_file.hpp>
+// #include <structopt/environment.hpp>
+// #include <structopt/settings.hpp>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+// Settings from outside the command line, e.g., a config file, the environment or
+// the query parameters of a request, that fill the optional fields and nested
+// structs of a STRUCTOPT struct
+//
+// A source lists its settings by key: the name of an optional field, or a dotted
+// path through nested structs, e.g., `server.port`. Values are views into the
+// storage of the source and are converted straight into the fields, like the values
+// of options
+//
+// read() is called once per parse, possibly from several threads at once
+class source {
+public:
+  virtual ~source() = default;
+
+  // Add the settings of this source to `result`, or return false with
+  // `result.error` set
+  virtual bool read(details::settings &result) const = 0;
+};
+
+// A config file, see app::config_file
+class file_source : public source {
+  std::string path_;
+
+public:
+  explicit file_source(std::string path) : path_(std::move(path)) {}
+
+  bool read(details::settings &result) const override {
+    return details::config_file_reader(result).read(path_);
+  }
+};
+
+// Key/value pairs in memory, e.g., a std::map<std::string, std::string> of decoded
+// query parameters. A key that appears several times, e.g., in a
+// std::vector<std::pair<...>>, has several values, for a container field
+//
+// The pairs are viewed, not copied: `map` must outlive the source
+class map_source : public source {
+  std::vector<std::pair<std::string_view, std::string_view>> pairs_;
+  std::string origin_;
+
+public:
+  template <typename Map>
+  explicit map_source(const Map &map, std::string origin = "key/value source")
+      : origin_(std::move(origin)) {
+    const auto size = std::distance(std::begin(map), std::end(map));
+    pairs_.reserve(static_cast<std::size_t>(size));
+    for (const auto &[key, value] : map) {
+      pairs_.emplace_back(key, value);
+    }
+  }
+
+  bool read(details::settings &result) const override {
+    result.origin = origin_;
+    // Pairs with the same key are next to each other, in their original order
+    std::vector<std::size_t> order(pairs_.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+      return pairs_[a].first < pairs_[b].first;
+    });
+
+    std::vector<std::string_view> values;
+    for (std::size_t i = 0; i < order.size();) {
+      const auto key = pairs_[order[i]].first;
+      values.clear();
+      for (; i < order.size() && pairs_[order[i]].first == key; i++) {
+        values.push_back(pairs_[order[i]].second);
+      }
+      result.add(key, values);
+    }
+    return true;
+  }
+};
+
+// Environment variables that start with `prefix`, e.g., `APP_LOG_LEVEL` => `log_level`
+//
+// The rest of the name is lower-cased, and `__` separates nested structs, e.g.,
+// `APP_SERVER__PORT` => `server.port`. Variables that do not name a field are
+// ignored. The environment is scanned once per read
+//
+// Unlike app::env_prefix, which fills the fields that the arguments did not, this
+// source takes its place among the other sources
+class env_source : public source {
+  std::string prefix_;
+
+public:
+  explicit env_source(std::string prefix) : prefix_(std::move(prefix)) {}
+
+  bool read(details::settings &result) const override {
+    result.origin = "environment";
+    result.ignore_unknown_keys = true;
+    result.environment_keys = true;
+    auto entries = details::process_environment();
+    if (entries == nullptr) {
+      return true;
+    }
+    for (; *entries != nullptr; ++entries) {
+      const char *entry = *entries;
+      if (std::strncmp(entry, prefix_.data(), prefix_.size()) != 0) {
+        continue;
+      }
+      const char *equal = std::strchr(entry + prefix_.size(), '=');
+      if (equal == nullptr || equal == entry + prefix_.size()) {
+        continue;
+      }
+
+      // `SERVER__PORT` => `SERVER.PORT`, i.e., `PORT` in table `SERVER`
+      auto &key = result.strings.emplace_back();
+      for (const char *c = entry + prefix_.size(); c != equal; ++c) {
+        if (c[0] == '_' && c + 1 != equal && c[1] == '_') {
+          key += '.';
+          ++c;
+        } else {
+          key += *c;
+        }
+      }
+      const std::string_view value(equal + 1);
+      result.add(key, std::initializer_list<std::string_view>{value});
+    }
+    return true;
+  }
+};
+
+} // namespace structopt
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <string_view>
+// #include <structopt/field_table.hpp>
+// #include <structopt/is_specialization.hpp>
+// #include <structopt/is_stl_container.hpp>
+// #include <structopt/lazy_vector.hpp>
+// #include <structopt/stream.hpp>
+// #include <structopt/string.hpp>
+// #include <structopt/third_party/visit_struct/visit_struct.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+class app;
+
+namespace details {
+
+// Field names of a STRUCTOPT struct, grouped by kind
+struct visitor {
+  std::vector<std::string_view> field_names;
+  std::deque<std::string_view> positional_field_names;
+  std::deque<std::string_view> positional_field_names_for_help;
+  std::deque<std::string_view> vector_like_positional_field_names;
+  std::deque<std::string_view> flag_field_names;
+  std::deque<std::string_view> optional_field_names;
+  std::deque<std::string_view> nested_struct_field_names;
+
+  void add_field(std::string_view name, field_kind kind, bool vector_like) {
+    field_names.push_back(name);
+    switch (kind) {
+    case field_kind::flag:
+      flag_field_names.push_back(name);
+      break;
+    case field_kind::optional:
+      optional_field_names.push_back(name);
+      break;
+    case field_kind::positional:
+      positional_field_names.push_back(name);
+      positional_field_names_for_help.push_back(name);
+      if (vector_like) {
+        // keep track of vector-like fields as these (even though positional)
+        // can be happy without any arguments
+        vector_like_positional_field_names.push_back(name);
+      }
+      break;
+    case field_kind::nested_struct:
+      nested_struct_field_names.push_back(name);
+      break;
+    }
+  }
+
+  // `name` is the name of the program (or sub-command)
+  // If `help` is not empty, it is printed instead of the generated help
+  void print_help(std::ostream &os, std::string_view name,
+                  std::string_view help = "") const {
+    if (help.size() > 0) {
+      os << help;
+    } else {
+      os << "\nUSAGE: " << name << " ";
+
+      if (flag_field_names.empty() == false) {
+        os << "[FLAGS] ";
+      }
+
+      if (optional_field_names.empty() == false) {
+        os << "[OPTIONS] ";
+      }
+
+      if (nested_struct_field_names.empty() == false) {
+        os << "[SUBCOMMANDS] ";
+      }
+
+      for (auto &field : positional_field_names_for_help) {
+        os << field << " ";
+      }
+
+      bool has_h = false;
+      bool has_v = false;
+      if (flag_field_names.empty() == false) {
+        os << "\n\nFLAGS:\n";
+        for (auto &flag : flag_field_names) {
+
+          // Generate kebab case and present as flag
+          auto kebab_case = details::string_to_kebab(flag);
+          std::string long_form = "";
+          if (kebab_case != flag) {
+            long_form = kebab_case;
+          } else {
+            long_form = flag;
+          }
+
+          os << "    -" << flag[0] << ", --" << flag << "\n";
+
+          switch (flag[0]) {
+          case 'h':
+            has_h = true;
+            break;
+          case 'v':
+            has_v = true;
+            break;
+          }
+        }
+      } else {
+        os << "\n";
+      }
+
+      if (optional_field_names.empty() == false) {
+        os << "\nOPTIONS:\n";
+        for (auto &option : optional_field_names) {
+
+          // Generate kebab case and present as option
+          auto kebab_case = details::string_to_kebab(option);
+          std::string long_form = "";
+          if (kebab_case != option) {
+            long_form = kebab_case;
+          } else {
+            long_form = option;
+          }
+
+          if ((has_v && option == "version") || (has_h && option == "help")) {
+            os << "    --" << long_form << " <" << option << ">\n";
+          } else {
+            os << "    -" << option[0] << ", --" << long_form << " <" << option << ">"
+               << "\n";
+          }
+
+          switch (option[0]) {
+          case 'h':
+            has_h = true;
+            break;
+          case 'v':
+            has_v = true;
+            break;
+          }
+        }
+      }
+
+      if (nested_struct_field_names.empty() == false) {
+        os << "\nSUBCOMMANDS:\n";
+        for (auto &sc : nested_struct_field_names) {
+          os << "    " << sc << "\n";
+        }
+      }
+
+      if (positional_field_names_for_help.empty() == false) {
+        os << "\nARGS:\n";
+        for (auto &arg : positional_field_names_for_help) {
+          os << "    " << arg << "\n";
+        }
+      }
+    }
+  }
+};
+
+// Containers that take any number of positional values, including none
+template <typename T>
+struct is_vector_like
+    : std::integral_constant<
+          bool, structopt::is_specialization<T, std::deque>::value ||
+                    structopt::is_specialization<T, std::list>::value ||
+                    structopt::is_specialization<T, std::vector>::value ||
+                    structopt::is_specialization<T, std::set>::value ||
+                    structopt::is_specialization<T, std::multiset>::value ||
+                    structopt::is_specialization<T, std::unordered_set>::value ||
+                    structopt::is_specialization<T, std::unordered_multiset>::value ||
+                    structopt::is_specialization<T, std::queue>::value ||
+                    structopt::is_specialization<T, std::stack>::value ||
+                    structopt::is_specialization<T, std::priority_queue>::value ||
+                    structopt::is_specialization<T, structopt::stream>::value ||
+                    structopt::is_specialization<T, structopt::lazy_vector>::value> {};
+
+template <auto... Pointers>
+constexpr std::array<bool, sizeof...(Pointers)>
+make_vector_like(visit_struct::member_list<nullptr, Pointers...>) {
+  return {{is_vector_like<visit_struct::member_type_t<decltype(Pointers)>>::value...}};
+}
+
+// The field names of `T` are collected once, on first use, and shared
+// (read-only) by every parse of `T`
+//
+// The names are read from the constexpr field table, in a loop, so that a struct
+// does not generate code per field here
+template <typename T> const visitor &schema() {
+  static const visitor result = [] {
+    using fields = field_table_of<T>;
+    static constexpr auto vector_like = make_vector_like(visit_struct::members<T>{});
+    visitor result;
+    for (std::size_t i = 0; i < fields::size; i++) {
+      result.add_field(fields::names[i], fields::kinds[i], vector_like[i]);
+    }
+
+    // add `help` and `version` optional arguments
+    result.optional_field_names.push_back("help");
+    result.optional_field_names.push_back("version");
+    return result;
+  }();
+  return result;
+}
+
+} // namespace details
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+// #include <structopt/visitor.hpp>
+
+namespace structopt {
+
+namespace details {
+struct parser;
+
+// Set once per app and shared with its errors, so that an error can outlive the app
+struct program_info {
+  std::string name;
+  std::string version;
+  std::string help; // custom help message, if any
+};
+
+// Which check failed; selects the error message
+enum class error_detail : std::uint8_t {
+  help_requested,
+  version_requested,
+  unrecognized_argument,
+  unexpected_argument,
+  optional_argument_missing,
+  optional_argument_invalid,
+  positional_argument_missing,
+  numeric_argument_invalid,
+  numeric_argument_out_of_range,
+  boolean_argument_invalid,
+  enum_argument_invalid,
+  pair_argument_missing,
+  pair_element_invalid,
+  array_argument_missing,
+  tuple_argument_missing,
+  tuple_element_invalid,
+  sub_command_conflict,
+  response_file_cycle,
+  record_input_failed,
+  config_syntax_error,
+  config_key_unknown,
+  config_too_many_values,
+};
+} // namespace details
+
+class app;
+
+enum class error_kind : std::uint8_t {
+  help_requested,        // `-h` or `--help`
+  version_requested,     // `-v` or `--version`
+  unrecognized_argument, // e.g., `--foo` where there is no field `foo`
+  unexpected_argument,   // e.g., an excess positional argument
+  missing_value,         // e.g., `--foo` at the end of the arguments
+  invalid_value,         // e.g., `--count abc`
+  value_out_of_range,    // e.g., `--count 99999999999` for an int field
+  sub_command_conflict,  // two different sub-commands invoked
+  response_file_cycle,   // `@file` includes itself, directly or indirectly
+  input_failed,          // reading values from a file descriptor failed
+  invalid_config,        // the config file cannot be read, or has an unknown key
+};
+
+// Describes why parsing failed
+//
+// Describing an error is cheap: the message and the help text are only
+// formatted when `message()` or `help()` is called, and the program's name, version
+// and help are shared with the app, not copied
+class parse_error {
+  details::error_detail detail_;
+  std::size_t token_index_{0};
+  std::string_view field_name_;
+  std::string token_; // copied: the arguments, e.g., a response file, may be gone
+  std::size_t expected_{0};            // e.g., number of values of a std::array
+  std::size_t provided_{0};            // e.g., number of values found
+  std::string_view other_sub_command_; // the sub-command that was already invoked
+  std::string (*allowed_values_)(){nullptr};
+  const char *reason_{nullptr}; // e.g., of a syntax error
+  std::string source_;          // e.g., "config file `app.toml`", for errors in a source
+  std::size_t line_{0};         // in `source_`
+
+  // For rendering help; the views are into `program_` or the schema, nothing is copied
+  const details::visitor *schema_{nullptr};
+  std::string_view name_;    // program (or sub-command) name
+  std::string_view help_;    // custom help message, if any
+  std::string_view version_; // printed for `--version`
+  std::shared_ptr<const details::program_info> program_; // set by the app
+
+  friend struct details::parser;
+  friend class structopt::app;
+
+  explicit parse_error(details::error_detail detail) : detail_(detail) {}
+
+public:
+  error_kind kind() const {
+    switch (detail_) {
+    case details::error_detail::help_requested:
+      return error_kind::help_requested;
+    case details::error_detail::version_requested:
+      return error_kind::version_requested;
+    case details::error_detail::unrecognized_argument:
+      return error_kind::unrecognized_argument;
+    case details::error_detail::unexpected_argument:
+      return error_kind::unexpected_argument;
+    case details::error_detail::optional_argument_missing:
+    case details::error_detail::positional_argument_missing:
+    case details::error_detail::pair_argument_missing:
+    case details::error_detail::array_argument_missing:
+    case details::error_detail::tuple_argument_missing:
+      return error_kind::missing_value;
+    case details::error_detail::numeric_argument_out_of_range:
+      return error_kind::value_out_of_range;
+    case details::error_detail::sub_command_conflict:
+      return error_kind::sub_command_conflict;
+    case details::error_detail::response_file_cycle:
+      return error_kind::response_file_cycle;
+    case details::error_detail::record_input_failed:
+      return error_kind::input_failed;
+    case details::error_detail::config_syntax_error:
+    case details::error_detail::config_key_unknown:
+    case details::error_detail::config_too_many_values:
+      return error_kind::invalid_config;
+    default:
+      return error_kind::invalid_value;
+    }
+  }
+
+  // Index of the offending token in `argv`; `argc` if the arguments ended early
+  // With response files, an index into the arguments after expanding them
+  std::size_t token_index() const { return token_index_; }
+
+  // Name of the field that could not be parsed, if any
+  std::string_view field_name() const { return field_name_; }
+
+  // The offending token, if any
+  std::string_view token() const { return token_; }
+
+  // Same message as structopt::exception::what()
+  //
+  // Errors in a source, e.g., a config file, start with its origin and the line, e.g.,
+  // "Error: config file `app.toml`, line 3: unrecognized key `job`."
+  std::string message() const {
+    if (source_.empty()) {
+      return describe();
+    }
+    auto result = describe();
+    const std::string_view prefix = "Error: ";
+    if (result.compare(0, prefix.size(), prefix) == 0) {
+      result.erase(0, prefix.size());
+    }
+    return "Error: " + source_ +
+           (line_ != 0 ? ", line " + std::to_string(line_) : std::string{}) + ": " +
+           result;
+  }
+
+  // Help of the program (or sub-command) that failed to parse
+  std::string help() const {
+    std::stringstream os;
+    if (schema_) {
+      schema_->print_help(os, name_, help_);
+    }
+    return os.str();
+  }
+
+private:
+  std::string describe() const {
+    using details::error_detail;
+    const std::string field{field_name_};
+    switch (detail_) {
+    case error_detail::help_requested:
+      return help();
+    case error_detail::version_requested:
+      return std::string{version_};
+    case error_detail::unrecognized_argument:
+      return "Error: unrecognized argument '" + token_ + "'";
+    case error_detail::unexpected_argument:
+      return "Error: unexpected argument '" + token_ + "'";
+    case error_detail::optional_argument_missing:
+      return "Error: expected value for optional argument `" + field + "`.";
+    case error_detail::optional_argument_invalid:
+      return "Error: failed to correctly parse optional argument `" + field + "`.";
+    case error_detail::positional_argument_missing:
+      return "Error: expected value for positional argument `" + field + "`.";
+    case error_detail::numeric_argument_invalid:
+      return "Error: failed to parse numeric argument `" + field + "`. `" + token_ +
+             "` is invalid.";
+    case error_detail::numeric_argument_out_of_range:
+      return "Error: failed to parse numeric argument `" + field + "`. `" + token_ +
+             "` is out of range.";
+    case error_detail::boolean_argument_invalid: {
+      std::string lower_case_token = token_;
+      std::transform(lower_case_token.begin(), lower_case_token.end(),
+                     lower_case_token.begin(),
+                     [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+      return "Error: failed to parse boolean argument `" + field + "`. `" +
+             lower_case_token + "` is invalid.";
+    }
+    case error_detail::enum_argument_invalid:
+      return "Error: unexpected input `" + token_ + "` provided for enum argument `" +
+             field + "`. Allowed values are {" +
+             (allowed_values_ ? allowed_values_() : std::string{}) + "}";
+    case error_detail::pair_argument_missing:
+      return "Error: failed to correctly parse the pair `" + field + "`. Expected 2 " +
+             (provided_ == 0 ? "arguments, 0 provided." : "arguments, only 1 provided.");
+    case error_detail::pair_element_invalid:
+      return "Error: failed to correctly parse " +
+             std::string(provided_ == 0 ? "first" : "second") + " element of pair `" +
+             field + "`";
+    case error_detail::array_argument_missing:
+      return "Error: expected " + std::to_string(expected_) +
+             " values for std::array argument `" + field + "` - instead got only " +
+             std::to_string(provided_) + " arguments.";
+    case error_detail::tuple_argument_missing:
+      return "Error: failed to correctly parse tuple `" + field + "`. Expected " +
+             std::to_string(expected_) + " arguments, " + std::to_string(provided_) +
+             " provided.";
+    case error_detail::tuple_element_invalid:
+      return "Error: failed to correctly parse tuple `" + field + "` {size = " +
+             std::to_string(expected_) + "} at index " + std::to_string(provided_) +
+             ".";
+    case error_detail::sub_command_conflict:
+      return "Error: failed to invoke sub-command `" + field +
+             "` because a different sub-command, `" + std::string{other_sub_command_} +
+             "`, has already been invoked.";
+    case error_detail::response_file_cycle:
+      return "Error: response file `" + token_.substr(1) +
+             "` includes itself, directly or indirectly.";
+    case error_detail::record_input_failed:
+      return "Error: failed to read the values of `" + field + "` from the input.";
+    case error_detail::config_syntax_error:
+      return std::string("Error: ") + (reason_ ? reason_ : "syntax error") + ".";
+    case error_detail::config_key_unknown:
+      return "Error: unrecognized key `" + token_ + "`.";
+    case error_detail::config_too_many_values:
+      return "Error: too many values for `" + field + "`.";
+    }
+    return "";
+  }
+};
+
+} // namespace structopt
+#pragma once
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+// #include <structopt/parse_error.hpp>
 // #include <structopt/visitor.hpp>
 
 namespace structopt {
 
-class exception : public std::exception {
-  std::string what_{""};
-  std::string help_{""};
-  details::visitor visitor_;
+class exception : public std::exception {
+  // Help is rendered on the first call to help(), if ever, once for all the copies
+  // of the exception
+  struct lazy_help {
+    const details::visitor *schema; // shared, see details::schema<T>()
+    std::string_view name;          // program (or sub-command) name
+    std::string_view help;          // custom help message, if any
+    std::shared_ptr<const details::program_info> program; // keeps the views alive
+    mutable std::once_flag rendered;
+    mutable std::string text;
+
+    lazy_help(const details::visitor *schema, std::string_view name, std::string_view help,
+              std::shared_ptr<const details::program_info> program)
+        : schema(schema), name(name), help(help), program(std::move(program)) {}
+  };
+
+  std::string what_{""};
+  std::shared_ptr<const lazy_help> help_;
+
+public:
+  // `visitor` must outlive the exception, e.g., details::schema<T>(), and so must
+  // `name` and `help`, unless they are views into `program`
+  exception(const std::string &what, const details::visitor &visitor,
+            std::string_view name, std::string_view help = "",
+            std::shared_ptr<const details::program_info> program = nullptr)
+      : what_(what),
+        help_(std::make_shared<const lazy_help>(&visitor, name, help, std::move(program))) {}
+
+  const char *what() const throw() { return what_.c_str(); }
+
+  // Empty if the help cannot be rendered, e.g., out of memory
+  const char *help() const throw() {
+    try {
+      std::call_once(help_->rendered, [this]() {
+        std::stringstream os;
+        help_->schema->print_help(os, help_->name, help_->help);
+        help_->text = os.str();
+      });
+    } catch (...) {
+      return "";
+    }
+    return help_->text.c_str();
+  }
+};
+
+} // namespace structopt
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+// #include <structopt/token_kind.hpp>
+
+// Define STRUCTOPT_DISABLE_OBSERVERS to compile the observer hooks out of the parser:
+// app::observe is then ignored. Otherwise a parse without an observer only tests a
+// null pointer at each hook, and never reads the clock
+//
+// The macro changes the definitions of inline parser functions, so every translation
+// unit of a program must agree on it, or the linker silently keeps one of the
+// definitions. Set it for the whole build with the CMake option of the same name,
+// which defines it for every target that links structopt, not in a source file
+#ifdef STRUCTOPT_DISABLE_OBSERVERS
+#define STRUCTOPT_OBSERVERS 0
+#else
+#define STRUCTOPT_OBSERVERS 1
+#endif
+
+namespace structopt {
+
+class parse_error;
+
+using token_kind = details::token_kind;
+
+enum class parse_event_kind : std::uint8_t {
+  parse_started,      // before the sources and the arguments are read
+  token_classified,   // `token` is a literal, a number, an option, etc., see `kind`
+  field_matched,      // `token` routes to the field `field`
+  value_converted,    // the value of `field` was parsed from `tokens` tokens
+  subcommand_entered, // `token` names the nested struct `field`
+  error_raised,       // the first error of the parse, see `error`
+  parse_finished,     // after the last check, whether the parse failed or not
+};
+
+// A step of a parse, see structopt::observer
+//
+// Views are valid during the call only
+struct parse_event {
+  parse_event_kind kind{parse_event_kind::parse_started};
+  std::chrono::steady_clock::time_point time{};
+  std::size_t token_index{0}; // of `token` in the arguments
+  std::string_view token;
+  token_kind kind_of_token{token_kind::literal}; // token_classified
+  std::string_view field;                        // name of the field, if any
+  std::size_t tokens{0};                         // value_converted: tokens consumed
+  bool converted{true};                          // value_converted: without error
+  const parse_error *error{nullptr};             // error_raised
+};
+
+// Told about every step of a parse, e.g., to find where the time of a slow parse
+// went; see app::observe and structopt::trace_observer
+//
+// Nested events bracket each other: a value_converted event closes the last
+// field_matched event of the same field, and every event of a sub-command falls
+// between its field_matched and value_converted events. With app::parse_batch, the
+// events of several parses interleave
+class observer {
+public:
+  virtual ~observer() = default;
+
+  virtual void on_event(const parse_event &event) = 0;
+};
+
+} // namespace structopt
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <string_view>
+// #include <structopt/observer.hpp>
+// #include <structopt/parse_error.hpp>
+#include <utility>
+#include <vector>
+
+namespace structopt {
+
+// Prints, after every parse, where its time went: per field, the number of times it
+// was matched, the tokens its values took, the time spent converting them and,
+// given an allocation counter, the allocations, slowest field first, e.g.,
+//
+//   structopt: 6 tokens, 1 sub-command in 14.2 us, 3 allocations
+//   field                            matches   tokens    time (us)  allocations
+//   config                                 1        3         9.10            2
+//   config.level                           1        2         2.40            1
+//   input_file                             1        1         0.80            1
+//
+// A sub-command's time includes its fields', which are listed as `sub.field`
+//
+// `allocations` returns a running count, e.g., of a replaced operator new; structopt
+// cannot count them itself. Not thread-safe: observe one parse at a time
+class trace_observer : public observer {
+public:
+  using clock = std::chrono::steady_clock;
+
+  // Per field, over one parse
+  struct field_summary {
+    std::string name; // `sub.field` in a sub-command
+    std::size_t matches{0};
+    std::size_t tokens{0};
+    clock::duration time{};
+    std::size_t allocations{0};
+  };
+
+private:
+  // A field whose value is being converted
+  struct frame {
+    std::size_t summary; // index in `fields_`
+    clock::time_point start;
+    std::size_t allocations;
+  };
+
+  std::ostream *os_;
+  std::function<std::size_t()> allocations_;
+  clock::time_point start_{};
+  std::size_t start_allocations_{0};
+  clock::duration total_{};
+  std::size_t total_allocations_{0};
+  std::size_t tokens_{0};
+  std::size_t sub_commands_{0};
+  std::string error_;
+  std::vector<field_summary> fields_;
+  std::vector<frame> frames_;
+
+  std::size_t allocations() const { return allocations_ ? allocations_() : 0; }
+
+  std::size_t summary_of(std::string_view field) {
+    std::string name;
+    if (!frames_.empty()) {
+      name = fields_[frames_.back().summary].name + ".";
+    }
+    name += field;
+    const auto it = std::find_if(fields_.begin(), fields_.end(),
+                                 [&](const field_summary &f) { return f.name == name; });
+    if (it != fields_.end()) {
+      return static_cast<std::size_t>(it - fields_.begin());
+    }
+    fields_.push_back({std::move(name)});
+    return fields_.size() - 1;
+  }
+
+public:
+  // Prints to `os` after every parse, if not null
+  explicit trace_observer(std::ostream *os = nullptr,
+                          std::function<std::size_t()> allocations = {})
+      : os_(os), allocations_(std::move(allocations)) {}
+
+  void on_event(const parse_event &event) override {
+    switch (event.kind) {
+    case parse_event_kind::parse_started:
+      fields_.clear();
+      frames_.clear();
+      tokens_ = 0;
+      sub_commands_ = 0;
+      error_.clear();
+      start_ = event.time;
+      start_allocations_ = allocations();
+      break;
+    case parse_event_kind::field_matched:
+      frames_.push_back({summary_of(event.field), event.time, allocations()});
+      break;
+    case parse_event_kind::value_converted:
+      if (!frames_.empty()) {
+        const auto current = frames_.back();
+        frames_.pop_back();
+        auto &summary = fields_[current.summary];
+        summary.matches += 1;
+        summary.tokens += event.tokens;
+        summary.time += event.time - current.start;
+        summary.allocations += allocations() - current.allocations;
+      }
+      break;
+    case parse_event_kind::subcommand_entered:
+      sub_commands_ += 1;
+      break;
+    case parse_event_kind::token_classified:
+      break;
+    case parse_event_kind::error_raised:
+      if (event.error != nullptr) {
+        error_ = event.error->message();
+      }
+      break;
+    case parse_event_kind::parse_finished:
+      // the tokens read, not the program name
+      tokens_ = event.token_index > 0 ? event.token_index - 1 : 0;
+      total_ = event.time - start_;
+      total_allocations_ = allocations() - start_allocations_;
+      if (os_ != nullptr) {
+        print(*os_);
+      }
+      break;
+    }
+  }
+
+  // The fields of the last parse, in the order they were first matched
+  const std::vector<field_summary> &fields() const { return fields_; }
+
+  // Duration of the last parse
+  clock::duration total() const { return total_; }
+
+  // The summary of the last parse
+  void print(std::ostream &os) const {
+    const auto microseconds = [](clock::duration d) {
+      return std::chrono::duration<double, std::micro>(d).count();
+    };
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+
+    os << "structopt: " << tokens_ << (tokens_ == 1 ? " token" : " tokens");
+    if (sub_commands_ > 0) {
+      os << ", " << sub_commands_
+         << (sub_commands_ == 1 ? " sub-command" : " sub-commands");
+    }
+    os << " in " << std::fixed << std::setprecision(1) << microseconds(total_) << " us";
+    if (allocations_) {
+      os << ", " << total_allocations_ << " allocations";
+    }
+    os << "\n";
+
+    auto slowest = fields_;
+    std::stable_sort(slowest.begin(), slowest.end(),
+                     [](const field_summary &a, const field_summary &b) {
+                       return a.time > b.time;
+                     });
+    os << std::left << std::setw(32) << "field" << std::right << std::setw(9) << "matches"
+       << std::setw(9) << "tokens" << std::setw(13) << "time (us)";
+    if (allocations_) {
+      os << std::setw(13) << "allocations";
+    }
+    os << "\n";
+    for (const auto &field : slowest) {
+      os << std::left << std::setw(32) << field.name << std::right << std::setw(9)
+         << field.matches << std::setw(9) << field.tokens << std::setw(13)
+         << std::setprecision(2) << microseconds(field.time);
+      if (allocations_) {
+        os << std::setw(13) << field.allocations;
+      }
+      os << "\n";
+    }
+    if (!error_.empty()) {
+      os << error_ << "\n";
+    }
+    os.flags(flags);
+    os.precision(precision);
+  }
+};
+
+} // namespace structopt
+#pragma once
+#include <optional>
+// #include <structopt/parse_error.hpp>
+#include <utility>
+
+namespace structopt {
+
+// Either the parsed struct or a description of why parsing failed
+template <typename T> class parse_result {
+  std::optional<T> value_;
+  std::optional<parse_error> error_;
 
 public:
-  exception(const std::string &what, const details::visitor &visitor)
-      : what_(what), help_(""), visitor_(visitor) {
-    std::stringstream os;
-    visitor_.print_help(os);
-    help_ = os.str();
-  }
+  parse_result(T value) : value_(std::move(value)) {}
 
-  const char *what() const throw() { return what_.c_str(); }
+  parse_result(parse_error error) : error_(std::move(error)) {}
+
+  bool has_value() const { return value_.has_value(); }
 
-  const char *help() const throw() { return help_.c_str(); }
+  explicit operator bool() const { return has_value(); }
+
+  // Throws std::bad_optional_access if parsing failed
+  T &value() & { return value_.value(); }
+  const T &value() const & { return value_.value(); }
+  T &&value() && { return std::move(value_).value(); }
+
+  T *operator->() { return &value_.value(); }
+  const T *operator->() const { return &value_.value(); }
+
+  // Throws std::bad_optional_access if parsing succeeded
+  const parse_error &error() const { return error_.value(); }
 };
 
 } // namespace structopt
+
 #pragma once
 #include <optional>
-// #include <structopt/visitor.hpp>
 
 namespace structopt {
 
@@ -2508,7 +6587,6 @@ struct parser;
 
 class sub_command {
   std::optional<bool> invoked_;
-  details::visitor visitor_;
 
   friend struct structopt::details::parser;
 
@@ -2521,18 +6599,28 @@ public:
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <chrono>
 #include <initializer_list>
-#include <iostream>
 #include <iterator>
 #include <set>
 #include <sstream>
 #include <string>
 #include <string_view>
 // #include <structopt/array_size.hpp>
-// #include <structopt/exception.hpp>
-// #include <structopt/is_number.hpp>
+// #include <structopt/environment.hpp>
+// #include <structopt/field_table.hpp>
 // #include <structopt/is_specialization.hpp>
+// #include <structopt/lazy_vector.hpp>
+// #include <structopt/observer.hpp>
+// #include <structopt/parallel_for.hpp>
+// #include <structopt/parse_error.hpp>
+// #include <structopt/parse_number.hpp>
+// #include <structopt/record_reader.hpp>
+// #include <structopt/settings.hpp>
+// #include <structopt/stream.hpp>
 // #include <structopt/sub_command.hpp>
+// #include <structopt/token_cursor.hpp>
+// #include <structopt/token_kind.hpp>
 // #include <structopt/third_party/magic_enum/magic_enum.hpp>
 // #include <structopt/third_party/visit_struct/visit_struct.hpp>
 #include <tuple>
@@ -2551,37 +6639,102 @@ inline bool equal_strings_replace_hyphens(std::string_view s1, std::string_view
   });
 }
 
+// `c` => `-c`, e.g., to service the flags of a combined argument `-abc`
+// The two-character tokens live in static storage - no allocation per flag
+inline std::string_view short_option_token(char c) {
+  static constexpr auto tokens = [] {
+    std::array<std::array<char, 2>, 256> result{};
+    for (std::size_t i = 0; i < result.size(); i++) {
+      result[i] = {'-', static_cast<char>(i)};
+    }
+    return result;
+  }();
+  return {tokens[static_cast<unsigned char>(c)].data(), 2};
+}
+
+// A value that is parsed from exactly one token, e.g., a number or a string
+// - one container element per token, so the token count is the element count
+template <typename T>
+struct is_single_token_value
+    : std::integral_constant<bool, !visit_struct::traits::is_visitable<T>::value &&
+                                       !is_specialization<T, std::pair>::value &&
+                                       !is_specialization<T, std::tuple>::value &&
+                                       !is_stl_container<T>::value> {};
+
 struct parser {
-  structopt::details::visitor visitor;
-  std::vector<std::string> arguments;
-  std::size_t current_index{1};
-  std::size_t next_index{1};
+  std::string_view name;    // program (or sub-command) name
+  std::string_view version; // program version
+  std::string_view help;    // custom help message, if any
+  const structopt::details::visitor *visitor{nullptr};
+  const field_table *fields{nullptr};
+  token_cursor arguments;
+  std::size_t positional_index{0}; // next field in `visitor->positional_field_names`
   bool double_dash_encountered{false}; // "--" option-argument delimiter
   bool sub_command_invoked{false};
-  std::string already_invoked_subcommand_name{""};
+  std::string_view already_invoked_subcommand_name;
+  std::optional<structopt::parse_error> failure; // first error, if any
+  std::size_t num_threads{1}; // for converting long lists of strings, 0 = one per core
+  record_reader *records{nullptr}; // replaces `-` among container values, if set
+  field_set *given_options{nullptr}; // indices of the optional fields parsed, if set
+  structopt::observer *events{nullptr}; // told about every step of the parse, if set
+  bool literal_values{false}; // every token is a value, e.g., of a config file setting
+
+  // Errors are recorded, not thrown - parsing stops at the first error
+  bool failed() const { return failure.has_value(); }
+
+  // Tell `events` about a step of the parse at the next token
+  // Without an observer, this is a null test: the clock is not read
+  void notify(parse_event_kind kind, std::string_view field = {}, std::size_t tokens = 0,
+              token_kind kind_of_token = token_kind::literal) const {
+#if STRUCTOPT_OBSERVERS
+    if (events != nullptr) {
+      parse_event event;
+      event.kind = kind;
+      event.time = std::chrono::steady_clock::now();
+      event.token_index = arguments.index();
+      if (!arguments.empty()) {
+        event.token = arguments.peek();
+      }
+      event.kind_of_token = kind_of_token;
+      event.field = field;
+      event.tokens = tokens;
+      event.converted = !failed();
+      event.error = failure.has_value() ? &failure.value() : nullptr;
+      events->on_event(event);
+    }
+#else
+    (void)kind, (void)field, (void)tokens, (void)kind_of_token;
+#endif
+  }
+
+  structopt::parse_error &fail(error_detail detail, std::string_view field_name = {}) {
+    if (!failure.has_value()) {
+      failure = structopt::parse_error(detail);
+      failure->token_index_ = arguments.index();
+      failure->field_name_ = field_name;
+      if (!arguments.empty()) {
+        failure->token_ = arguments.peek();
+      }
+      failure->schema_ = visitor;
+      failure->name_ = name;
+      failure->help_ = help;
+      notify(parse_event_kind::error_raised, field_name);
+    }
+    return *failure;
+  }
 
+  // e.g., -b, -v, --verbose, -abc, --foo=bar but not -5 or -3.15
   bool is_optional(std::string_view name) {
     if (double_dash_encountered) {
       return false;
-    } else if (name == "--") {
-      double_dash_encountered = true;
-      return false;
-    } else if (is_valid_number(name)) {
-      return false;
     }
 
-    bool result = false;
-    if (name.size() >= 2) {
-      // e.g., -b, -v
-      if (name[0] == '-') {
-        result = true;
-        // e.g., --verbose
-        if (name[1] == '-') {
-          result = true;
-        }
-      }
+    const auto kind = classify_token(name);
+    if (kind == token_kind::double_dash) {
+      double_dash_encountered = true;
+      return false;
     }
-    return result;
+    return kind != token_kind::literal && kind != token_kind::number;
   }
 
   bool is_kebab_case(std::string_view next, std::string_view field_name) {
@@ -2619,14 +6772,8 @@ struct parser {
       return false;
     }
 
-    bool result = false;
-    for (auto &field_name : visitor.field_names) {
-      result = is_optional_field(next, field_name);
-      if (result) {
-        break;
-      }
-    }
-    return result;
+    return fields->find_long(next) != no_field ||
+           fields->find_short(next, fields->short_names) != no_field;
   }
 
   // checks if the next argument is a delimited optional field
@@ -2654,47 +6801,27 @@ struct parser {
       }
 
       // split `next` into key and value
-      // check if key is an optional field
-      std::string key;
-      bool delimiter_found = false;
-      for (size_t i = 0; i < next.size(); i++) {
-        if (next[i] == c && !delimiter_found) {
-          delimiter = c;
-          delimiter_found = true;
-        } else {
-          if (!delimiter_found) {
-            key += next[i];
-          }
-        }
-      }
-
-      // check if `key` is a valid optional field
-      if (delimiter_found && is_optional_field(key)) {
+      // check if key is a valid optional field
+      const auto key = next.substr(0, next.find(c));
+      delimiter = c;
+      if (is_optional_field(key)) {
         success = true;
       }
     }
     return {success, delimiter};
   }
 
-  std::pair<std::string, std::string> split_delimited_argument(char delimiter,
-                                                               std::string_view next) {
-    std::string key, value;
-    bool delimiter_found = false;
-    for (size_t i = 0; i < next.size(); i++) {
-      if (next[i] == delimiter && !delimiter_found) {
-        delimiter_found = true;
-      } else {
-        if (!delimiter_found) {
-          key += next[i];
-        } else {
-          value += next[i];
-        }
-      }
+  // `--foo=bar` => {`--foo`, `bar`}, both views into `next`
+  std::pair<std::string_view, std::string_view>
+  split_delimited_argument(char delimiter, std::string_view next) {
+    const auto pos = next.find(delimiter);
+    if (pos == std::string_view::npos) {
+      return {next, {}};
     }
-    return {key, value};
+    return {next.substr(0, pos), next.substr(pos + 1)};
   }
 
-  // Get the optional field name if any from 
+  // Get the optional field name if any from
   // e.g., `-v` => `verbose`
   // e.g., `-log-level` => `log_level`
   std::optional<std::string_view> get_full_optional_field_name(std::string_view next) {
@@ -2702,279 +6829,212 @@ struct parser {
 
     if (next.size() == 2 && next[0] == '-') {
       // short form of optional argument
-      for (auto& oarg : visitor.optional_field_names) {
-        if (oarg[0] == next[1]) {
-          // second character of next matches first character of some optional field_name
-          result = oarg;
-          break;
-        }
+      // second character of next matches first character of some optional field_name
+      const auto index = fields->find_short(next, fields->short_option);
+      if (index != no_field) {
+        result = fields->names[index];
+      } else if (next[1] == 'h') {
+        result = "help";
+      } else if (next[1] == 'v') {
+        result = "version";
       }
-    } else {
+    } else if (next.find_first_not_of('-') != std::string_view::npos) {
       // long form of optional argument
 
       // strip dashes on the left
       const auto potential_field_name = next.substr(next.find_first_not_of('-'));
 
-      // check if `potential_field_name` is in the optional field names list
-      for (auto& oarg : visitor.optional_field_names) {
-        if (equal_strings_replace_hyphens(potential_field_name, oarg)) {
-          result = oarg;
-          break;
-        }
+      // check if `potential_field_name` is an optional field
+      const auto index = fields->find(potential_field_name);
+      if (index != no_field && fields->kinds[index] == field_kind::optional) {
+        result = fields->names[index];
+      } else if (equal_field_names(potential_field_name, "help")) {
+        result = "help";
+      } else if (equal_field_names(potential_field_name, "version")) {
+        result = "version";
       }
-
     }
 
     return result;
   }
 
-  template <typename T> std::pair<T, bool> parse_argument(std::string_view name) {
-    if (next_index >= arguments.size()) {
-      return {T(), false};
+  // Parse the next value(s) straight into `result`
+  // Returns false if there is nothing to parse or `T` is not supported
+  template <typename T> bool parse_argument(std::string_view name, T &result) {
+    if (arguments.empty()) {
+      return false;
     }
-    T result;
-    bool success = true;
     if constexpr (visit_struct::traits::is_visitable<T>::value) {
-      result = parse_nested_struct<T>(name);
+      parse_nested_struct(name, result);
     } else if constexpr (std::is_enum<T>::value) {
-      result = parse_enum_argument<T>(name);
-      next_index += 1;
+      parse_enum_argument(name, result);
+      arguments.advance();
     } else if constexpr (structopt::is_specialization<T, std::pair>::value) {
-      result = parse_pair_argument<typename T::first_type, typename T::second_type>(name);
+      parse_pair_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::tuple>::value) {
-      result = parse_tuple_argument<T>(name);
+      parse_tuple_argument(name, result);
+    } else if constexpr (structopt::is_specialization<T, structopt::stream>::value) {
+      parse_stream_argument(name, result);
+    } else if constexpr (structopt::is_specialization<T, structopt::lazy_vector>::value) {
+      parse_lazy_vector_argument(name, result);
     } else if constexpr (!is_stl_container<T>::value) {
-      result = parse_single_argument<T>(name);
-      next_index += 1;
+      parse_single_argument(name, result);
+      arguments.advance();
     } else if constexpr (structopt::is_array<T>::value) {
-      constexpr std::size_t N = structopt::array_size<T>::size;
-      result = parse_array_argument<typename T::value_type, N>(name);
+      parse_array_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::deque>::value ||
                          structopt::is_specialization<T, std::list>::value ||
                          structopt::is_specialization<T, std::vector>::value) {
-      result = parse_vector_like_argument<T>(name);
+      parse_vector_like_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::set>::value ||
                          structopt::is_specialization<T, std::multiset>::value ||
                          structopt::is_specialization<T, std::unordered_set>::value ||
                          structopt::is_specialization<T,
                                                       std::unordered_multiset>::value) {
-      result = parse_set_argument<T>(name);
+      parse_set_argument(name, result);
     } else if constexpr (structopt::is_specialization<T, std::queue>::value ||
                          structopt::is_specialization<T, std::stack>::value ||
                          structopt::is_specialization<T, std::priority_queue>::value) {
-      result = parse_container_adapter_argument<T>(name);
+      parse_container_adapter_argument(name, result);
     } else {
-      success = false;
+      return false;
     }
-    return {result, success};
+    return true;
   }
 
-  template <typename T> std::optional<T> parse_optional_argument(std::string_view name) {
-    next_index += 1;
-    std::optional<T> result;
-    if (next_index < arguments.size()) {
-      auto [value, success] = parse_argument<T>(name);
-      if (success) {
-        result = value;
-      } else {
-        throw structopt::exception(
-            "Error: failed to correctly parse optional argument `" + std::string{name} +
-                "`.",
-            visitor);
+  template <typename T>
+  void parse_optional_argument(std::string_view name, std::optional<T> &result) {
+    arguments.advance();
+    if (!arguments.empty()) {
+      if (!parse_argument(name, result.emplace())) {
+        result.reset();
+        fail(error_detail::optional_argument_invalid, name);
       }
     } else {
-      throw structopt::exception("Error: expected value for optional argument `" +
-                                     std::string{name} + "`.",
-                                 visitor);
+      result.reset();
+      fail(error_detail::optional_argument_missing, name);
     }
-    return result;
   }
 
   // Any field that can be constructed using std::stringstream
   // Not container type
   // Not a visitable type, i.e., a nested struct
+  //
+  // Numbers are converted with std::from_chars instead - no allocation
   template <typename T>
-  inline typename std::enable_if<!visit_struct::traits::is_visitable<T>::value, T>::type
-  parse_single_argument(std::string_view) {
-    std::string argument = arguments[next_index];
-    std::istringstream ss(argument);
-    T result;
-
-    if constexpr (std::is_integral<T>::value) {
-      if (is_hex_notation(argument)) {
-        ss >> std::hex >> result;
-      } else if (is_octal_notation(argument)) {
-        ss >> std::oct >> result;
-      } else if (is_binary_notation(argument)) {
-        argument.erase(0, 2); // remove "0b"
-        result = static_cast<T>(std::stoi(argument, nullptr, 2));
-      } else {
-        ss >> std::dec >> result;
+  inline typename std::enable_if<!visit_struct::traits::is_visitable<T>::value>::type
+  parse_single_argument(std::string_view name, T &result) {
+    if constexpr (is_number_type<T>::value) {
+      const auto ec = parse_number(arguments.peek(), result);
+      if (ec == std::errc::result_out_of_range) {
+        fail(error_detail::numeric_argument_out_of_range, name);
+      } else if (ec != std::errc()) {
+        fail(error_detail::numeric_argument_invalid, name);
       }
     } else {
+      std::istringstream ss(std::string{arguments.peek()});
       ss >> result;
     }
-
-    return result;
   }
 
   // Nested visitable struct
+  //
+  // `argument_struct` is default-constructed, or holds the values of a config file
   template <typename T>
-  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, T>::type
-  parse_nested_struct(std::string_view name) {
-
-    T argument_struct;
-
+  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value>::type
+  parse_nested_struct(std::string_view name, T &argument_struct) {
     if constexpr (std::is_base_of<structopt::sub_command, T>::value) {
       argument_struct.invoked_ = true;
     }
 
-    // Save struct field names
-    argument_struct.visitor_.name = name; // sub-command name; not the program
-    argument_struct.visitor_.version = visitor.version;
-    visit_struct::for_each(argument_struct, argument_struct.visitor_);
-
-    // add `help` and `version` optional arguments
-    argument_struct.visitor_.optional_field_names.push_back("help");
-    argument_struct.visitor_.optional_field_names.push_back("version");
-
     if (!sub_command_invoked) {
       sub_command_invoked = true;
       already_invoked_subcommand_name = name;
     } else {
       // a sub-command has already been invoked
-      throw structopt::exception(
-          "Error: failed to invoke sub-command `" + std::string{name} +
-              "` because a different sub-command, `" + already_invoked_subcommand_name +
-              "`, has already been invoked.",
-          argument_struct.visitor_);
+      fail_sub_command_conflict<T>(name);
+      return;
     }
+    notify(parse_event_kind::subcommand_entered, name);
 
     structopt::details::parser parser;
-    parser.next_index = 0;
-    parser.current_index = 0;
+    parser.name = name; // sub-command name; not the program
+    parser.version = version;
+    parser.visitor = &schema<T>(); // shared by every parser of a `T`
     parser.double_dash_encountered = double_dash_encountered;
-    parser.visitor = argument_struct.visitor_;
-
-    std::copy(arguments.begin() + next_index, arguments.end(),
-              std::back_inserter(parser.arguments));
-
-    for (std::size_t i = 0; i < parser.arguments.size(); i++) {
-      parser.current_index = i;
-      visit_struct::for_each(argument_struct, parser);
-    }
-
-    // directly call the parser to check for `help` and `version` flags
-    std::optional<bool> help = false, version = false;
-    for (std::size_t i = 0; i < parser.arguments.size(); i++) {
-      parser.operator()("help", help);
-      parser.operator()("version", version);
-
-      if (help == true) {
-        // if help is requested, print help and exit
-        argument_struct.visitor_.print_help(std::cout);
-        exit(EXIT_SUCCESS);
-      } else if (version == true) {
-        // if version is requested, print version and exit
-        std::cout << argument_struct.visitor_.version << "\n";
-        exit(EXIT_SUCCESS);
-      }
+    parser.num_threads = num_threads;
+    parser.records = records;
+    parser.events = events;
+    // hand the cursor to the sub-command; the tokens themselves are not copied
+    parser.arguments = std::move(arguments);
+
+    parser.parse_struct(argument_struct);
+    if (!parser.failed()) {
+      parser.check_positional_fields();
     }
 
-    // if all positional arguments were provided
-    // this list would be empty
-    if (!parser.visitor.positional_field_names.empty()) {
-      for (auto &field_name : parser.visitor.positional_field_names) {
-        if (std::find(parser.visitor.vector_like_positional_field_names.begin(),
-                      parser.visitor.vector_like_positional_field_names.end(),
-                      field_name) ==
-            parser.visitor.vector_like_positional_field_names.end()) {
-          // this positional argument is not a vector-like argument
-          // it expects value(s)
-          throw structopt::exception("Error: expected value for positional argument `" +
-                                         std::string(field_name) + "`.",
-                                     argument_struct.visitor_);
-        }
-      }
+    // continue after the tokens consumed by the sub-command
+    arguments = std::move(parser.arguments);
+    if (parser.failed()) {
+      failure = std::move(parser.failure);
     }
+  }
 
-    // update current and next
-    current_index += parser.next_index;
-    next_index += parser.next_index;
-
-    return argument_struct;
+  // Reported with the help of the sub-command `name`
+  template <typename T> void fail_sub_command_conflict(std::string_view name) {
+    auto &error = fail(error_detail::sub_command_conflict, name);
+    error.other_sub_command_ = already_invoked_subcommand_name;
+    error.schema_ = &schema<T>();
+    error.name_ = name;
+    error.help_ = {};
   }
 
   // Pair argument
   template <typename T1, typename T2>
-  std::pair<T1, T2> parse_pair_argument(std::string_view name) {
-    std::pair<T1, T2> result;
+  void parse_pair_argument(std::string_view name, std::pair<T1, T2> &result) {
     {
       // Pair first
-      auto [value, success] = parse_argument<T1>(name);
-      if (success) {
-        result.first = value;
-      } else {
-        if (next_index == arguments.size()) {
+      if (!parse_argument(name, result.first)) {
+        if (arguments.empty()) {
           // end of arguments list
           // first argument not provided
-          throw structopt::exception("Error: failed to correctly parse the pair `" +
-                                         std::string{name} +
-                                         "`. Expected 2 arguments, 0 provided.",
-                                     visitor);
+          fail(error_detail::pair_argument_missing, name).provided_ = 0;
         } else {
-          throw structopt::exception(
-              "Error: failed to correctly parse first element of pair `" +
-                  std::string{name} + "`",
-              visitor);
+          fail(error_detail::pair_element_invalid, name).provided_ = 0;
         }
       }
     }
+    if (failed()) {
+      return;
+    }
     {
       // Pair second
-      auto [value, success] = parse_argument<T2>(name);
-      if (success) {
-        result.second = value;
-      } else {
-        if (next_index == arguments.size()) {
+      if (!parse_argument(name, result.second)) {
+        if (arguments.empty()) {
           // end of arguments list
           // second argument not provided
-          throw structopt::exception("Error: failed to correctly parse the pair `" +
-                                         std::string{name} +
-                                         "`. Expected 2 arguments, only 1 provided.",
-                                     visitor);
+          fail(error_detail::pair_argument_missing, name).provided_ = 1;
         } else {
-          throw structopt::exception(
-              "Error: failed to correctly parse second element of pair `" +
-                  std::string{name} + "`",
-              visitor);
+          fail(error_detail::pair_element_invalid, name).provided_ = 1;
         }
       }
     }
-    return result;
   }
 
   // Array argument
   template <typename T, std::size_t N>
-  std::array<T, N> parse_array_argument(std::string_view name) {
-    std::array<T, N> result{};
-
-    const auto arguments_left = arguments.size() - next_index;
+  void parse_array_argument(std::string_view name, std::array<T, N> &result) {
+    const auto arguments_left = arguments.size();
     if (arguments_left == 0 || arguments_left < N) {
-      throw structopt::exception("Error: expected " + std::to_string(N) +
-                                     " values for std::array argument `" + std::string(name) +
-                                     "` - instead got only " +
-                                     std::to_string(arguments_left) + " arguments.",
-                                 visitor);
+      auto &error = fail(error_detail::array_argument_missing, name);
+      error.expected_ = N;
+      error.provided_ = arguments_left;
+      return;
     }
 
-    for (std::size_t i = 0; i < N; i++) {
-      auto [value, success] = parse_argument<T>(name);
-      if (success) {
-        result[i] = value;
-      }
+    for (std::size_t i = 0; i < N && !failed(); i++) {
+      parse_argument(name, result[i]);
     }
-    return result;
   }
 
   template <class Tuple, class F, std::size_t... I>
@@ -2990,396 +7050,811 @@ struct parser {
                              std::tuple_size<std::remove_reference_t<Tuple>>::value>{});
   }
 
+  // Checks if `next` marks the end of a container argument, e.g., `--verbose`, `--`
+  bool is_end_of_container(std::string_view next) {
+    if (literal_values) {
+      // e.g., `files = ["--", "--verbose"]` in a config file
+      return false;
+    }
+    const auto kind = classify_token(next);
+    if (kind == token_kind::literal || kind == token_kind::number) {
+      // a value - no need to look up fields
+      return false;
+    }
+    return is_optional_field(next) || next == "--" ||
+           is_delimited_optional_argument(next).first;
+  }
+
+  // Containers of strings at least this long are converted on `num_threads` threads
+  static constexpr std::size_t parallel_conversion_threshold = 1 << 16;
+
+  // Number of tokens, starting at the cursor, before the end of a container argument
+  // Used to reserve capacity up front; each token is classified once more
+  std::size_t count_container_values() {
+    const auto size = arguments.size();
+    std::size_t result = 0;
+    while (result < size && !is_end_of_container(arguments.peek(result))) {
+      result += 1;
+    }
+    return result;
+  }
+
+  // `-` among the values of a container, with record input enabled
+  bool is_record_input(std::string_view next) const {
+    return records != nullptr && !literal_values && next == "-";
+  }
+
+  // Pass every record of the input to `on_record`
+  template <typename F> void read_records(std::string_view name, F &&on_record) {
+    while (!failed()) {
+      const auto record = records->next();
+      if (!record.has_value()) {
+        break;
+      }
+      on_record(record.value());
+    }
+    if (!failed() && records->failed()) {
+      fail(error_detail::record_input_failed, name);
+    }
+  }
+
+  // Parse the values of a container, from the cursor till the end of the container
+  //
+  // `parse_value` parses the next token into one element of type `V`. A `-` is
+  // replaced by the records of the input, if enabled: every record becomes the next
+  // token, so records are converted exactly like arguments
+  template <typename V, typename F>
+  void parse_container_values(std::string_view name, F &&parse_value) {
+    while (!arguments.empty() && !failed()) {
+      const std::string_view next = arguments.peek();
+      if (is_end_of_container(next)) {
+        if (next == "--") {
+          double_dash_encountered = true;
+          arguments.advance();
+        }
+        // this marks the end of the container (break here)
+        break;
+      }
+      if constexpr (is_single_token_value<V>::value) {
+        if (is_record_input(next)) {
+          arguments.advance();
+          read_records(name, [&](std::string_view record) {
+            arguments.push_front(record);
+            parse_value();
+          });
+          continue;
+        }
+      }
+      parse_value();
+    }
+  }
+
   // Parse single tuple element
   template <typename T>
   void parse_tuple_element(std::string_view name, std::size_t index, std::size_t size,
-                           T &&result) {
-    auto [value, success] = parse_argument<typename std::remove_reference<T>::type>(name);
-    if (success) {
-      result = value;
-    } else {
-      if (next_index == arguments.size()) {
+                           T &result) {
+    if (failed()) {
+      return;
+    }
+    if (!parse_argument(name, result)) {
+      if (arguments.empty()) {
         // end of arguments list
         // failed to parse tuple <>. expected `size` arguments, `index` provided
-        throw structopt::exception("Error: failed to correctly parse tuple `" +
-                                       std::string{name} + "`. Expected " +
-                                       std::to_string(size) + " arguments, " +
-                                       std::to_string(index) + " provided.",
-                                   visitor);
+        auto &error = fail(error_detail::tuple_argument_missing, name);
+        error.expected_ = size;
+        error.provided_ = index;
+      } else {
+        auto &error = fail(error_detail::tuple_element_invalid, name);
+        error.expected_ = size;
+        error.provided_ = index;
+      }
+    }
+  }
+
+  // Tuple argument
+  template <typename Tuple>
+  void parse_tuple_argument(std::string_view name, Tuple &result) {
+    std::size_t i = 0;
+    constexpr auto tuple_size = std::tuple_size<Tuple>::value;
+    for_each(result, [&](auto &&arg) {
+      parse_tuple_element(name, i, tuple_size, arg);
+      i += 1;
+    });
+  }
+
+  // Vector, deque, list
+  template <typename T>
+  void parse_vector_like_argument(std::string_view name, T &result) {
+    result.clear();
+    if constexpr (std::is_same<T, std::vector<std::string>>::value) {
+      const auto count = count_container_values();
+      if (count >= parallel_conversion_threshold && records == nullptr &&
+          resolve_thread_count(num_threads) > 1) {
+        // e.g., a file list read from a large response file
+        // the strings are independent - copy them on several threads
+        constexpr std::size_t block_size = 4096;
+        result.resize(count);
+        parallel_for((count + block_size - 1) / block_size, num_threads,
+                     [&](std::size_t block) {
+                       const auto last = std::min(count, (block + 1) * block_size);
+                       for (auto i = block * block_size; i < last; i++) {
+                         result[i].assign(arguments.peek(i));
+                       }
+                     });
+        arguments.advance(count);
+      } else {
+        result.reserve(count);
+      }
+    } else if constexpr (structopt::is_specialization<T, std::vector>::value &&
+                         is_single_token_value<typename T::value_type>::value) {
+      result.reserve(count_container_values());
+    }
+
+    parse_container_values<typename T::value_type>(name, [&] {
+      if constexpr (std::is_same<typename T::value_type, bool>::value) {
+        // std::vector<bool> has no bool& to parse into
+        bool value;
+        if (parse_argument(name, value)) {
+          result.push_back(value);
+        }
+      } else {
+        // construct the element in place
+        if (!parse_argument(name, result.emplace_back())) {
+          result.pop_back();
+        }
+      }
+    });
+  }
+
+  // stack, queue, priority_queue
+  template <typename T>
+  void parse_container_adapter_argument(std::string_view name, T &result) {
+    result = T();
+    parse_container_values<typename T::value_type>(name, [&] {
+      typename T::value_type value;
+      if (parse_argument(name, value)) {
+        result.push(std::move(value));
+      }
+    });
+  }
+
+  // Set, multiset, unordered_set, unordered_multiset
+  template <typename T> void parse_set_argument(std::string_view name, T &result) {
+    result.clear();
+    if constexpr (structopt::is_specialization<T, std::unordered_set>::value ||
+                  structopt::is_specialization<T, std::unordered_multiset>::value) {
+      result.reserve(count_container_values());
+    }
+    parse_container_values<typename T::value_type>(name, [&] {
+      typename T::value_type value;
+      if (parse_argument(name, value)) {
+        result.insert(std::move(value));
+      }
+    });
+  }
+
+  // structopt::stream - every value goes to the sink as soon as it is parsed
+  template <typename T>
+  void parse_stream_argument(std::string_view name, stream<T> &result) {
+    result.size_ = 0;
+    T value{};
+    parse_container_values<T>(name, [&] {
+      if (parse_argument(name, value) && !failed()) {
+        result.size_ += 1;
+        if (result.sink_) {
+          result.sink_(std::move(value));
+        }
+      }
+    });
+  }
+
+  // structopt::lazy_vector - only the text of the values is stored
+  template <typename T>
+  void parse_lazy_vector_argument(std::string_view name, lazy_vector<T> &result) {
+    result = lazy_vector<T>();
+    result.name_ = name;
+    const auto count = count_container_values();
+    std::size_t text_size = 0;
+    for (std::size_t i = 0; i < count; i++) {
+      text_size += arguments.peek(i).size();
+    }
+    result.reserve(count, text_size);
+    for (std::size_t i = 0; i < count && !failed(); i++) {
+      if (is_record_input(arguments.peek())) {
+        // the text of the records is copied like the text of the tokens
+        arguments.advance();
+        read_records(name, [&](std::string_view record) { result.push_back(record); });
       } else {
-        throw structopt::exception("Error: failed to correctly parse tuple `" +
-                                       std::string{name} +
-                                       "` {size = " + std::to_string(size) +
-                                       "} at index " + std::to_string(index) + ".",
-                                   visitor);
+        result.push_back(arguments.peek());
+        arguments.advance();
+      }
+    }
+    if (failed()) {
+      return;
+    }
+
+    if (!arguments.empty() && arguments.peek() == "--") {
+      // this marks the end of the container
+      double_dash_encountered = true;
+      arguments.advance();
+    }
+  }
+
+  // Enum class
+  template <typename T> void parse_enum_argument(std::string_view name, T &result) {
+    auto maybe_enum_value = magic_enum::enum_cast<T>(arguments.peek());
+    if (maybe_enum_value.has_value()) {
+      result = maybe_enum_value.value();
+    } else {
+      fail(error_detail::enum_argument_invalid, name).allowed_values_ =
+          &allowed_enum_values<T>;
+    }
+  }
+
+  // e.g., "RED, GREEN, BLUE"; only formatted for error messages
+  template <typename T> static std::string allowed_enum_values() {
+    constexpr auto allowed_names = magic_enum::enum_names<T>();
+
+    std::string allowed_names_string = "";
+    if (allowed_names.size()) {
+      for (size_t i = 0; i < allowed_names.size() - 1; i++) {
+        allowed_names_string += std::string{allowed_names[i]} + ", ";
+      }
+      allowed_names_string += allowed_names[allowed_names.size() - 1];
+    }
+    return allowed_names_string;
+  }
+
+  // Parse the fields of `argument_struct` in a single pass over `arguments`
+  //
+  // Every token, starting at the cursor, is inspected exactly once and routed
+  // to the field it belongs to. Parsing stops at the end of the argument list or
+  // at the first token that does not belong to this struct - the caller (e.g., the
+  // parser of an enclosing struct) decides what to do with it
+  template <typename T> void parse_struct(T &argument_struct) {
+    visitor = &schema<T>();
+    fields = &field_table_of<T>::value;
+
+    while (!arguments.empty() && !failed()) {
+      const auto position = arguments.position();
+      const std::string_view next = arguments.peek();
+
+      // after `--`, every token is a positional argument
+      const auto kind =
+          double_dash_encountered ? token_kind::literal : classify_token(next);
+      notify(parse_event_kind::token_classified, {}, 0, kind);
+      if (kind == token_kind::double_dash) {
+        double_dash_encountered = true;
+        arguments.advance();
+        continue;
+      }
+
+      const bool consumed = kind == token_kind::literal || kind == token_kind::number
+                                ? parse_positional_token(argument_struct, next)
+                                : parse_optional_token(argument_struct, next, kind);
+      if (!consumed || arguments.position() == position) {
+        break;
+      }
+    }
+  }
+
+  // Find the index of the optional (or flag) field that `next` refers to, if any
+  //
+  // If both the long and the short form match, the field declared first wins,
+  // e.g., with fields `value` and `v`, `-v` maps to `value`
+  std::optional<std::size_t> find_optional_field(std::string_view next) {
+    auto result = fields->find_long(next);
+    if (result != no_field && !fields->is_flag_or_option(result)) {
+      result = no_field;
+    }
+    result = (std::min)(result, fields->find_short(next, fields->short_flag_or_option));
+    if (result == no_field) {
+      return std::nullopt;
+    }
+    return result;
+  }
+
+  // Find the index of the nested struct (sub-command) field named `next`, if any
+  std::optional<std::size_t> find_nested_struct_field(std::string_view next) {
+    const auto index = fields->find(next);
+    if (index != no_field && fields->kinds[index] == field_kind::nested_struct &&
+        fields->names[index] == next) {
+      return index;
+    }
+    return std::nullopt;
+  }
+
+  // Find the index of the positional field named `field_name`
+  std::optional<std::size_t> find_positional_field(std::string_view field_name) {
+    const auto index = fields->find(field_name);
+    if (index != no_field && fields->kinds[index] == field_kind::positional) {
+      return index;
+    }
+    return std::nullopt;
+  }
+
+  // `next` looks like an optional argument, i.e., starts with `-` or `--`
+  template <typename T>
+  bool parse_optional_token(T &argument_struct, std::string_view next, token_kind kind) {
+    // see if there is an optional field in the struct with a matching name
+    if (const auto field = find_optional_field(next); field.has_value()) {
+      return parse_field_at(argument_struct, field.value());
+    }
+
+    // maybe this is an optional argument that is delimited with '=' or ':'
+    // e.g., --foo=bar or --foo:BAR
+    if (kind == token_kind::delimited_option) {
+      const auto [success, delimiter] = is_delimited_optional_argument(next);
+      if (success) {
+        const auto [lhs, rhs] = split_delimited_argument(delimiter, next);
+
+        // get past the current argument, e.g., `--foo=bar`
+        arguments.advance();
+
+        // if `lhs` is an optional argument (i.e., maps to an optional field in the
+        // original struct), then queue `lhs` and `rhs` as the next two tokens
+        // the parser will take care of the rest
+        auto potential_field_name = get_full_optional_field_name(lhs);
+        if (potential_field_name.has_value()) {
+          arguments.push_front(rhs);
+          arguments.push_front(lhs);
+        }
+        return true;
       }
     }
-  }
 
-  // Tuple argument
-  template <typename Tuple> Tuple parse_tuple_argument(std::string_view name) {
-    Tuple result;
-    std::size_t i = 0;
-    constexpr auto tuple_size = std::tuple_size<Tuple>::value;
-    for_each(result, [&](auto &&arg) {
-      parse_tuple_element(name, i, tuple_size, arg);
-      i += 1;
-    });
-    return result;
+    // This _could_ be a combined argument
+    // e.g., -abc => -a, -b, and -c where each of these is a flag argument
+    if (parse_combined_argument(next)) {
+      return true;
+    }
+
+    // `help` and `version` are checked last so that user-defined fields,
+    // e.g., `verbose`, take precedence over their short forms
+    if (parse_help_or_version(next)) {
+      return true;
+    }
+
+    // Any other option followed by a value is a value of the positional container
+    // waiting for values, as it would be after the container's first value, e.g.,
+    // `--foo` in `./main --foo bar` with a field `std::vector<std::string> files`
+    if (is_waiting_for_container() && has_container_value()) {
+      return parse_positional_token(argument_struct, next);
+    }
+    return false;
   }
 
-  // Vector, deque, list
-  template <typename T> T parse_vector_like_argument(std::string_view name) {
-    T result;
-
-    // Parse from current till end
-    while (next_index < arguments.size()) {
-      const std::string_view next = arguments[next_index];
-      if (is_optional_field(next) || next == "--" ||
-          is_delimited_optional_argument(next).first) {
-        if (next == "--") {
-          double_dash_encountered = true;
-          next_index += 1;
-        }
-        // this marks the end of the container (break here)
-        break;
-      }
-      auto [value, success] = parse_argument<typename T::value_type>(name);
-      if (success) {
-        result.push_back(value);
-      }
+  // The next positional field is a container, e.g., a std::vector
+  bool is_waiting_for_container() const {
+    if (positional_index >= visitor->positional_field_names.size()) {
+      return false;
     }
-    return result;
+    const auto &containers = visitor->vector_like_positional_field_names;
+    return std::find(containers.begin(), containers.end(),
+                     visitor->positional_field_names[positional_index]) !=
+           containers.end();
   }
 
-  // stack, queue, priority_queue
-  template <typename T> T parse_container_adapter_argument(std::string_view name) {
-    T result;
-    // Parse from current till end
-    while (next_index < arguments.size()) {
-      const std::string_view next = arguments[next_index];
-      if (is_optional_field(next) || next == "--" ||
-          is_delimited_optional_argument(next).first) {
-        if (next == "--") {
-          double_dash_encountered = true;
-          next_index += 1;
-        }
-        // this marks the end of the container (break here)
-        break;
+  // A value, i.e., not an option, follows the cursor before the end of the container
+  bool has_container_value() {
+    for (std::size_t i = 1; i < arguments.size(); i++) {
+      const auto next = arguments.peek(i);
+      if (is_end_of_container(next)) {
+        return false;
       }
-      auto [value, success] = parse_argument<typename T::value_type>(name);
-      if (success) {
-        result.push(value);
+      const auto kind = classify_token(next);
+      if (kind == token_kind::literal || kind == token_kind::number) {
+        return true;
       }
     }
-    return result;
+    return false;
   }
 
-  // Set, multiset, unordered_set, unordered_multiset
-  template <typename T> T parse_set_argument(std::string_view name) {
-    T result;
-    // Parse from current till end
-    while (next_index < arguments.size()) {
-      const std::string_view next = arguments[next_index];
-      if (is_optional_field(next) || next == "--" ||
-          is_delimited_optional_argument(next).first) {
-        if (next == "--") {
-          double_dash_encountered = true;
-          next_index += 1;
-        }
-        // this marks the end of the container (break here)
-        break;
+  bool parse_combined_argument(std::string_view next) {
+    if (is_optional_field(next) || next[0] != '-' || next.size() < 2 || next[1] == '-') {
+      return false;
+    }
+
+    // e.g., `-abc` => `abc`
+    const auto potential_combined_argument = next.substr(1);
+
+    // Every element of the combined argument must be a known field
+    // and at least one of them must be an optional field
+    bool optional_field_matched = false;
+    for (auto c : potential_combined_argument) {
+      const auto arg = short_option_token(c);
+      if (!is_optional_field(arg)) {
+        // TODO: report error unrecognized option in combined argument
+        return false;
       }
-      auto [value, success] = parse_argument<typename T::value_type>(name);
-      if (success) {
-        result.insert(value);
+      if (find_optional_field(arg).has_value()) {
+        optional_field_matched = true;
       }
     }
-    return result;
-  }
 
-  // Enum class
-  template <typename T> T parse_enum_argument(std::string_view name) {
-    T result;
-    auto maybe_enum_value = magic_enum::enum_cast<T>(arguments[next_index]);
-    if (maybe_enum_value.has_value()) {
-      result = maybe_enum_value.value();
-    } else {
-      constexpr auto allowed_names = magic_enum::enum_names<T>();
+    if (!optional_field_matched) {
+      return false;
+    }
 
-      std::string allowed_names_string = "";
-      if (allowed_names.size()) {
-        for (size_t i = 0; i < allowed_names.size() - 1; i++) {
-          allowed_names_string += std::string{allowed_names[i]} + ", ";
-        }
-        allowed_names_string += allowed_names[allowed_names.size() - 1];
-      }
+    // confirmed: this is a combined argument
 
-      throw structopt::exception(
-          "Error: unexpected input `" + std::string{arguments[next_index]} +
-              "` provided for enum argument `" + std::string{name} +
-              "`. Allowed values are {" + allowed_names_string + "}",
-          visitor);
-      // TODO: Throw error invalid enum option
+    // get past the current combined argument
+    arguments.advance();
+
+    // queue the individual options that make up the combined argument
+    // e.g., "./main -abc" is read as "./main -a -b -c"
+    // so that the parser loop will service `-a`, `-b` and `-c` like any other
+    // optional arguments (flags and otherwise)
+    for (auto it = potential_combined_argument.rbegin();
+         it != potential_combined_argument.rend(); ++it) {
+      arguments.push_front(short_option_token(*it));
     }
-    return result;
+    return true;
+  }
+
+  // `-h`/`--help` and `-v`/`--version` are added to every struct
+  bool parse_help_or_version(std::string_view next) {
+    if (is_optional_field(next, "help")) {
+      // if help is requested, stop here
+      // app::parse prints help and exits
+      fail(error_detail::help_requested, "help");
+      return true;
+    } else if (is_optional_field(next, "version")) {
+      // if version is requested, stop here
+      // app::parse prints the version and exits
+      fail(error_detail::version_requested, "version").version_ = version;
+      return true;
+    }
+    return false;
   }
 
-  // Visitor function for nested struct
+  // `next` is a positional argument or the name of a sub-command
   template <typename T>
-  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, void>::type
-  operator()(std::string_view name, T &value) {
-    if (next_index > current_index) {
-      current_index = next_index;
+  bool parse_positional_token(T &argument_struct, std::string_view next) {
+    const auto nested_struct_field = find_nested_struct_field(next);
+
+    std::optional<std::size_t> positional_field;
+    if (positional_index < visitor->positional_field_names.size()) {
+      positional_field =
+          find_positional_field(visitor->positional_field_names[positional_index]);
     }
 
-    if (current_index < arguments.size()) {
-      const auto next = arguments[current_index];
-      const auto field_name = std::string_view{name};
+    // If `next` names a sub-command, it is parsed as one unless a positional field
+    // declared before the sub-command is still waiting for a value
+    if (nested_struct_field.has_value() &&
+        (!positional_field.has_value() ||
+         nested_struct_field.value() < positional_field.value())) {
+      return parse_field_at(argument_struct, nested_struct_field.value());
+    }
 
-      // Check if `next` is the start of a subcommand
-      if (visitor.is_field_name(next) && next == field_name) {
-        next_index += 1;
-        value = parse_nested_struct<T>(name);
-      }
+    if (!positional_field.has_value()) {
+      // We're not looking to save any more positional fields
+      // all of them already have a value
+      return false;
     }
-  }
 
-  // Visitor function for any positional field (not std::optional)
-  template <typename T>
-  inline typename std::enable_if<!structopt::is_specialization<T, std::optional>::value &&
-                                     !visit_struct::traits::is_visitable<T>::value,
-                                 void>::type
-  operator()(std::string_view name, T &result) {
-    if (next_index > current_index) {
-      current_index = next_index;
+    if (!parse_field_at(argument_struct, positional_field.value())) {
+      // positional field does not yet have a value
+      return false;
     }
 
-    if (current_index < arguments.size()) {
-      const auto next = arguments[current_index];
+    // Move on to the next positional field
+    positional_index += 1;
+    return true;
+  }
 
-      if (is_optional(next)) {
-        return;
+  // Optional fields of `argument_struct` that were not given in the arguments take
+  // the value of their environment variable, if it is set
+  //
+  // The value is parsed like the value of the option, e.g., `APP_VERBOSE=on` for a
+  // flag `verbose`. `environ` is scanned once, and not at all if no field has a
+  // variable
+  template <typename T>
+  void parse_environment(T &argument_struct, const environment_options &options,
+                         char **entries) {
+    if (entries == nullptr || *entries == nullptr) {
+      return;
+    }
+    const auto &table = field_table_of<T>::value;
+    field_set wanted;
+    for (std::size_t i = 0; i < table.size; i++) {
+      wanted[i] = table.is_flag_or_option(static_cast<field_index_t>(i)) &&
+                  (given_options == nullptr || !(*given_options)[i]);
+    }
+    const environment variables(table, environment_names_of<T>(), options, wanted,
+                                entries);
+    for (std::size_t i = 0; i < table.size && !failed(); i++) {
+      if (const auto variable = variables.value(i)) {
+        // the value is the next, and only, token
+        arguments.push_front(variable.value());
+        const auto &field = field_accessor_at<T>(i);
+        field.parse_setting(*this, argument_struct, field.pointer, table.names[i], nullptr,
+                            1);
       }
+    }
+  }
 
-      if (visitor.positional_field_names.empty()) {
-        // We're not looking to save any more positional fields
-        // all of them already have a value
-        throw structopt::exception("Error: unexpected argument '" + next + "'", visitor);
-        return;
+  // Fill `argument_struct` from table `table` of the settings of a source, e.g., a
+  // config file, and its subtables
+  //
+  // Keys name optional fields and subtables name nested structs, as options and
+  // sub-commands do in the arguments; a subtable does not invoke its sub-command.
+  // Values are parsed like the values of options, and a flag takes its value, e.g.,
+  // `verbose = true`, instead of being toggled
+  template <typename T>
+  void parse_config_table(T &argument_struct, const settings &config,
+                          std::size_t table) {
+    const auto outer_visitor = visitor;
+    const auto outer_fields = fields;
+    visitor = &schema<T>();
+    fields = &field_table_of<T>::value;
+
+    const auto [first, last] = config.entries_of(table);
+    for (auto entry = first; entry != last && !failed(); ++entry) {
+      bool known = false;
+      find_config_fields<T>(config, entry->key, [&](std::size_t index) {
+        if (failed() || !fields->is_flag_or_option(index)) {
+          return;
+        }
+        known = true;
+        // the values are the next tokens
+        for (auto i = entry->last_value; i > entry->first_value; i--) {
+          arguments.push_front(config.values[i - 1]);
+        }
+        const auto &field = field_accessor_at<T>(index);
+        field.parse_setting(*this, argument_struct, field.pointer, fields->names[index],
+                            &config, entry->last_value - entry->first_value);
+        if (!failed() && !arguments.empty()) {
+          fail(error_detail::config_too_many_values, fields->names[index]);
+        }
+        arguments.advance(arguments.size());
+      });
+      if (!known && !failed() && !config.ignore_unknown_keys) {
+        fail(error_detail::config_key_unknown).token_ = entry->key;
       }
+      locate_config_failure(config, entry->line);
+    }
 
-      const auto field_name = visitor.positional_field_names.front();
-
-      // // This will be parsed as a subcommand (nested struct)
-      // if (visitor.is_field_name(next) && next == field_name) {
-      //   return;
-      // }
-
-      if (field_name != std::string{name}) {
-        // current field is not the one we want to parse
-        return;
+    for (std::size_t child = 1; child < config.tables.size() && !failed(); child++) {
+      if (config.tables[child].parent != table) {
+        continue;
+      }
+      bool known = false;
+      find_config_fields<T>(config, config.tables[child].name, [&](std::size_t index) {
+        if (failed() || fields->kinds[index] != field_kind::nested_struct) {
+          return;
+        }
+        known = true;
+        const auto &field = field_accessor_at<T>(index);
+        field.parse_setting(*this, argument_struct, field.pointer, fields->names[index],
+                            &config, child);
+      });
+      if (!known && !failed() && !config.ignore_unknown_keys) {
+        fail(error_detail::config_key_unknown).token_ = config.tables[child].name;
+        locate_config_failure(config, 0);
       }
+    }
 
-      // Remove from the positional field list as it is about to be parsed
-      visitor.positional_field_names.pop_front();
+    visitor = outer_visitor;
+    fields = outer_fields;
+  }
 
-      auto [value, success] = parse_argument<T>(field_name);
-      if (success) {
-        result = value;
-      } else {
-        // positional field does not yet have a value
-        visitor.positional_field_names.push_front(field_name);
-      }
+  // Calls `f(index)` for every field of `T` that `key` of `config` names: with the
+  // kebab-case rules of options or, for environment variables, the name env_prefix
+  // reads, e.g., `LOG_LEVEL` for `log_level`
+  template <typename T, typename F>
+  void find_config_fields(const settings &config, std::string_view key, F &&f) {
+    if (config.environment_keys) {
+      environment_names_of<T>().find(key, f);
+    } else if (const auto index = fields->find(key); index != no_field) {
+      f(index);
     }
   }
 
-  // Visitor function for std::optional field
-  template <typename T>
-  inline typename std::enable_if<structopt::is_specialization<T, std::optional>::value,
-                                 void>::type
-  operator()(std::string_view name, T &value) {
-    if (next_index > current_index) {
-      current_index = next_index;
+  // Errors in a source are reported with its origin and the line of the entry
+  void locate_config_failure(const settings &config, std::size_t line) {
+    if (failed() && failure->source_.empty()) {
+      failure->source_ = config.origin;
+      failure->line_ = line;
+      failure->token_index_ = 0;
     }
+  }
 
-    if (current_index < arguments.size()) {
-      const auto next = arguments[current_index];
-      const auto field_name = std::string{name};
+  // A setting, e.g., of a config file or the environment: `item` is the table of a
+  // nested struct in `config`, or the number of values of an option in the tokens
+  template <typename T>
+  void parse_setting(std::string_view name, T &value, const settings *config,
+                     std::size_t item) {
+    if constexpr (visit_struct::traits::is_visitable<T>::value) {
+      parse_config_table(value, *config, item);
+    } else if constexpr (structopt::is_specialization<T, std::optional>::value) {
+      // a setting is never an option, nor `--`, nor `-` for the records of the input
+      const bool outer_literal_values = literal_values;
+      literal_values = true;
+      if (item == 0) {
+        // e.g., `tags = []`
+        if constexpr (is_stl_container<typename T::value_type>::value) {
+          value.emplace();
+        } else {
+          fail(error_detail::optional_argument_missing, name);
+        }
+      } else if (!parse_argument(name, value.emplace())) {
+        value.reset();
+        fail(error_detail::optional_argument_invalid, name);
+      }
+      literal_values = outer_literal_values;
+    }
+  }
 
-      if (next == "--" && double_dash_encountered == false) {
-        double_dash_encountered = true;
-        next_index += 1;
+  // Throws if a positional field did not receive a value
+  void check_positional_fields() {
+    // if all positional arguments were provided
+    // there would be no fields left to check
+    for (auto i = positional_index; i < visitor->positional_field_names.size(); i++) {
+      const auto field_name = visitor->positional_field_names[i];
+      if (std::find(visitor->vector_like_positional_field_names.begin(),
+                    visitor->vector_like_positional_field_names.end(),
+                    field_name) == visitor->vector_like_positional_field_names.end()) {
+        // this positional argument is not a vector-like argument
+        // it expects value(s)
+        fail(error_detail::positional_argument_missing, field_name);
         return;
       }
+    }
+  }
 
-      // if `next` looks like an optional argument
-      // i.e., starts with `-` or `--`
-      // see if you can find an optional field in the struct with a matching name
+  // A field of `T`, with its type erased: a pointer to the member, and the parsers of
+  // its type. The parsers are instantiated once per field type rather than once per
+  // field, e.g., 64 std::optional<int> fields share them
+  template <typename T> struct field_accessor {
+    using member = char T::*;
+    bool (*parse)(parser &, T &, member, std::string_view);
+    // see parse_setting
+    void (*parse_setting)(parser &, T &, member, std::string_view, const settings *,
+                          std::size_t);
+    member pointer; // converted back to `F T::*` by the parsers
+  };
 
-      // check if the current argument looks like it could be this optional field
-      if (double_dash_encountered == false && is_optional_field(next, field_name)) {
+  template <typename T, typename F>
+  static bool parse_member(parser &self, T &s, char T::*member, std::string_view name) {
+    return self.parse_field(name, s.*reinterpret_cast<F T::*>(member));
+  }
 
-        // this is an optional argument matching the current struct field
-        if constexpr (std::is_same<typename T::value_type, bool>::value) {
-          // It is a boolean optional argument
-          // Does it have a default value?
-          // If yes, this is a FLAG argument, e.g,, "--verbose" will set it to true if the
-          // default value is false No need to write "--verbose true"
-          if (value.has_value()) {
-            // The field already has a default value!
-            value = !value.value(); // simply toggle it
-            next_index += 1;
-          } else {
-            // boolean optional argument doesn't have a default value
-            // expect one
-            value = parse_optional_argument<typename T::value_type>(name);
-          }
-        } else {
-          // Not std::optional<bool>
-          // Parse the argument type <T>
-          value = parse_optional_argument<typename T::value_type>(name);
-        }
-      } else {
-        if (double_dash_encountered == false) {
-
-          // maybe this is an optional argument that is delimited with '=' or ':'
-          // e.g., --foo=bar or --foo:BAR
-          if (next.size() > 1 && next[0] == '-') {
-            const auto [success, delimiter] = is_delimited_optional_argument(next);
-            if (success) {
-              const auto [lhs, rhs] = split_delimited_argument(delimiter, next);
-              // update next_index and return
-              // the parser will take care of the rest
-
-              // if `lhs` is an optional argument (i.e., maps to an optional field in the original struct), then insert into arguments list
-              auto potential_field_name = get_full_optional_field_name(lhs);
-              if (potential_field_name.has_value()) {
-                for (auto &arg : {rhs, lhs}) {
-                  const auto begin = arguments.begin();
-                  arguments.insert(begin + next_index + 1, arg);
-                }
-              }
-              // get past the current argument, e.g., `--foo=bar`
-              next_index += 1;
-              return;
-            }
-          }
+  template <typename T, typename F>
+  static void parse_setting_member(parser &self, T &s, char T::*member,
+                                   std::string_view name, const settings *config,
+                                   std::size_t item) {
+    self.parse_setting(name, s.*reinterpret_cast<F T::*>(member), config, item);
+  }
 
-          // A direct match of optional argument with field_name has not happened
-          // This _could_ be a combined argument
-          // e.g., -abc => -a, -b, and -c where each of these is a flag argument
+  template <typename T, auto... Pointers>
+  static std::array<field_accessor<T>, sizeof...(Pointers)>
+  make_field_accessors(visit_struct::member_list<nullptr, Pointers...>) {
+    return {{{&parse_member<T, visit_struct::member_type_t<decltype(Pointers)>>,
+              &parse_setting_member<T, visit_struct::member_type_t<decltype(Pointers)>>,
+              reinterpret_cast<char T::*>(
+                  static_cast<visit_struct::member_type_t<decltype(Pointers)> T::*>(
+                      Pointers))}...}};
+  }
 
-          std::vector<std::string> potential_combined_argument;
+  template <typename T>
+  static const field_accessor<T> &field_accessor_at(std::size_t index) {
+    static const auto accessors = make_field_accessors<T>(visit_struct::members<T>{});
+    return accessors[index];
+  }
 
-          if (is_optional_field(next) == false && next[0] == '-' &&
-              (next.size() > 1 && next[1] != '-')) {
-            for (std::size_t i = 1; i < next.size(); i++) {
-              potential_combined_argument.push_back("-" + std::string(1, next[i]));
-            }
-          }
+  // Parse the field at (runtime) index `index` of `T`
+  // This is a constant-time table lookup - no iteration over the struct fields
+  template <typename T> bool parse_field_at(T &argument_struct, std::size_t index) {
+    const auto &field = field_accessor_at<T>(index);
+    const auto name = field_table_of<T>::value.names[index];
+    // only set in the parser of the top-level struct; sub-commands have their own
+    if (given_options != nullptr) {
+      given_options->set(index);
+    }
+#if STRUCTOPT_OBSERVERS
+    if (events != nullptr) {
+      notify(parse_event_kind::field_matched, name);
+      const auto tokens_left = arguments.size();
+      const bool result = field.parse(*this, argument_struct, field.pointer, name);
+      const auto tokens = (std::max)(tokens_left, arguments.size()) - arguments.size();
+      notify(parse_event_kind::value_converted, name, tokens);
+      return result;
+    }
+#endif
+    return field.parse(*this, argument_struct, field.pointer, name);
+  }
 
-          if (!potential_combined_argument.empty()) {
-            bool is_combined_argument = true;
-            for (auto &arg : potential_combined_argument) {
-              if (!is_optional_field(arg)) {
-                is_combined_argument = false;
-                // TODO: report error unrecognized option in combined argument
-              }
-            }
+  // Nested struct
+  template <typename T>
+  inline typename std::enable_if<visit_struct::traits::is_visitable<T>::value, bool>::type
+  parse_field(std::string_view name, T &value) {
+    if (sub_command_invoked) {
+      // a sub-command has already been invoked
+      // the offending token is the name of this one
+      fail_sub_command_conflict<T>(name);
+      return true;
+    }
+    arguments.advance();
+    parse_nested_struct(name, value);
+    return true;
+  }
 
-            if (is_combined_argument) {
-
-              // check and make sure the current field_name is
-              // in `potential_combined_argument`
-              //
-              // Let's say the argument `next` is `-abc`
-              // the current field name is `b`
-              // 1. Split `-abc` into `-a`, `-b`, and `-c`
-              // 2. Check if `-b` is in the above list
-              //    1. If yes, consider this as a combined argument
-              //       push the list of arguments (split up) into `arguments`
-              //    2. If no, nothing to do here
-              bool field_name_matched = false;
-              for (auto &arg : potential_combined_argument) {
-                if (arg == "-" + std::string(1, field_name[0])) {
-                  field_name_matched = true;
-                }
-              }
-
-              if (field_name_matched) {
-                // confirmed: this is a combined argument
-
-                // insert the individual options that make up the combined argument
-                // right after the combined argument
-                // e.g., ""./main -abc" becomes "./main -abc -a -b -c"
-                // Once this is done, increment `next_index` so that the parser loop will
-                // service
-                // `-a`, `-b` and `-c` like any other optional arguments (flags and
-                // otherwise)
-                for (std::vector<std::string>::reverse_iterator it =
-                         potential_combined_argument.rbegin();
-                     it != potential_combined_argument.rend(); ++it) {
-                  auto &arg = *it;
-                  if (next_index < arguments.size()) {
-                    auto begin = arguments.begin();
-                    arguments.insert(begin + next_index + 1, arg);
-                  } else {
-                    arguments.push_back(arg);
-                  }
-                }
-
-                // get past the current combined argument
-                next_index += 1;
-              }
-            }
-          }
-        }
+  // Any positional field (not std::optional)
+  template <typename T>
+  inline typename std::enable_if<!structopt::is_specialization<T, std::optional>::value &&
+                                     !visit_struct::traits::is_visitable<T>::value,
+                                 bool>::type
+  parse_field(std::string_view name, T &result) {
+    return parse_argument(name, result);
+  }
+
+  // std::optional field
+  template <typename T>
+  inline typename std::enable_if<structopt::is_specialization<T, std::optional>::value,
+                                 bool>::type
+  parse_field(std::string_view name, T &value) {
+    // this is an optional argument matching the current struct field
+    if constexpr (std::is_same<typename T::value_type, bool>::value) {
+      // It is a boolean optional argument
+      // Does it have a default value?
+      // If yes, this is a FLAG argument, e.g,, "--verbose" will set it to true if the
+      // default value is false No need to write "--verbose true"
+      if (value.has_value()) {
+        // The field already has a default value!
+        value = !value.value(); // simply toggle it
+        arguments.advance();
+      } else {
+        // boolean optional argument doesn't have a default value
+        // expect one
+        parse_optional_argument(name, value);
       }
+    } else {
+      // Not std::optional<bool>
+      // Parse the argument type <T>
+      parse_optional_argument(name, value);
     }
+    return true;
   }
 };
 
 // Specialization for std::string
-template <> inline std::string parser::parse_single_argument<std::string>(std::string_view) {
-  return arguments[next_index];
+template <>
+inline void parser::parse_single_argument<std::string>(std::string_view,
+                                                       std::string &result) {
+  result.assign(arguments.peek());
 }
 
 // Specialization for bool
 // yes, YES, on, 1, true, TRUE, etc. = true
 // no, NO, off, 0, false, FALSE, etc. = false
 // Converts argument to lower case before check
-template <> inline bool parser::parse_single_argument<bool>(std::string_view name) {
-  if (next_index > current_index) {
-    current_index = next_index;
-  }
-
-  if (current_index < arguments.size()) {
-    const std::vector<std::string> true_strings{"on", "yes", "1", "true"};
-    const std::vector<std::string> false_strings{"off", "no", "0", "false"};
-    std::string current_argument = arguments[current_index];
-
-    // Convert argument to lower case
-    std::transform(current_argument.begin(), current_argument.end(),
-                   current_argument.begin(),
-                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+template <>
+inline void parser::parse_single_argument<bool>(std::string_view name, bool &result) {
+  if (!arguments.empty()) {
+    static constexpr std::string_view true_strings[]{"on", "yes", "1", "true"};
+    static constexpr std::string_view false_strings[]{"off", "no", "0", "false"};
+    const std::string_view current_argument = arguments.peek();
+
+    // Compare ignoring case
+    const auto matches = [&current_argument](std::string_view s) {
+      return std::equal(current_argument.begin(), current_argument.end(), s.begin(),
+                        s.end(), [](unsigned char c1, unsigned char c2) {
+                          return std::tolower(c1) == c2;
+                        });
+    };
 
     // Detect if argument is true or false
-    if (std::find(true_strings.begin(), true_strings.end(), current_argument) !=
-        true_strings.end()) {
-      return true;
-    } else if (std::find(false_strings.begin(), false_strings.end(), current_argument) !=
-               false_strings.end()) {
-      return false;
+    if (std::any_of(std::begin(true_strings), std::end(true_strings), matches)) {
+      result = true;
+    } else if (std::any_of(std::begin(false_strings), std::end(false_strings), matches)) {
+      result = false;
     } else {
-      throw structopt::exception("Error: failed to parse boolean argument `" +
-                                     std::string{name} + "`." + " `" + current_argument +
-                                     "`" + " is invalid.",
-                                 visitor);
-      return false;
+      fail(error_detail::boolean_argument_invalid, name);
+      result = false;
     }
   } else {
-    return false;
+    result = false;
   }
 }
 
@@ -3388,97 +7863,371 @@ template <> inline bool parser::parse_single_argument<bool>(std::string_view nam
 } // namespace structopt
 
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
+// #include <structopt/environment.hpp>
+// #include <structopt/exception.hpp>
 // #include <structopt/is_stl_container.hpp>
+// #include <structopt/observer.hpp>
+// #include <structopt/parallel_for.hpp>
+// #include <structopt/parse_result.hpp>
 // #include <structopt/parser.hpp>
+// #include <structopt/record_reader.hpp>
+// #include <structopt/response_file.hpp>
+// #include <structopt/settings.hpp>
+// #include <structopt/source.hpp>
 // #include <structopt/third_party/visit_struct/visit_struct.hpp>
 #include <type_traits>
 #include <vector>
 
 #define STRUCTOPT VISITABLE_STRUCT
 
+// The values of enum `E` are in [MIN, MAX]: magic_enum reflects the names of every
+// value in [-128, 127] otherwise, which dominates the compile time of small enums
+// Use at global scope, e.g., STRUCTOPT_ENUM_RANGE(Options::Color, 0, 2)
+#define STRUCTOPT_ENUM_RANGE(E, MIN, MAX)                                               \
+  template <> struct magic_enum::customize::enum_range<E> {                             \
+    static constexpr int min = MIN;                                                     \
+    static constexpr int max = MAX;                                                     \
+  }
+
 namespace structopt {
 
+// Parsing does not modify the app: one app can parse on several threads at once
 class app {
-  details::visitor visitor;
+  std::shared_ptr<const details::program_info> program_; // name, version and help
+  bool expand_response_files_{false};
+  std::size_t num_threads_{1};
+  int record_fd_{-1}; // read container values from this file descriptor, if not -1
+  char record_delimiter_{'\n'};
+  details::environment_options environment_; // fallbacks of optional fields
+  // values under the arguments, in increasing precedence
+  std::vector<std::shared_ptr<const source>> sources_;
+  std::shared_ptr<observer> observer_; // told about every step of a parse, if set
+  // schema of the last parsed struct, only used by help(); published with release and
+  // read with acquire, since help() may run on a thread that never built the schema
+  mutable std::atomic<const details::visitor *> schema_{nullptr};
 
 public:
   explicit app(std::string name, std::string version = "", std::string help = "")
-      : visitor(std::move(name), std::move(version), std::move(help)) {}
+      : program_(std::make_shared<const details::program_info>(details::program_info{
+            std::move(name), std::move(version), std::move(help)})) {}
+
+  app(const app &other)
+      : program_(other.program_), expand_response_files_(other.expand_response_files_),
+        num_threads_(other.num_threads_), record_fd_(other.record_fd_),
+        record_delimiter_(other.record_delimiter_), environment_(other.environment_),
+        sources_(other.sources_), observer_(other.observer_),
+        schema_(other.schema_.load(std::memory_order_acquire)) {}
+
+  app &operator=(const app &other) {
+    program_ = other.program_;
+    expand_response_files_ = other.expand_response_files_;
+    num_threads_ = other.num_threads_;
+    record_fd_ = other.record_fd_;
+    record_delimiter_ = other.record_delimiter_;
+    environment_ = other.environment_;
+    sources_ = other.sources_;
+    observer_ = other.observer_;
+    schema_.store(other.schema_.load(std::memory_order_acquire),
+                  std::memory_order_release);
+    return *this;
+  }
 
-  template <typename T> T parse(const std::vector<std::string> &arguments) {
-    T argument_struct = T();
+  // Replace `@path` arguments with the arguments in the file `path`, e.g., when the
+  // argument list is too long for the OS
+  //
+  // Response files follow GCC's rules: arguments are separated by whitespace, quotes
+  // group and a backslash escapes. Response files are mapped into memory, not read,
+  // and unmapped when the parse finishes. `@path` stays as is if `path` cannot be read
+  app &expand_response_files(bool enable = true) {
+    expand_response_files_ = enable;
+    return *this;
+  }
+
+  // Threads for very large argument lists, 1 by default and 0 for one per core
+  //
+  // Response files of several MB are split, and std::vector<std::string> fields of
+  // many thousands of values are filled, on that many threads
+  app &threads(std::size_t num_threads) {
+    num_threads_ = num_threads;
+    return *this;
+  }
 
-    // Visit the struct and save flag, optional and positional field names
-    visit_struct::for_each(argument_struct, visitor);
+  // Read the values of a container field from the file descriptor `fd` where its
+  // values include `-`, like xargs, e.g., `find . -print0 | indexer -`
+  //
+  // Every record, up to `delimiter` ('\n' or '\0'), is one value, converted like an
+  // argument. The input is read in large blocks as the values are parsed; with a
+  // structopt::stream field, memory use does not grow with the size of the input.
+  // Only containers of single-token values read records, and only the first `-`
+  // reads any: it reads the input to the end. `fd = -1` disables reading
+  app &read_values_from(int fd = 0, char delimiter = '\n') {
+    record_fd_ = fd;
+    record_delimiter_ = delimiter;
+    return *this;
+  }
 
-    // add `help` and `version` optional arguments
-    visitor.optional_field_names.push_back("help");
-    visitor.optional_field_names.push_back("version");
+  // Optional fields that are not given in the arguments take their value from the
+  // environment variable `prefix` + the upper-case field name, if it is set, e.g.,
+  // `--log-level` from `INDEXER_LOG_LEVEL` with the prefix `INDEXER_`
+  //
+  // Values are parsed like the value of the option. The environment is scanned once
+  // per parse, after the arguments, and only for the fields that were not given
+  app &env_prefix(std::string prefix) {
+    environment_.prefix = std::move(prefix);
+    return *this;
+  }
 
-    // Construct the argument parser
-    structopt::details::parser parser;
-    parser.visitor = visitor;
-    parser.arguments = arguments;
+  // The optional field `field` falls back to the environment variable `variable`,
+  // instead of the one named after the prefix, if any
+  app &env(std::string field, std::string variable) {
+    environment_.variables.emplace_back(std::move(field), std::move(variable));
+    return *this;
+  }
 
-    for (std::size_t i = 1; i < parser.arguments.size(); i++) {
-      parser.current_index = i;
-      visit_struct::for_each(argument_struct, parser);
-    }
+  // Fill the struct from the config file `path` before parsing the arguments, which
+  // override it. The environment, see env_prefix, overrides it too
+  //
+  // The file is INI, a TOML subset (`[table]` headers, `key = value` lines, quoted
+  // strings, `[a, b]` arrays) or JSON. Keys name optional fields, with the same
+  // kebab-case rules as options, and tables name nested structs. The file is mapped
+  // into memory; values are parsed straight from the mapping into their fields
+  app &config_file(std::string path) {
+    return add_source(std::make_shared<file_source>(std::move(path)));
+  }
+
+  // Fill the struct from `settings`, e.g., a structopt::map_source of query
+  // parameters or a structopt::env_source, before parsing the arguments
+  //
+  // Sources are applied in the order they are added, each over the previous ones, and
+  // the arguments over all of them. Every source is read once per parse, and its
+  // values are parsed straight into their fields
+  app &add_source(std::shared_ptr<const source> settings) {
+    sources_.push_back(std::move(settings));
+    return *this;
+  }
+
+  // Tell `events` about every step of every parse: tokens classified, fields matched,
+  // values converted, sub-commands entered and errors, with the time of each, e.g.,
+  // a structopt::trace_observer from <structopt/trace_observer.hpp>. `nullptr` removes
+  // the observer
+  //
+  // Parses without an observer do not read the clock. With parse_batch, the observer
+  // is called from several threads at once
+  app &observe(std::shared_ptr<observer> events) {
+    observer_ = std::move(events);
+    return *this;
+  }
+
+  template <typename T> T parse(const std::vector<std::string> &arguments) const {
+    return parse_tokens<T>(details::tokens(arguments.begin(), arguments.end()));
+  }
+
+  // Parse `settings` over the sources of the app, without arguments, e.g., the
+  // query parameters of a request
+  template <typename T> T parse(const source &settings) const {
+    return parse_tokens<T>(details::tokens{program_->name}, &settings);
+  }
+
+  // Parse `argv` in place - the arguments are viewed, not copied
+  template <typename T> T parse(int argc, char *argv[]) const {
+    return parse_tokens<T>(details::tokens(argv, argv + argc));
+  }
+
+  // Like parse, but errors are returned instead of thrown, and `--help` and
+  // `--version` are returned as errors instead of printing and exiting
+  template <typename T>
+  parse_result<T> try_parse(const std::vector<std::string> &arguments) const {
+    return try_parse_tokens<T>(details::tokens(arguments.begin(), arguments.end()));
+  }
+
+  template <typename T> parse_result<T> try_parse(int argc, char *argv[]) const {
+    return try_parse_tokens<T>(details::tokens(argv, argv + argc));
+  }
+
+  template <typename T> parse_result<T> try_parse(const source &settings) const {
+    return try_parse_tokens<T>(details::tokens{program_->name}, &settings);
+  }
+
+  // try_parse every argument list, spread over `num_threads` threads
+  //
+  // The results are in the order of `argument_lists`; an error in one entry does
+  // not affect the others. `num_threads = 0` uses one thread per core
+  template <typename T>
+  std::vector<parse_result<T>>
+  parse_batch(const std::vector<std::vector<std::string>> &argument_lists,
+              std::size_t num_threads = 0) const {
+    // Entries are handed out in blocks to keep the shared counter cold
+    constexpr std::size_t block_size = 64;
+    const std::size_t num_blocks = (argument_lists.size() + block_size - 1) / block_size;
+
+    std::vector<std::vector<parse_result<T>>> blocks(num_blocks);
+    details::parallel_for(num_blocks, num_threads, [&](std::size_t block) {
+      const auto first = block * block_size;
+      const auto last = std::min(first + block_size, argument_lists.size());
+      blocks[block].reserve(last - first);
+      for (auto i = first; i < last; i++) {
+        blocks[block].push_back(try_parse<T>(argument_lists[i]));
+      }
+    });
 
-    // directly call the parser to check for `help` and `version` flags
-    std::optional<bool> help = false, version = false;
-    for (std::size_t i = 1; i < parser.arguments.size(); i++) {
-      parser.operator()("help", help);
-      parser.operator()("version", version);
+    std::vector<parse_result<T>> result;
+    result.reserve(argument_lists.size());
+    for (auto &block : blocks) {
+      std::move(block.begin(), block.end(), std::back_inserter(result));
+    }
+    return result;
+  }
 
-      if (help == true) {
+private:
+  template <typename T>
+  T parse_tokens(details::tokens arguments, const source *last = nullptr) const {
+    T argument_struct = T();
+    auto failure = parse_into(argument_struct, std::move(arguments), last);
+    if (failure.has_value()) {
+      switch (failure->kind()) {
+      case error_kind::help_requested:
         // if help is requested, print help and exit
-        visitor.print_help(std::cout);
+        std::cout << failure->help();
         exit(EXIT_SUCCESS);
-      } else if (version == true) {
+      case error_kind::version_requested:
         // if version is requested, print version and exit
-        std::cout << visitor.version << "\n";
+        std::cout << failure->version_ << "\n";
         exit(EXIT_SUCCESS);
+      default:
+        throw structopt::exception(failure->message(), *failure->schema_, failure->name_,
+                                   failure->help_, failure->program_);
       }
     }
+    return argument_struct;
+  }
 
-    // if all positional arguments were provided
-    // this list would be empty
-    if (!parser.visitor.positional_field_names.empty()) {
-      for (auto &field_name : parser.visitor.positional_field_names) {
-        if (std::find(parser.visitor.vector_like_positional_field_names.begin(),
-                      parser.visitor.vector_like_positional_field_names.end(),
-                      field_name) ==
-            parser.visitor.vector_like_positional_field_names.end()) {
-          // this positional argument is not a vector-like argument
-          // it expects value(s)
-          throw structopt::exception("Error: expected value for positional argument `" +
-                                         std::string(field_name) + "`.",
-                                     parser.visitor);
-        }
+  template <typename T>
+  parse_result<T> try_parse_tokens(details::tokens arguments,
+                                   const source *last = nullptr) const {
+    T argument_struct = T();
+    auto failure = parse_into(argument_struct, std::move(arguments), last);
+    if (failure.has_value()) {
+      return std::move(failure.value());
+    }
+    return argument_struct;
+  }
+
+  // Returns the first error, if any
+  template <typename T>
+  std::optional<parse_error> parse_into(T &argument_struct, details::tokens arguments,
+                                        const source *last) const {
+    // Flag, optional and positional field names are collected once per type
+    schema_.store(&details::schema<T>(), std::memory_order_release);
+
+    // Construct the argument parser
+    structopt::details::parser parser;
+    parser.name = program_->name;
+    parser.version = program_->version;
+    parser.help = program_->help;
+    parser.visitor = &details::schema<T>();
+    parser.num_threads = num_threads_;
+    parser.events = observer_.get();
+
+    // Arguments from response files view the mappings, which live until we return
+    details::response_files response_files(num_threads_);
+
+    parser.notify(parse_event_kind::parse_started);
+    parse_into(parser, argument_struct, arguments, response_files, last);
+    parser.notify(parse_event_kind::parse_finished);
+    if (parser.failed()) {
+      parser.failure->program_ = program_; // keeps the views of the error valid
+    }
+    return std::move(parser.failure);
+  }
+
+  // Stops at the first error, in `parser.failure`
+  template <typename T>
+  void parse_into(details::parser &parser, T &argument_struct, details::tokens &arguments,
+                  details::response_files &response_files, const source *last) const {
+    if (expand_response_files_) {
+      if (const auto cycle = response_files.expand(arguments)) {
+        auto &error = parser.fail(details::error_detail::response_file_cycle);
+        error.token_index_ = cycle->token_index;
+        error.token_ = cycle->token;
+        return;
+      }
+    }
+
+    // Values of a source are parsed into their fields before the next source is read
+    const auto apply = [&](const source &settings) {
+      details::settings values;
+      if (!settings.read(values)) {
+        auto &error = parser.fail(details::error_detail::config_syntax_error);
+        error.reason_ = values.error;
+        parser.locate_config_failure(values, values.line);
+        return false;
+      }
+      values.group_by_table();
+      parser.parse_config_table(argument_struct, values, 0);
+      // e.g., `--` among the values of an array
+      parser.double_dash_encountered = false;
+      return !parser.failed();
+    };
+    for (const auto &settings : sources_) {
+      if (!apply(*settings)) {
+        return;
       }
     }
+    if (last != nullptr && !apply(*last)) {
+      return;
+    }
 
-    if (parser.current_index < parser.arguments.size()) {
-      throw structopt::exception("Error: unrecognized argument '" + parser.arguments[parser.current_index] + "'", parser.visitor);
+    // Records of the input are views into the reader's buffer
+    std::optional<details::record_reader> records;
+    if (record_fd_ != -1) {
+      parser.records = &records.emplace(record_fd_, record_delimiter_);
     }
 
-    return argument_struct;
-  }
+    // Optional fields given in the arguments do not read the environment
+    details::field_set given_options;
+    if (environment_.enabled()) {
+      parser.given_options = &given_options;
+    }
+
+    // skip the program name
+    parser.arguments = details::token_cursor(arguments, 1);
+
+    // Route every argument to its field in a single pass
+    parser.parse_struct(argument_struct);
 
-  template <typename T> T parse(int argc, char *argv[]) {
-    std::vector<std::string> arguments;
-    std::copy(argv, argv + argc, std::back_inserter(arguments));
-    return parse<T>(arguments);
+    if (!parser.failed() && !parser.arguments.empty()) {
+      if (parser.is_optional(parser.arguments.peek())) {
+        parser.fail(details::error_detail::unrecognized_argument);
+      } else {
+        parser.fail(details::error_detail::unexpected_argument);
+      }
+    }
+
+    if (!parser.failed() && environment_.enabled()) {
+      parser.parse_environment(argument_struct, environment_,
+                               details::process_environment());
+    }
+
+    if (!parser.failed()) {
+      parser.check_positional_fields();
+    }
   }
 
+public:
   std::string help() const {
+    static const details::visitor empty;
     std::stringstream os;
-    visitor.print_help(os);
+    const auto schema = schema_.load(std::memory_order_acquire);
+    (schema ? *schema : empty).print_help(os, program_->name, program_->help);
     return os.str();
   }
 };
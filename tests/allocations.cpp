@@ -0,0 +1,23 @@
+#include <allocations.hpp>
+#include <cstdlib>
+#include <new>
+
+namespace structopt_test {
+std::atomic<std::size_t> allocations{0};
+} // namespace structopt_test
+
+// Counts allocations, e.g., to check that a parse does not copy the tokens
+//
+// Kept apart from doctest's main, where GCC would inline the replacements and report
+// -Wmismatched-new-delete
+void *operator new(std::size_t size) {
+  structopt_test::allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *pointer = std::malloc(size != 0 ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
@@ -0,0 +1,17 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+namespace structopt_test {
+
+// Calls to operator new since the tests started, counted by allocations.cpp
+extern std::atomic<std::size_t> allocations;
+
+// Calls to operator new while `f` runs
+template <typename F> std::size_t allocations_in(F &&f) {
+  const auto before = allocations.load(std::memory_order_relaxed);
+  f();
+  return allocations.load(std::memory_order_relaxed) - before;
+}
+
+} // namespace structopt_test
@@ -0,0 +1,175 @@
+#include <cstdlib>
+#include <doctest.hpp>
+#include <map>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct SourceLimits : structopt::sub_command {
+  std::optional<int> connections = 10;
+  std::optional<double> timeout;
+};
+STRUCTOPT(SourceLimits, connections, timeout);
+
+struct SourceOptions {
+  std::optional<std::string> user;
+  std::optional<int> page = 1;
+  std::optional<bool> verbose = false;
+  std::optional<std::vector<std::string>> tags;
+  SourceLimits limits;
+};
+STRUCTOPT(SourceOptions, user, page, verbose, tags, limits);
+
+TEST_CASE("structopt parses key/value maps" * test_suite("source")) {
+  const std::map<std::string, std::string> defaults = {{"page", "2"}, {"user", "bob"}};
+  const auto app = structopt::app("test");
+  {
+    auto options = app.parse<SourceOptions>(structopt::map_source(defaults));
+    REQUIRE(options.user == "bob");
+    REQUIRE(options.page == 2);
+    REQUIRE(!options.tags.has_value());
+  }
+  {
+    const std::vector<std::pair<std::string_view, std::string_view>> pairs = {
+        {"user", "alice"},         {"tags", "a"}, {"page", "3"},
+        {"limits.timeout", "2.5"}, {"tags", "b"}, {"verbose", "true"},
+        {"tags", "c"},             {"limits.connections", "4"}};
+    auto options = app.parse<SourceOptions>(structopt::map_source(pairs));
+    REQUIRE(options.user == "alice");
+    REQUIRE(options.page == 3);
+    REQUIRE(options.verbose == true);
+    REQUIRE(options.tags == std::vector<std::string>{"a", "b", "c"});
+    REQUIRE(options.limits.connections == 4);
+    REQUIRE(options.limits.timeout == 2.5);
+  }
+}
+
+TEST_CASE("structopt applies sources in order, then the arguments" *
+          test_suite("source")) {
+  const std::map<std::string, std::string> site = {{"user", "site"}, {"page", "2"}};
+  const std::map<std::string, std::string> local = {{"user", "local"},
+                                                    {"limits.connections", "20"}};
+  const auto app = structopt::app("test")
+                       .add_source(std::make_shared<structopt::map_source>(site))
+                       .add_source(std::make_shared<structopt::map_source>(local));
+  {
+    auto options = app.parse<SourceOptions>(std::vector<std::string>{"./main"});
+    REQUIRE(options.user == "local");
+    REQUIRE(options.page == 2);
+    REQUIRE(options.limits.connections == 20);
+  }
+  {
+    auto options = app.parse<SourceOptions>(
+        std::vector<std::string>{"./main", "--user", "argument", "limits"});
+    REQUIRE(options.user == "argument");
+    REQUIRE(options.page == 2);
+    REQUIRE(options.limits.has_value());
+    REQUIRE(options.limits.connections == 20);
+  }
+  {
+    // The source given to parse comes last
+    const std::map<std::string, std::string> request = {{"page", "7"}};
+    auto options = app.parse<SourceOptions>(structopt::map_source(request));
+    REQUIRE(options.user == "local");
+    REQUIRE(options.page == 7);
+  }
+}
+
+TEST_CASE("structopt reads prefixed environment variables as a source" *
+          test_suite("source")) {
+#ifdef _WIN32
+  ::_putenv_s("STRUCTOPT_SOURCE_PAGE", "5");
+  ::_putenv_s("STRUCTOPT_SOURCE_LIMITS__TIMEOUT", "0.5");
+  ::_putenv_s("STRUCTOPT_SOURCE_UNRELATED", "x");
+#else
+  ::setenv("STRUCTOPT_SOURCE_PAGE", "5", 1);
+  ::setenv("STRUCTOPT_SOURCE_LIMITS__TIMEOUT", "0.5", 1);
+  ::setenv("STRUCTOPT_SOURCE_UNRELATED", "x", 1);
+#endif
+
+  const std::map<std::string, std::string> defaults = {{"page", "2"}, {"user", "bob"}};
+  const auto app =
+      structopt::app("test")
+          .add_source(std::make_shared<structopt::map_source>(defaults))
+          .add_source(std::make_shared<structopt::env_source>("STRUCTOPT_SOURCE_"));
+  auto options =
+      app.parse<SourceOptions>(std::vector<std::string>{"./main", "--verbose"});
+  REQUIRE(options.user == "bob");
+  REQUIRE(options.page == 5);
+  REQUIRE(options.limits.timeout == 0.5);
+  REQUIRE(options.verbose == true);
+
+#ifdef _WIN32
+  ::_putenv_s("STRUCTOPT_SOURCE_PAGE", "");
+  ::_putenv_s("STRUCTOPT_SOURCE_LIMITS__TIMEOUT", "");
+  ::_putenv_s("STRUCTOPT_SOURCE_UNRELATED", "");
+#else
+  ::unsetenv("STRUCTOPT_SOURCE_PAGE");
+  ::unsetenv("STRUCTOPT_SOURCE_LIMITS__TIMEOUT");
+  ::unsetenv("STRUCTOPT_SOURCE_UNRELATED");
+#endif
+}
+
+struct SourceNaming {
+  std::optional<std::string> logLevel;
+  std::optional<int> retries2;
+  std::optional<bool> ipv6_only = false;
+};
+STRUCTOPT(SourceNaming, logLevel, retries2, ipv6_only);
+
+TEST_CASE("structopt maps variables to fields alike in env_source and env_prefix" *
+          test_suite("source")) {
+#ifdef _WIN32
+  ::_putenv_s("STRUCTOPT_NAMING_LOGLEVEL", "debug");
+  ::_putenv_s("STRUCTOPT_NAMING_RETRIES2", "3");
+  ::_putenv_s("STRUCTOPT_NAMING_IPV6_ONLY", "on");
+#else
+  ::setenv("STRUCTOPT_NAMING_LOGLEVEL", "debug", 1);
+  ::setenv("STRUCTOPT_NAMING_RETRIES2", "3", 1);
+  ::setenv("STRUCTOPT_NAMING_IPV6_ONLY", "on", 1);
+#endif
+
+  const std::vector<std::string> arguments{"./main"};
+  const auto fallback = structopt::app("test")
+                            .env_prefix("STRUCTOPT_NAMING_")
+                            .parse<SourceNaming>(arguments);
+  const auto source =
+      structopt::app("test")
+          .add_source(std::make_shared<structopt::env_source>("STRUCTOPT_NAMING_"))
+          .parse<SourceNaming>(arguments);
+  REQUIRE(fallback.logLevel == "debug");
+  REQUIRE(fallback.retries2 == 3);
+  REQUIRE(fallback.ipv6_only == true);
+  REQUIRE(source.logLevel == fallback.logLevel);
+  REQUIRE(source.retries2 == fallback.retries2);
+  REQUIRE(source.ipv6_only == fallback.ipv6_only);
+
+#ifdef _WIN32
+  ::_putenv_s("STRUCTOPT_NAMING_LOGLEVEL", "");
+  ::_putenv_s("STRUCTOPT_NAMING_RETRIES2", "");
+  ::_putenv_s("STRUCTOPT_NAMING_IPV6_ONLY", "");
+#else
+  ::unsetenv("STRUCTOPT_NAMING_LOGLEVEL");
+  ::unsetenv("STRUCTOPT_NAMING_RETRIES2");
+  ::unsetenv("STRUCTOPT_NAMING_IPV6_ONLY");
+#endif
+}
+
+TEST_CASE("structopt reports errors in sources" * test_suite("source")) {
+  const auto app = structopt::app("test");
+  {
+    const std::map<std::string, std::string> query = {{"page", "last"}};
+    auto result = app.try_parse<SourceOptions>(structopt::map_source(query, "query"));
+    REQUIRE(!result.has_value());
+    REQUIRE(result.error().kind() == structopt::error_kind::invalid_value);
+    REQUIRE(result.error().message() ==
+            "Error: query: failed to parse numeric argument `page`. `last` is invalid.");
+  }
+  {
+    const std::map<std::string, std::string> query = {{"pages", "1"}};
+    auto result = app.try_parse<SourceOptions>(structopt::map_source(query, "query"));
+    REQUIRE(!result.has_value());
+    REQUIRE(result.error().kind() == structopt::error_kind::invalid_config);
+    REQUIRE(result.error().message() == "Error: query: unrecognized key `pages`.");
+  }
+}
@@ -0,0 +1,76 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct ArgvOptions {
+  // Positional arguments
+  std::string input_file;
+  std::vector<int> values;
+
+  // Optional arguments
+  std::optional<std::string> output;
+  std::optional<bool> verbose = false;
+  std::optional<bool> all = false;
+  std::optional<bool> color;
+};
+STRUCTOPT(ArgvOptions, input_file, values, output, verbose, all, color);
+
+// argv as seen by main()
+struct argv_builder {
+  std::vector<std::string> storage;
+  std::vector<char *> argv;
+
+  explicit argv_builder(std::vector<std::string> arguments) : storage(std::move(arguments)) {
+    for (auto &argument : storage) {
+      argv.push_back(argument.data());
+    }
+    argv.push_back(nullptr);
+  }
+
+  int argc() const { return static_cast<int>(storage.size()); }
+};
+
+TEST_CASE("structopt can parse argv in place" * test_suite("argv")) {
+  // positional and optional arguments
+  {
+    argv_builder args({"./main", "foo.txt", "1", "2", "3", "--output", "bar.txt"});
+    auto arguments = structopt::app("test").parse<ArgvOptions>(args.argc(), args.argv.data());
+    REQUIRE(arguments.input_file == "foo.txt");
+    REQUIRE(arguments.values == std::vector<int>{1, 2, 3});
+    REQUIRE(arguments.output == "bar.txt");
+    REQUIRE(arguments.verbose == false);
+  }
+  // delimited and combined arguments
+  {
+    argv_builder args({"./main", "--output=bar.txt", "-va", "--color", "ON", "foo.txt"});
+    auto arguments = structopt::app("test").parse<ArgvOptions>(args.argc(), args.argv.data());
+    REQUIRE(arguments.input_file == "foo.txt");
+    REQUIRE(arguments.values.empty());
+    REQUIRE(arguments.output == "bar.txt");
+    REQUIRE(arguments.verbose == true);
+    REQUIRE(arguments.all == true);
+    REQUIRE(arguments.color == true);
+  }
+  // argv is left untouched
+  {
+    argv_builder args({"./main", "-av", "--output:bar.txt", "foo.txt"});
+    auto arguments = structopt::app("test").parse<ArgvOptions>(args.argc(), args.argv.data());
+    REQUIRE(arguments.input_file == "foo.txt");
+    REQUIRE(std::string{args.argv[1]} == "-av");
+    REQUIRE(std::string{args.argv[2]} == "--output:bar.txt");
+  }
+  // errors
+  {
+    bool exception_thrown{false};
+    argv_builder args({"./main", "foo.txt", "--color", "maybe"});
+    try {
+      auto arguments = structopt::app("test").parse<ArgvOptions>(args.argc(), args.argv.data());
+    } catch (structopt::exception &e) {
+      exception_thrown = true;
+      REQUIRE(std::string{e.what()} ==
+              "Error: failed to parse boolean argument `color`. `maybe` is invalid.");
+    }
+    REQUIRE(exception_thrown == true);
+  }
+}
@@ -0,0 +1,197 @@
+#include <doctest.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+// A file in the temporary directory, removed at the end of the test
+class config_path {
+  std::filesystem::path path_;
+
+public:
+  config_path(const std::string &name, const std::string &contents)
+      : path_(std::filesystem::temp_directory_path() / ("structopt_" + name)) {
+    std::ofstream(path_, std::ios::binary) << contents;
+  }
+
+  ~config_path() { std::filesystem::remove(path_); }
+
+  std::string string() const { return path_.string(); }
+
+  std::string contents() const {
+    std::ifstream file(path_, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  }
+};
+
+struct ConfigTls {
+  std::optional<bool> enabled = false;
+  std::optional<std::string> certificate;
+};
+STRUCTOPT(ConfigTls, enabled, certificate);
+
+struct ConfigServer : structopt::sub_command {
+  std::optional<std::string> host;
+  std::optional<int> port;
+  ConfigTls tls;
+};
+STRUCTOPT(ConfigServer, host, port, tls);
+
+struct ConfigOptions {
+  std::optional<int> jobs;
+  std::optional<std::string> log_level = "info";
+  std::optional<bool> verbose = false;
+  std::optional<std::vector<std::string>> tags;
+  ConfigServer server;
+};
+STRUCTOPT(ConfigOptions, jobs, log_level, verbose, tags, server);
+
+TEST_CASE("structopt fills structs from TOML config files" * test_suite("config_file")) {
+  const std::string contents = R"(# settings of the indexer
+jobs = 0x10
+log-level = "debug \"verbose\"\tmode"
+verbose = true
+tags = [
+  'nightly', # a comment
+  "x86_64",
+]
+
+[server]
+host = "example.com"
+port = 8080
+
+[server.tls]
+enabled = on
+certificate = 'C:\certs\server.pem'
+)";
+  const config_path config("config.toml", contents);
+
+  const auto app = structopt::app("test").config_file(config.string());
+  auto options = app.parse<ConfigOptions>(std::vector<std::string>{"./main"});
+  REQUIRE(options.jobs == 16);
+  REQUIRE(options.log_level == "debug \"verbose\"\tmode");
+  REQUIRE(options.verbose == true);
+  REQUIRE(options.tags == std::vector<std::string>{"nightly", "x86_64"});
+  REQUIRE(!options.server.has_value());
+  REQUIRE(options.server.host == "example.com");
+  REQUIRE(options.server.port == 8080);
+  REQUIRE(options.server.tls.enabled == true);
+  REQUIRE(options.server.tls.certificate == "C:\\certs\\server.pem");
+
+  // Quotes and escapes are removed in the mapping, not in the file
+  REQUIRE(config.contents() == contents);
+}
+
+TEST_CASE("structopt applies the arguments over the config file" *
+          test_suite("config_file")) {
+  const config_path config("override.toml", "jobs = 4\nverbose = true\n[server]\n"
+                                            "host = \"example.com\"\nport = 80");
+
+  const auto app = structopt::app("test").config_file(config.string());
+  auto options = app.parse<ConfigOptions>(
+      std::vector<std::string>{"./main", "--jobs", "2", "server", "--port", "9000"});
+  REQUIRE(options.jobs == 2);
+  REQUIRE(options.log_level == "info");
+  REQUIRE(options.server.has_value());
+  REQUIRE(options.server.host == "example.com");
+  REQUIRE(options.server.port == 9000);
+
+  // A flag in the arguments toggles the value of the config file
+  options = app.parse<ConfigOptions>(std::vector<std::string>{"./main", "--verbose"});
+  REQUIRE(options.verbose == false);
+}
+
+TEST_CASE("structopt takes config values literally, even if they look like options" *
+          test_suite("config_file")) {
+  const config_path config("literal.toml", "log-level = \"--verbose\"\n"
+                                           "tags = [\"a\", \"--\", \"b\", \"--verbose\", \"-v\", \"-\"]\n");
+
+  const auto app = structopt::app("test").config_file(config.string());
+  auto options = app.parse<ConfigOptions>(std::vector<std::string>{"./main"});
+  REQUIRE(options.log_level == "--verbose");
+  REQUIRE(options.tags == std::vector<std::string>{"a", "--", "b", "--verbose", "-v", "-"});
+  REQUIRE(options.verbose == false);
+}
+
+TEST_CASE("structopt reads INI and JSON config files" * test_suite("config_file")) {
+  {
+    const config_path config("config.ini", "; INI\r\njobs=3\r\n"
+                                           "log_level = very verbose # comment\r\n\r\n"
+                                           "[server]\r\nhost=localhost\r\n");
+    const auto app = structopt::app("test").config_file(config.string());
+    auto options = app.parse<ConfigOptions>(std::vector<std::string>{"./main"});
+    REQUIRE(options.jobs == 3);
+    REQUIRE(options.log_level == "very verbose");
+    REQUIRE(options.server.host == "localhost");
+  }
+  {
+    const config_path config("config.json", R"({
+  "jobs": 8,
+  "log-level": "caf\u00e9 \ud83d\ude00",
+  "verbose": false,
+  "tags": ["a", "b\/c"],
+  "server": {"port": 443, "host": null, "tls": {"enabled": true}}
+})");
+    const auto app = structopt::app("test").config_file(config.string());
+    auto options = app.parse<ConfigOptions>(std::vector<std::string>{"./main"});
+    REQUIRE(options.jobs == 8);
+    REQUIRE(options.log_level == "caf\xc3\xa9 \xf0\x9f\x98\x80");
+    REQUIRE(options.verbose == false);
+    REQUIRE(options.tags == std::vector<std::string>{"a", "b/c"});
+    REQUIRE(options.server.port == 443);
+    REQUIRE(!options.server.host.has_value());
+    REQUIRE(options.server.tls.enabled == true);
+  }
+}
+
+static std::string config_error(const std::string &name, const std::string &contents) {
+  const config_path config(name, contents);
+  const auto app = structopt::app("test").config_file(config.string());
+  auto result = app.try_parse<ConfigOptions>(std::vector<std::string>{"./main"});
+  REQUIRE(!result.has_value());
+  const auto message = result.error().message();
+  const std::string prefix = "Error: config file `" + config.string() + "`";
+  REQUIRE(message.compare(0, prefix.size(), prefix) == 0);
+  return message.substr(prefix.size());
+}
+
+TEST_CASE("structopt reports errors in config files" * test_suite("config_file")) {
+  REQUIRE(config_error("unknown.toml", "jobs = 1\n\njob = 2\n") ==
+          ", line 3: unrecognized key `job`.");
+  REQUIRE(config_error("table.toml", "[servers]\nport = 1\n") ==
+          ": unrecognized key `servers`.");
+  REQUIRE(config_error("syntax.toml", "jobs = 1\nlog-level = \"debug\n") ==
+          ", line 2: unterminated string.");
+  REQUIRE(config_error("values.toml", "jobs = [1, 2]\n") ==
+          ", line 1: too many values for `jobs`.");
+  REQUIRE(config_error("invalid.json", "{\n  \"jobs\": \"many\"\n}") ==
+          ", line 2: failed to parse numeric argument `jobs`. `many` is invalid.");
+
+  auto result = structopt::app("test").config_file("no_such_file.toml").try_parse<
+      ConfigOptions>(std::vector<std::string>{"./main"});
+  REQUIRE(!result.has_value());
+  REQUIRE(result.error().kind() == structopt::error_kind::invalid_config);
+  REQUIRE(result.error().message() ==
+          "Error: config file `no_such_file.toml`: cannot be read.");
+}
+
+struct FileListConfig {
+  std::optional<std::vector<std::string>> files;
+};
+STRUCTOPT(FileListConfig, files);
+
+TEST_CASE("structopt loads large config files" * test_suite("config_file")) {
+  std::string contents = "files = [\n";
+  for (int i = 0; i < 100000; i++) {
+    contents += "  \"/data/file_" + std::to_string(i) + ".txt\",\n";
+  }
+  contents += "]\n";
+  const config_path config("large.toml", contents);
+
+  const auto app = structopt::app("test").config_file(config.string());
+  auto options = app.parse<FileListConfig>(std::vector<std::string>{"./main"});
+  REQUIRE(options.files->size() == 100000);
+  REQUIRE(options.files->back() == "/data/file_99999.txt");
+}
@@ -44,4 +44,28 @@ TEST_CASE("structopt can parse enum class optional argument" * test_suite("enum_
     REQUIRE(arguments.color == MultipleEnumOptionalArguments::Color::green);
     REQUIRE(arguments.text_align == MultipleEnumOptionalArguments::TextAlign::middle);
   }
-}
\ No newline at end of file
+}
+
+struct RangedEnumOptionalArgument {
+  enum class Level { low = 10, medium, high };
+  std::optional<Level> level;
+};
+STRUCTOPT(RangedEnumOptionalArgument, level);
+STRUCTOPT_ENUM_RANGE(RangedEnumOptionalArgument::Level, 10, 12);
+
+TEST_CASE("structopt can parse enum class optional argument with a narrowed range" * test_suite("enum_optional")) {
+  {
+    auto arguments = structopt::app("test").parse<RangedEnumOptionalArgument>(std::vector<std::string>{"./main", "--level", "high"});
+    REQUIRE(arguments.level == RangedEnumOptionalArgument::Level::high);
+  }
+  {
+    bool exception_thrown = false;
+    try {
+      structopt::app("test").parse<RangedEnumOptionalArgument>(std::vector<std::string>{"./main", "--level", "extreme"});
+    } catch (structopt::exception& e) {
+      exception_thrown = true;
+      REQUIRE(std::string{e.what()} == "Error: unexpected input `extreme` provided for enum argument `level`. Allowed values are {low, medium, high}");
+    }
+    REQUIRE(exception_thrown == true);
+  }
+}
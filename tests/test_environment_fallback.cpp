@@ -0,0 +1,175 @@
+#include <allocations.hpp>
+#include <cstdlib>
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+// Sets an environment variable until the end of the test
+class scoped_variable {
+  std::string name_;
+
+public:
+  scoped_variable(std::string name, const std::string &value) : name_(std::move(name)) {
+#ifdef _WIN32
+    ::_putenv_s(name_.c_str(), value.c_str());
+#else
+    ::setenv(name_.c_str(), value.c_str(), 1);
+#endif
+  }
+
+  ~scoped_variable() {
+#ifdef _WIN32
+    ::_putenv_s(name_.c_str(), "");
+#else
+    ::unsetenv(name_.c_str());
+#endif
+  }
+};
+
+struct EnvironmentOptions {
+  std::string input;
+  std::optional<int> jobs;
+  std::optional<std::string> log_level = "info";
+  std::optional<bool> verbose = false;
+  std::optional<std::vector<std::string>> tags;
+};
+STRUCTOPT(EnvironmentOptions, input, jobs, log_level, verbose, tags);
+
+TEST_CASE("structopt reads absent optional fields from the environment" *
+          test_suite("environment")) {
+  const scoped_variable jobs("STRUCTOPT_TEST_JOBS", "0x10");
+  const scoped_variable log_level("STRUCTOPT_TEST_LOG_LEVEL", "debug");
+  const scoped_variable verbose("STRUCTOPT_TEST_VERBOSE", "on");
+  const scoped_variable input("STRUCTOPT_TEST_INPUT", "ignored.txt");
+  {
+    auto options =
+        structopt::app("test").env_prefix("STRUCTOPT_TEST_").parse<EnvironmentOptions>(
+            std::vector<std::string>{"./main", "a.txt"});
+    REQUIRE(options.input == "a.txt");
+    REQUIRE(options.jobs == 16);
+    REQUIRE(options.log_level == "debug");
+    REQUIRE(options.verbose == true);
+    REQUIRE(!options.tags.has_value());
+  }
+  {
+    // The arguments take precedence; a flag given in the arguments is toggled as usual
+    auto options = structopt::app("test")
+                       .env_prefix("STRUCTOPT_TEST_")
+                       .parse<EnvironmentOptions>(
+                           std::vector<std::string>{"./main", "a.txt", "--jobs", "2",
+                                                    "--verbose", "--log-level=warn"});
+    REQUIRE(options.jobs == 2);
+    REQUIRE(options.log_level == "warn");
+    REQUIRE(options.verbose == true);
+  }
+  {
+    // Not enabled
+    auto options = structopt::app("test").parse<EnvironmentOptions>(
+        std::vector<std::string>{"./main", "a.txt"});
+    REQUIRE(!options.jobs.has_value());
+    REQUIRE(options.log_level == "info");
+    REQUIRE(options.verbose == false);
+  }
+}
+
+TEST_CASE("structopt reads fields from explicitly named environment variables" *
+          test_suite("environment")) {
+  const scoped_variable jobs("STRUCTOPT_TEST_NPROC", "8");
+  const scoped_variable tags("STRUCTOPT_TEST_TAG", "nightly");
+  const scoped_variable log_level("STRUCTOPT_TEST_LOG_LEVEL", "debug");
+
+  auto options = structopt::app("test")
+                     .env("jobs", "STRUCTOPT_TEST_NPROC")
+                     .env("tags", "STRUCTOPT_TEST_TAG")
+                     .parse<EnvironmentOptions>(
+                         std::vector<std::string>{"./main", "a.txt"});
+  REQUIRE(options.jobs == 8);
+  REQUIRE(options.tags == std::vector<std::string>{"nightly"});
+  // no prefix
+  REQUIRE(options.log_level == "info");
+}
+
+TEST_CASE("structopt reports invalid environment values" * test_suite("environment")) {
+  const scoped_variable jobs("STRUCTOPT_TEST_JOBS", "many");
+  auto result =
+      structopt::app("test").env_prefix("STRUCTOPT_TEST_").try_parse<EnvironmentOptions>(
+          std::vector<std::string>{"./main", "a.txt"});
+  REQUIRE(!result.has_value());
+  REQUIRE(result.error().kind() == structopt::error_kind::invalid_value);
+  REQUIRE(result.error().field_name() == "jobs");
+  REQUIRE(result.error().token() == "many");
+}
+
+TEST_CASE("structopt indexes only the wanted environment variables" *
+          test_suite("environment")) {
+  const structopt::details::environment_options options{"APP_", {{"jobs", "NPROC"}}};
+
+  // input, jobs, log_level, verbose, tags; `input` is positional and `verbose` given
+  const auto &table = structopt::details::field_table_of<EnvironmentOptions>::value;
+  const structopt::details::environment_names names(table);
+  structopt::details::field_set wanted;
+  wanted.set(1).set(2).set(4);
+
+  char path[] = "PATH=/usr/bin";
+  char nproc[] = "NPROC=4";
+  char level[] = "APP_LOG_LEVEL=a=b";
+  char jobs[] = "APP_JOBS=9";
+  char input[] = "APP_INPUT=x";
+  char verbose[] = "APP_VERBOSE=on";
+  char tags[] = "APP_TAGS=";
+  char *entries[] = {path, nproc, level, jobs, input, verbose, tags, nullptr};
+  const structopt::details::environment environment(table, names, options, wanted, entries);
+  REQUIRE(!environment.value(0).has_value());
+  REQUIRE(environment.value(1) == "4"); // NPROC, not APP_JOBS
+  REQUIRE(environment.value(2) == "a=b");
+  REQUIRE(!environment.value(3).has_value());
+  REQUIRE(environment.value(4) == "");
+
+  // nothing set, nothing allocated
+  char *no_entries[] = {path, nullptr};
+  std::optional<std::string_view> unset_value;
+  REQUIRE(structopt_test::allocations_in([&]() {
+            const structopt::details::environment unset(table, names, options, wanted,
+                                                        no_entries);
+            unset_value = unset.value(1);
+          }) == 0);
+  REQUIRE(!unset_value.has_value());
+}
+
+struct EnvironmentCommand : structopt::sub_command {
+  std::optional<bool> verbose = false;
+  std::optional<int> jobs;
+};
+STRUCTOPT(EnvironmentCommand, verbose, jobs);
+
+struct EnvironmentCommands {
+  std::optional<bool> verbose = false;
+  std::optional<int> jobs;
+  EnvironmentCommand build;
+};
+STRUCTOPT(EnvironmentCommands, verbose, jobs, build);
+
+TEST_CASE("structopt reads the environment for top-level options a sub-command shares" *
+          test_suite("environment")) {
+  const scoped_variable verbose("STRUCTOPT_TEST_VERBOSE", "on");
+  const scoped_variable jobs("STRUCTOPT_TEST_JOBS", "8");
+
+  // `--verbose` and `--jobs` are options of `build`, not of the top-level struct
+  auto options = structopt::app("test")
+                     .env_prefix("STRUCTOPT_TEST_")
+                     .parse<EnvironmentCommands>(std::vector<std::string>{
+                         "./main", "build", "--verbose", "--jobs", "2"});
+  REQUIRE(options.verbose == true);
+  REQUIRE(options.jobs == 8);
+  REQUIRE(options.build.verbose == true);
+  REQUIRE(options.build.jobs == 2);
+
+  options = structopt::app("test")
+                .env_prefix("STRUCTOPT_TEST_")
+                .parse<EnvironmentCommands>(
+                    std::vector<std::string>{"./main", "--jobs", "3", "build"});
+  REQUIRE(options.jobs == 3);
+  REQUIRE(options.verbose == true);
+  REQUIRE(!options.build.jobs.has_value());
+}
@@ -0,0 +1,65 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct FieldTableOptions {
+  struct SubCommand : structopt::sub_command {
+    std::optional<bool> force = false;
+  };
+  std::optional<std::string> value;
+  std::optional<bool> verbose = false;
+  std::optional<int> log_level;
+  std::string input_file;
+  SubCommand sub;
+};
+STRUCTOPT(FieldTableOptions::SubCommand, force);
+STRUCTOPT(FieldTableOptions, value, verbose, log_level, input_file, sub);
+
+using structopt::details::field_kind;
+using structopt::details::field_table_of;
+using structopt::details::no_field;
+
+// The table is built at compile time
+constexpr auto &field_table = field_table_of<FieldTableOptions>::value;
+static_assert(field_table.size == 5);
+static_assert(field_table.find("log_level") == 2);
+static_assert(field_table.find("log-level") == 2);
+static_assert(field_table.find_long("--log-level") == 2);
+static_assert(field_table.find_long("-log_level") == 2);
+static_assert(field_table.find_long("--unknown") == no_field);
+static_assert(field_table.kinds[4] == field_kind::nested_struct);
+
+TEST_CASE("structopt resolves long, kebab-case and short field names" * test_suite("field_table")) {
+  REQUIRE(field_table.find("value") == 0);
+  REQUIRE(field_table.find("verbose") == 1);
+  REQUIRE(field_table.find("input-file") == 3);
+  REQUIRE(field_table.find("sub") == 4);
+  REQUIRE(field_table.find("inputfile") == no_field);
+  REQUIRE(field_table.find("") == no_field);
+
+  // `-v` resolves to the first flag or option that starts with `v`
+  REQUIRE(field_table.find_short("-v", field_table.short_flag_or_option) == 0);
+  REQUIRE(field_table.find_short("-l", field_table.short_flag_or_option) == 2);
+  REQUIRE(field_table.find_short("-i", field_table.short_flag_or_option) == no_field);
+  REQUIRE(field_table.find_short("-i", field_table.short_names) == 3);
+  REQUIRE(field_table.find_short("-vv", field_table.short_names) == no_field);
+}
+
+TEST_CASE("structopt resolves the first declared field on name conflicts" * test_suite("field_table")) {
+  {
+    auto arguments = structopt::app("test").parse<FieldTableOptions>(
+        std::vector<std::string>{"./main", "-v", "foo", "--verbose", "bar"});
+    REQUIRE(arguments.value == "foo");
+    REQUIRE(arguments.verbose == true);
+    REQUIRE(arguments.input_file == "bar");
+  }
+  {
+    auto arguments = structopt::app("test").parse<FieldTableOptions>(
+        std::vector<std::string>{"./main", "--log-level=3", "bar", "sub", "-f"});
+    REQUIRE(arguments.log_level == 3);
+    REQUIRE(arguments.input_file == "bar");
+    REQUIRE(arguments.sub.has_value());
+    REQUIRE(arguments.sub.force == true);
+  }
+}
@@ -0,0 +1,98 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+// Counts copies; read with operator>> like any user-defined field type
+struct CopyCounted {
+  static inline std::size_t copies = 0;
+  std::string value;
+
+  CopyCounted() = default;
+  CopyCounted(const CopyCounted &other) : value(other.value) { copies += 1; }
+  CopyCounted(CopyCounted &&) = default;
+  CopyCounted &operator=(const CopyCounted &other) {
+    value = other.value;
+    copies += 1;
+    return *this;
+  }
+  CopyCounted &operator=(CopyCounted &&) = default;
+
+  bool operator<(const CopyCounted &other) const { return value < other.value; }
+
+  friend std::istream &operator>>(std::istream &is, CopyCounted &c) {
+    return is >> c.value;
+  }
+};
+
+struct InPlaceOptions {
+  std::vector<CopyCounted> values;
+
+  std::optional<std::pair<CopyCounted, CopyCounted>> pair;
+  std::optional<std::tuple<CopyCounted, int, CopyCounted>> tuple;
+  std::optional<std::array<CopyCounted, 2>> array;
+  std::optional<std::set<CopyCounted>> set;
+  std::optional<std::queue<CopyCounted>> queue;
+};
+STRUCTOPT(InPlaceOptions, values, pair, tuple, array, set, queue);
+
+TEST_CASE("structopt parses field values without copying them" * test_suite("in_place")) {
+  std::vector<std::string> arguments{"./main"};
+  for (int i = 0; i < 100; i++) {
+    arguments.push_back("value" + std::to_string(i));
+  }
+  for (auto &argument : {"--pair", "a", "b", "--tuple", "c", "1", "d", "--array", "e",
+                         "f", "--set", "g", "h", "--queue", "i", "j"}) {
+    arguments.push_back(argument);
+  }
+
+  CopyCounted::copies = 0;
+  auto options = structopt::app("test").parse<InPlaceOptions>(arguments);
+  REQUIRE(CopyCounted::copies == 0);
+
+  REQUIRE(options.values.size() == 100);
+  REQUIRE(options.values.front().value == "value0");
+  REQUIRE(options.values.back().value == "value99");
+  REQUIRE(options.pair.value().first.value == "a");
+  REQUIRE(options.pair.value().second.value == "b");
+  REQUIRE(std::get<0>(options.tuple.value()).value == "c");
+  REQUIRE(std::get<1>(options.tuple.value()) == 1);
+  REQUIRE(std::get<2>(options.tuple.value()).value == "d");
+  REQUIRE(options.array.value()[1].value == "f");
+  REQUIRE(options.set.value().size() == 2);
+  REQUIRE(options.queue.value().front().value == "i");
+}
+
+struct ReservedOptions {
+  std::vector<std::string> files;
+  std::optional<std::vector<int>> values;
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(ReservedOptions, files, values, verbose);
+
+TEST_CASE("structopt reserves vector fields for the values that follow" *
+          test_suite("in_place")) {
+  auto options = structopt::app("test").parse<ReservedOptions>(std::vector<std::string>{
+      "./main", "--values", "1", "2", "3", "--verbose", "--", "a", "b", "c", "d", "e"});
+  REQUIRE(options.values == std::vector<int>{1, 2, 3});
+  REQUIRE(options.values.value().capacity() == 3);
+  REQUIRE(options.verbose == true);
+  REQUIRE(options.files == std::vector<std::string>{"a", "b", "c", "d", "e"});
+  REQUIRE(options.files.capacity() == 5);
+}
+
+struct DefaultedOptions {
+  std::vector<int> values = {7, 8, 9};
+  std::optional<std::vector<bool>> flags = std::vector<bool>{false};
+  std::optional<std::unordered_set<int>> ids = std::unordered_set<int>{42};
+};
+STRUCTOPT(DefaultedOptions, values, flags, ids);
+
+TEST_CASE("structopt replaces default values of container fields" *
+          test_suite("in_place")) {
+  auto options = structopt::app("test").parse<DefaultedOptions>(std::vector<std::string>{
+      "./main", "--flags", "true", "off", "--ids", "1", "2", "--", "1", "2"});
+  REQUIRE(options.values == std::vector<int>{1, 2});
+  REQUIRE(options.flags == std::vector<bool>{true, false});
+  REQUIRE(options.ids == std::unordered_set<int>{1, 2});
+}
@@ -0,0 +1,82 @@
+#include <doctest.hpp>
+#include <stdexcept>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct LazyVectorArgument {
+  structopt::lazy_vector<int> values;
+  std::optional<structopt::lazy_vector<double>> weights;
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(LazyVectorArgument, values, weights, verbose);
+
+TEST_CASE("structopt can parse lazy vector arguments" * test_suite("lazy_vector")) {
+  {
+    auto arguments = structopt::app("test").parse<LazyVectorArgument>(std::vector<std::string>{
+        "./main", "1", "-2", "0x10", "--weights", "0.5", "1e3", "-v"});
+    REQUIRE(arguments.values.size() == 3);
+    REQUIRE(arguments.values.token(2) == "0x10");
+    REQUIRE(arguments.values[0] == 1);
+    REQUIRE(arguments.values[1] == -2);
+    REQUIRE(arguments.values.at(2) == 16);
+    REQUIRE_THROWS_AS(arguments.values.at(3), std::out_of_range);
+    REQUIRE(arguments.weights.has_value());
+    REQUIRE(arguments.weights->values() == std::vector<double>{0.5, 1000});
+    REQUIRE(arguments.verbose == true);
+  }
+  {
+    auto arguments = structopt::app("test").parse<LazyVectorArgument>(
+        std::vector<std::string>{"./main", "--verbose"});
+    REQUIRE(arguments.values.empty());
+    REQUIRE(arguments.values.values().empty());
+    REQUIRE(!arguments.weights.has_value());
+  }
+  {
+    // `--` ends the values
+    auto arguments = structopt::app("test").parse<LazyVectorArgument>(
+        std::vector<std::string>{"./main", "--weights", "1", "--", "4", "5"});
+    REQUIRE(arguments.weights->size() == 1);
+    REQUIRE(arguments.values.values() == std::vector<int>{4, 5});
+  }
+}
+
+TEST_CASE("structopt reports invalid lazy vector elements on access" *
+          test_suite("lazy_vector")) {
+  auto arguments = structopt::app("test").parse<LazyVectorArgument>(
+      std::vector<std::string>{"./main", "1", "two", "99999999999", "4"});
+  REQUIRE(arguments.values.size() == 4);
+  REQUIRE(arguments.values[0] == 1);
+  REQUIRE(arguments.values[3] == 4);
+
+  bool exception_thrown{false};
+  try {
+    arguments.values.materialize(3);
+  } catch (std::invalid_argument &e) {
+    exception_thrown = true;
+    REQUIRE(std::string{e.what()} ==
+            "Error: failed to parse numeric argument `values`. `two` is invalid.");
+  }
+  REQUIRE(exception_thrown == true);
+  REQUIRE_THROWS_AS(arguments.values[2], std::out_of_range);
+}
+
+struct LazyStringVectorArgument {
+  structopt::lazy_vector<std::string> files;
+};
+STRUCTOPT(LazyStringVectorArgument, files);
+
+TEST_CASE("structopt materializes lazy vectors on several threads" *
+          test_suite("lazy_vector")) {
+  std::vector<std::string> arguments{"./main"};
+  for (int i = 0; i < 100000; i++) {
+    arguments.push_back("file" + std::to_string(i));
+  }
+  auto options = structopt::app("test").parse<LazyStringVectorArgument>(arguments);
+
+  // The parsed text does not depend on the arguments after parsing
+  const std::vector<std::string> expected(arguments.begin() + 1, arguments.end());
+  arguments.clear();
+  REQUIRE(options.files[99999] == "file99999");
+  REQUIRE(options.files.values(4) == expected);
+}
@@ -33,4 +33,34 @@ TEST_CASE("structopt can parse nested structs" * test_suite("nested_struct")) {
     REQUIRE(arguments.foo.bar == 15);
     REQUIRE(arguments.foo.local.has_value() == true);
   }
-}
\ No newline at end of file
+}
+
+struct PositionalBeforeCommand {
+  struct SubCommand : structopt::sub_command {
+    std::optional<int> level;
+  };
+  std::string name;
+  SubCommand sub;
+};
+STRUCTOPT(PositionalBeforeCommand::SubCommand, level);
+STRUCTOPT(PositionalBeforeCommand, name, sub);
+
+TEST_CASE("structopt fills positional fields declared before a sub-command first" *
+          test_suite("nested_struct")) {
+  const auto app = structopt::app("test");
+  {
+    auto arguments = app.parse<PositionalBeforeCommand>(
+        std::vector<std::string>{"./main", "x", "sub", "--level", "2"});
+    REQUIRE(arguments.name == "x");
+    REQUIRE(arguments.sub.has_value());
+    REQUIRE(arguments.sub.level == 2);
+  }
+  {
+    // `sub` is the value of `name`, so `--level` is not an option of the struct
+    auto result = app.try_parse<PositionalBeforeCommand>(
+        std::vector<std::string>{"./main", "sub", "--level", "2"});
+    REQUIRE(!result.has_value());
+    REQUIRE(result.error().kind() == structopt::error_kind::unrecognized_argument);
+    REQUIRE(result.error().token() == "--level");
+  }
+}
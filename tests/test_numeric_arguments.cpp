@@ -0,0 +1,144 @@
+#include <allocations.hpp>
+#include <cstdint>
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct IntegerArguments {
+  std::vector<int> numbers;
+};
+STRUCTOPT(IntegerArguments, numbers);
+
+struct FloatArguments {
+  std::vector<float> numbers;
+};
+STRUCTOPT(FloatArguments, numbers);
+
+struct DoubleArguments {
+  std::vector<double> numbers;
+};
+STRUCTOPT(DoubleArguments, numbers);
+
+struct WideIntegerArguments {
+  std::optional<std::int64_t> value;
+  std::optional<std::uint16_t> small;
+  std::optional<std::int16_t> tiny;
+  std::optional<unsigned> count;
+  std::optional<double> ratio;
+};
+STRUCTOPT(WideIntegerArguments, value, small, tiny, count, ratio);
+
+template <typename T> std::string parse_error(const std::vector<std::string> &arguments) {
+  try {
+    structopt::app("test").parse<T>(arguments);
+  } catch (structopt::exception &e) {
+    return e.what();
+  }
+  return "";
+}
+
+TEST_CASE("structopt can parse integer literals" * test_suite("numeric")) {
+  auto arguments = structopt::app("test").parse<IntegerArguments>(
+      std::vector<std::string>{"./main", "1", "0x5B", "071", "0b0101", "-35", "+98", "0", "08"});
+  REQUIRE(arguments.numbers == std::vector<int>{1, 91, 57, 5, -35, 98, 0, 8});
+
+  // sign and prefix
+  arguments = structopt::app("test").parse<IntegerArguments>(
+      std::vector<std::string>{"./main", "+0x10", "+0b11", "-017"});
+  REQUIRE(arguments.numbers == std::vector<int>{16, 3, -15});
+
+  // fractional part is truncated
+  arguments = structopt::app("test").parse<IntegerArguments>(
+      std::vector<std::string>{"./main", "-1.9", "2.", "-0.5"});
+  REQUIRE(arguments.numbers == std::vector<int>{-1, 2, 0});
+}
+
+TEST_CASE("structopt can parse floating point literals" * test_suite("numeric")) {
+  auto arguments = structopt::app("test").parse<FloatArguments>(std::vector<std::string>{
+      "./main", "-3.15", "+2.717", "2E-4", "0.1e2", ".5", "-.3", "+5.999"});
+  REQUIRE(arguments.numbers ==
+          std::vector<float>{-3.15f, 2.717f, 2E-4f, 0.1e2f, .5f, -.3f, +5.999f});
+}
+
+TEST_CASE("structopt parses integers at the limits of their type" * test_suite("numeric")) {
+  auto arguments = structopt::app("test").parse<WideIntegerArguments>(std::vector<std::string>{
+      "./main", "--value",
+      "0b111111111111111111111111111111111111111111111111111111111111111", "--small", "65535",
+      "--tiny", "-32768", "--count", "0xFFFFFFFF", "--ratio", "1e300"});
+  REQUIRE(arguments.value == (std::numeric_limits<std::int64_t>::max)());
+  REQUIRE(arguments.small == 65535);
+  REQUIRE(arguments.tiny == -32768);
+  REQUIRE(arguments.count == 0xFFFFFFFF);
+  REQUIRE(arguments.ratio == 1e300);
+
+  arguments = structopt::app("test").parse<WideIntegerArguments>(
+      std::vector<std::string>{"./main", "--value", "-9223372036854775808"});
+  REQUIRE(arguments.value == (std::numeric_limits<std::int64_t>::min)());
+
+  arguments = structopt::app("test").parse<WideIntegerArguments>(
+      std::vector<std::string>{"./main", "--value", "-0x10"});
+  REQUIRE(arguments.value == -16);
+}
+
+TEST_CASE("structopt reports out of range numbers" * test_suite("numeric")) {
+  REQUIRE(parse_error<WideIntegerArguments>({"./main", "--small", "65536"}) ==
+          "Error: failed to parse numeric argument `small`. `65536` is out of range.");
+  REQUIRE(parse_error<WideIntegerArguments>({"./main", "--tiny", "-32769"}) ==
+          "Error: failed to parse numeric argument `tiny`. `-32769` is out of range.");
+  REQUIRE(parse_error<WideIntegerArguments>({"./main", "--count", "-1"}) ==
+          "Error: failed to parse numeric argument `count`. `-1` is out of range.");
+  REQUIRE(parse_error<WideIntegerArguments>({"./main", "--value", "9223372036854775808"}) ==
+          "Error: failed to parse numeric argument `value`. `9223372036854775808` is out "
+          "of range.");
+  REQUIRE(parse_error<WideIntegerArguments>({"./main", "--ratio", "1e999"}) ==
+          "Error: failed to parse numeric argument `ratio`. `1e999` is out of range.");
+}
+
+TEST_CASE("structopt reports invalid numbers" * test_suite("numeric")) {
+  REQUIRE(parse_error<IntegerArguments>({"./main", "1", "2abc"}) ==
+          "Error: failed to parse numeric argument `numbers`. `2abc` is invalid.");
+  REQUIRE(parse_error<IntegerArguments>({"./main", "1e5"}) ==
+          "Error: failed to parse numeric argument `numbers`. `1e5` is invalid.");
+  REQUIRE(parse_error<IntegerArguments>({"./main", "0x1.5"}) ==
+          "Error: failed to parse numeric argument `numbers`. `0x1.5` is invalid.");
+  REQUIRE(parse_error<IntegerArguments>({"./main", "foo"}) ==
+          "Error: failed to parse numeric argument `numbers`. `foo` is invalid.");
+  REQUIRE(parse_error<FloatArguments>({"./main", "1.5f"}) ==
+          "Error: failed to parse numeric argument `numbers`. `1.5f` is invalid.");
+  REQUIRE(parse_error<FloatArguments>({"./main", "+-1"}) ==
+          "Error: failed to parse numeric argument `numbers`. `+-1` is invalid.");
+  REQUIRE(parse_error<WideIntegerArguments>({"./main", "--count", "0x"}) ==
+          "Error: failed to parse numeric argument `count`. `0x` is invalid.");
+}
+
+TEST_CASE("structopt converts numbers without a stream" * test_suite("numeric")) {
+  double d{};
+  REQUIRE(structopt::details::parse_number("1.25", d) == std::errc());
+  REQUIRE(d == 1.25);
+
+  long long ll{};
+  REQUIRE(structopt::details::parse_number("-0x7FFFFFFFFFFFFFFF", ll) == std::errc());
+  REQUIRE(ll == -0x7FFFFFFFFFFFFFFF);
+
+  unsigned short us{};
+  REQUIRE(structopt::details::parse_number("65536", us) == std::errc::result_out_of_range);
+  REQUIRE(structopt::details::parse_number("", us) == std::errc::invalid_argument);
+  REQUIRE(structopt::details::parse_number(" 1", us) == std::errc::invalid_argument);
+}
+
+TEST_CASE("structopt converts many numbers without allocating per value" *
+          test_suite("numeric")) {
+  std::vector<std::string> arguments{"./main"};
+  for (int i = 0; i < 200000; i++) {
+    arguments.push_back(std::to_string(i * 0.37));
+  }
+  const auto app = structopt::app("test");
+  DoubleArguments options = app.parse<DoubleArguments>(std::vector<std::string>{"./main", "1"});
+  // only the vector grows; the time against std::istringstream is in structopt_bench
+  const auto allocations =
+      structopt_test::allocations_in([&] { options = app.parse<DoubleArguments>(arguments); });
+  REQUIRE(options.numbers.size() == 200000);
+  REQUIRE(options.numbers.back() == doctest::Approx(199999 * 0.37));
+  REQUIRE(allocations < 64);
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <doctest.hpp>
+#include <memory>
+#include <sstream>
+#include <structopt/app.hpp>
+#include <structopt/trace_observer.hpp>
+
+using doctest::test_suite;
+
+struct ObservedCommand : structopt::sub_command {
+  std::optional<int> level;
+  std::string name;
+};
+STRUCTOPT(ObservedCommand, level, name);
+
+struct ObservedOptions {
+  std::string input_file;
+  std::optional<int> level;
+  std::optional<bool> verbose = false;
+  ObservedCommand config;
+};
+STRUCTOPT(ObservedOptions, input_file, level, verbose, config);
+
+namespace {
+
+struct recorded_event {
+  structopt::parse_event_kind kind;
+  std::string token;
+  structopt::token_kind kind_of_token;
+  std::string field;
+  std::size_t tokens;
+  bool converted;
+};
+
+class recording_observer : public structopt::observer {
+public:
+  std::vector<recorded_event> events;
+
+  void on_event(const structopt::parse_event &event) override {
+    events.push_back({event.kind, std::string(event.token), event.kind_of_token,
+                      std::string(event.field), event.tokens, event.converted});
+  }
+
+  std::vector<structopt::parse_event_kind> kinds() const {
+    std::vector<structopt::parse_event_kind> result;
+    for (const auto &event : events) {
+      result.push_back(event.kind);
+    }
+    return result;
+  }
+};
+
+} // namespace
+
+TEST_CASE("structopt tells an observer about every step of a parse" *
+          test_suite("observer")) {
+  using kind = structopt::parse_event_kind;
+  auto events = std::make_shared<recording_observer>();
+  auto options = structopt::app("test").observe(events).parse<ObservedOptions>(
+      std::vector<std::string>{"./main", "--level", "3", "foo.txt"});
+  REQUIRE(options.level == 3);
+  REQUIRE(options.input_file == "foo.txt");
+
+  REQUIRE(events->kinds() == std::vector<kind>{kind::parse_started,
+                                               kind::token_classified,
+                                               kind::field_matched,
+                                               kind::value_converted,
+                                               kind::token_classified,
+                                               kind::field_matched,
+                                               kind::value_converted,
+                                               kind::parse_finished});
+  const auto &e = events->events;
+  REQUIRE(e[1].token == "--level");
+  REQUIRE(e[1].kind_of_token == structopt::token_kind::long_option);
+  REQUIRE(e[2].field == "level");
+  REQUIRE(e[3].field == "level");
+  REQUIRE(e[3].tokens == 2);
+  REQUIRE(e[3].converted);
+  REQUIRE(e[4].token == "foo.txt");
+  REQUIRE(e[5].field == "input_file");
+  REQUIRE(e[6].tokens == 1);
+}
+
+TEST_CASE("structopt tells an observer about sub-commands and errors" *
+          test_suite("observer")) {
+  using kind = structopt::parse_event_kind;
+  auto events = std::make_shared<recording_observer>();
+  const auto app = structopt::app("test").observe(events);
+  {
+    auto options = app.parse<ObservedOptions>(
+        std::vector<std::string>{"./main", "foo.txt", "config", "--level", "2", "bar"});
+    REQUIRE(options.config.level == 2);
+    REQUIRE(options.config.name == "bar");
+
+    const auto &e = events->events;
+    const auto entered = std::find_if(e.begin(), e.end(), [](const recorded_event &event) {
+      return event.kind == kind::subcommand_entered;
+    });
+    REQUIRE(entered != e.end());
+    REQUIRE(entered->field == "config");
+    // the sub-command's events fall between its field_matched and value_converted
+    REQUIRE(e[e.size() - 2].kind == kind::value_converted);
+    REQUIRE(e[e.size() - 2].field == "config");
+    REQUIRE(e[e.size() - 2].tokens == 4);
+  }
+  {
+    events->events.clear();
+    auto result = app.try_parse<ObservedOptions>(
+        std::vector<std::string>{"./main", "--level", "high", "foo.txt"});
+    REQUIRE(!result.has_value());
+
+    const auto kinds = events->kinds();
+    REQUIRE(std::count(kinds.begin(), kinds.end(), kind::error_raised) == 1);
+    REQUIRE(kinds.back() == kind::parse_finished);
+    const auto converted = std::find_if(
+        events->events.begin(), events->events.end(),
+        [](const recorded_event &event) { return event.kind == kind::value_converted; });
+    REQUIRE(converted != events->events.end());
+    REQUIRE(!converted->converted);
+  }
+  {
+    events->events.clear();
+    auto options = structopt::app(app).observe(nullptr).parse<ObservedOptions>(
+        std::vector<std::string>{"./main", "foo.txt"});
+    REQUIRE(options.input_file == "foo.txt");
+    REQUIRE(events->events.empty());
+  }
+}
+
+TEST_CASE("structopt trace_observer summarizes a parse per field" *
+          test_suite("observer")) {
+  std::ostringstream os;
+  std::size_t allocations = 0;
+  auto trace = std::make_shared<structopt::trace_observer>(
+      &os, [&allocations]() { return allocations += 1; });
+  auto options = structopt::app("test").observe(trace).parse<ObservedOptions>(
+      std::vector<std::string>{"./main", "-v", "foo.txt", "config", "--level", "2", "bar"});
+  REQUIRE(options.verbose == true);
+
+  std::vector<std::string> names;
+  for (const auto &field : trace->fields()) {
+    names.push_back(field.name);
+    REQUIRE(field.matches == 1);
+  }
+  REQUIRE(names == std::vector<std::string>{"verbose", "input_file", "config",
+                                            "config.level", "config.name"});
+  REQUIRE(trace->fields()[2].tokens == 4);
+  REQUIRE(trace->fields()[3].tokens == 2);
+  REQUIRE(trace->fields()[2].time >= trace->fields()[3].time);
+  REQUIRE(trace->total() >= trace->fields()[2].time);
+
+  const auto report = os.str();
+  REQUIRE(report.rfind("structopt: 6 tokens, 1 sub-command in ", 0) == 0);
+  REQUIRE(report.find(" allocations\n") != std::string::npos);
+  REQUIRE(report.find("config.level") != std::string::npos);
+  // the stream's formatting is left as it was
+  REQUIRE((os.flags() & std::ios_base::fixed) == 0);
+
+  std::ostringstream failed;
+  structopt::app("test")
+      .observe(std::make_shared<structopt::trace_observer>(&failed))
+      .try_parse<ObservedOptions>(std::vector<std::string>{"./main", "--level", "high"});
+  REQUIRE(failed.str().find("high") != std::string::npos);
+}
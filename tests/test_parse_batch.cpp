@@ -0,0 +1,78 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+#include <thread>
+
+using doctest::test_suite;
+
+struct JobSpec {
+  // Positional arguments
+  std::string name;
+  std::vector<std::string> inputs;
+
+  // Optional arguments
+  std::optional<int> priority = 0;
+  std::optional<double> timeout;
+  std::optional<bool> retry = false;
+};
+STRUCTOPT(JobSpec, name, inputs, priority, timeout, retry);
+
+// Every 10th job spec has an invalid priority
+static std::vector<std::vector<std::string>> make_job_specs(std::size_t num_jobs) {
+  std::vector<std::vector<std::string>> result;
+  result.reserve(num_jobs);
+  for (std::size_t i = 0; i < num_jobs; i++) {
+    result.push_back({"./job", "--priority", i % 10 == 9 ? "high" : std::to_string(i),
+                      "--timeout", "2.5", "-r", "job" + std::to_string(i), "a.txt",
+                      "b.txt", "c.txt"});
+  }
+  return result;
+}
+
+TEST_CASE("structopt parses a batch of argument lists" * test_suite("parse_batch")) {
+  const auto app = structopt::app("job");
+  const auto job_specs = make_job_specs(1000);
+
+  for (std::size_t num_threads : {1, 3, 0}) {
+    const auto results = app.parse_batch<JobSpec>(job_specs, num_threads);
+    REQUIRE(results.size() == job_specs.size());
+    for (std::size_t i = 0; i < results.size(); i++) {
+      if (i % 10 == 9) {
+        REQUIRE(!results[i].has_value());
+        REQUIRE(results[i].error().kind() == structopt::error_kind::invalid_value);
+        REQUIRE(results[i].error().field_name() == "priority");
+        REQUIRE(results[i].error().token_index() == 2);
+      } else {
+        REQUIRE(results[i].has_value());
+        REQUIRE(results[i]->name == "job" + std::to_string(i));
+        REQUIRE(results[i]->priority == static_cast<int>(i));
+        REQUIRE(results[i]->timeout == 2.5);
+        REQUIRE(results[i]->retry == true);
+        REQUIRE(results[i]->inputs == std::vector<std::string>{"a.txt", "b.txt", "c.txt"});
+      }
+    }
+  }
+
+  REQUIRE(app.parse_batch<JobSpec>({}).empty());
+  REQUIRE(app.help().find("USAGE: job") != std::string::npos);
+}
+
+TEST_CASE("structopt parses with one app on several threads" * test_suite("parse_batch")) {
+  const auto app = structopt::app("job");
+  const auto job_specs = make_job_specs(200);
+
+  std::vector<std::size_t> parsed(4);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < parsed.size(); t++) {
+    threads.emplace_back([&, t] {
+      for (const auto &job_spec : job_specs) {
+        if (app.try_parse<JobSpec>(job_spec)) {
+          parsed[t] += 1;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  REQUIRE(parsed == std::vector<std::size_t>(4, 180));
+}
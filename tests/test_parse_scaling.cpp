@@ -0,0 +1,258 @@
+#include <allocations.hpp>
+#include <doctest.hpp>
+#include <memory>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct WideOptions {
+  std::optional<int> option_00;
+  std::optional<int> option_01;
+  std::optional<int> option_02;
+  std::optional<int> option_03;
+  std::optional<int> option_04;
+  std::optional<int> option_05;
+  std::optional<int> option_06;
+  std::optional<int> option_07;
+  std::optional<int> option_08;
+  std::optional<int> option_09;
+  std::optional<int> option_10;
+  std::optional<int> option_11;
+  std::optional<int> option_12;
+  std::optional<int> option_13;
+  std::optional<int> option_14;
+  std::optional<int> option_15;
+  std::optional<int> option_16;
+  std::optional<int> option_17;
+  std::optional<int> option_18;
+  std::optional<int> option_19;
+  std::optional<int> option_20;
+  std::optional<int> option_21;
+  std::optional<int> option_22;
+  std::optional<int> option_23;
+  std::optional<int> option_24;
+  std::optional<int> option_25;
+  std::optional<int> option_26;
+  std::optional<int> option_27;
+  std::optional<int> option_28;
+  std::optional<int> option_29;
+  std::optional<int> option_30;
+  std::optional<int> option_31;
+  std::optional<int> option_32;
+  std::optional<int> option_33;
+  std::optional<int> option_34;
+  std::optional<int> option_35;
+  std::optional<int> option_36;
+  std::optional<int> option_37;
+  std::optional<int> option_38;
+  std::optional<int> option_39;
+  std::optional<int> option_40;
+  std::optional<int> option_41;
+  std::optional<int> option_42;
+  std::optional<int> option_43;
+  std::optional<int> option_44;
+  std::optional<int> option_45;
+  std::optional<int> option_46;
+  std::optional<int> option_47;
+  std::optional<bool> flag_a = false;
+  std::optional<bool> flag_b = false;
+  std::string input_file;
+  std::vector<std::string> files;
+};
+STRUCTOPT(WideOptions, option_00, option_01, option_02, option_03, option_04, option_05, option_06,
+          option_07, option_08, option_09, option_10, option_11, option_12, option_13,
+          option_14, option_15, option_16, option_17, option_18, option_19, option_20,
+          option_21, option_22, option_23, option_24, option_25, option_26, option_27,
+          option_28, option_29, option_30, option_31, option_32, option_33, option_34,
+          option_35, option_36, option_37, option_38, option_39, option_40, option_41,
+          option_42, option_43, option_44, option_45, option_46, option_47, flag_a,
+          flag_b, input_file, files);
+
+struct NarrowOptions {
+  std::optional<int> option_00;
+  std::optional<int> option_01;
+  std::optional<bool> flag_a = false;
+  std::optional<bool> flag_b = false;
+  std::string input_file;
+  std::vector<std::string> files;
+};
+STRUCTOPT(NarrowOptions, option_00, option_01, flag_a, flag_b, input_file, files);
+
+// ./main input.txt --option_47 0 --option_46 1 ... --flag_a --flag-b file0 file1 ...
+//
+// Options are passed in reverse declaration order, cycling through `num_fields` fields
+static std::vector<std::string> make_arguments(std::size_t num_fields, std::size_t num_options,
+                                               std::size_t num_files) {
+  std::vector<std::string> arguments{"./main", "input.txt"};
+  for (std::size_t i = 0; i < num_options; i++) {
+    const auto index = std::to_string(num_fields - 1 - i % num_fields);
+    arguments.push_back("--option_" + std::string(index.size() == 1 ? "0" : "") + index);
+    arguments.push_back(std::to_string(i));
+  }
+  arguments.push_back("--flag_a");
+  arguments.push_back("--flag-b");
+  for (std::size_t i = 0; i < num_files; i++) {
+    arguments.push_back("file" + std::to_string(i));
+  }
+  return arguments;
+}
+
+// Counts the fields that the parser dispatches a token to
+class field_counter : public structopt::observer {
+public:
+  std::size_t matches{0};
+
+  void on_event(const structopt::parse_event &event) override {
+    if (event.kind == structopt::parse_event_kind::field_matched) {
+      matches += 1;
+    }
+  }
+};
+
+// Fields matched while parsing `arguments` into a T
+template <typename T> std::size_t fields_matched(const std::vector<std::string> &arguments) {
+  auto counter = std::make_shared<field_counter>();
+  auto options = structopt::app("test").observe(counter).parse<T>(arguments);
+  REQUIRE(options.input_file == "input.txt");
+  return counter->matches;
+}
+
+// Allocations while parsing `arguments` into a T
+template <typename T>
+std::size_t parse_allocations(const std::vector<std::string> &arguments) {
+  const auto app = structopt::app("test");
+  app.parse<T>(arguments); // builds the schema of T
+  return structopt_test::allocations_in([&] { app.parse<T>(arguments); });
+}
+
+TEST_CASE("structopt parses a wide struct correctly" * test_suite("parse_scaling")) {
+  auto arguments = structopt::app("test").parse<WideOptions>(make_arguments(48, 96, 3));
+  REQUIRE(arguments.input_file == "input.txt");
+  REQUIRE(arguments.option_47 == 48);
+  REQUIRE(arguments.option_00 == 95);
+  REQUIRE(arguments.option_01 == 94);
+  REQUIRE(arguments.flag_a == true);
+  REQUIRE(arguments.flag_b == true);
+  REQUIRE(arguments.files == std::vector<std::string>{"file0", "file1", "file2"});
+}
+
+TEST_CASE("structopt dispatches every argument to one field" * test_suite("parse_scaling")) {
+  // One field per option, plus input_file, files and the two flags, however many
+  // fields the struct has; visiting every field per argument would be O(args x fields)
+  REQUIRE(fields_matched<WideOptions>(make_arguments(48, 2000, 2000)) == 2004);
+  REQUIRE(fields_matched<NarrowOptions>(make_arguments(2, 2000, 2000)) == 2004);
+  REQUIRE(fields_matched<WideOptions>(make_arguments(48, 16000, 16000)) == 16004);
+
+  // Parsing a wider struct allocates nothing more
+  REQUIRE(parse_allocations<WideOptions>(make_arguments(48, 16000, 16000)) ==
+          parse_allocations<NarrowOptions>(make_arguments(2, 16000, 16000)));
+}
+
+// ./main input.txt --option_47=0 --option_46:1 ... -ff ...
+//
+// Delimited options, with a combined flag argument after every 8th option
+static std::vector<std::string> make_delimited_arguments(std::size_t num_options) {
+  std::vector<std::string> arguments{"./main", "input.txt"};
+  for (std::size_t i = 0; i < num_options; i++) {
+    const auto index = std::to_string(47 - i % 48);
+    arguments.push_back("--option_" + std::string(index.size() == 1 ? "0" : "") + index +
+                        (i % 2 == 0 ? "=" : ":") + std::to_string(i));
+    if (i % 8 == 7) {
+      arguments.push_back("-ff");
+    }
+  }
+  return arguments;
+}
+
+TEST_CASE("structopt parses delimited and combined arguments correctly" *
+          test_suite("parse_scaling")) {
+  auto arguments = structopt::app("test").parse<WideOptions>(make_delimited_arguments(97));
+  REQUIRE(arguments.input_file == "input.txt");
+  REQUIRE(arguments.option_47 == 96);
+  REQUIRE(arguments.option_46 == 49);
+  REQUIRE(arguments.option_00 == 95);
+  // every `-ff` toggles `flag_a` twice
+  REQUIRE(arguments.flag_a == false);
+  REQUIRE(arguments.files.empty());
+
+  auto delimited = make_delimited_arguments(8);
+  delimited.back() = "-fff";
+  arguments = structopt::app("test").parse<WideOptions>(delimited);
+  REQUIRE(arguments.option_40 == 7);
+  REQUIRE(arguments.flag_a == true);
+  REQUIRE(arguments.flag_b == false);
+}
+
+TEST_CASE("structopt splits delimited and combined arguments without copying them" *
+          test_suite("parse_scaling")) {
+  // Splitting `--opt=value` and `-ff` queues views of the parts: 8x the arguments
+  // allocate nothing more
+  REQUIRE(parse_allocations<WideOptions>(make_delimited_arguments(100000)) ==
+          parse_allocations<WideOptions>(make_delimited_arguments(12500)));
+}
+
+struct Level5Command : structopt::sub_command {
+  std::optional<bool> verbose = false;
+  std::vector<std::string> files;
+};
+STRUCTOPT(Level5Command, verbose, files);
+
+struct Level4Command : structopt::sub_command {
+  Level5Command level5;
+};
+STRUCTOPT(Level4Command, level5);
+
+struct Level3Command : structopt::sub_command {
+  Level4Command level4;
+};
+STRUCTOPT(Level3Command, level4);
+
+struct Level2Command : structopt::sub_command {
+  Level3Command level3;
+};
+STRUCTOPT(Level2Command, level3);
+
+struct DeepCommands {
+  Level2Command level2;
+};
+STRUCTOPT(DeepCommands, level2);
+
+struct ShallowCommands {
+  Level5Command level5;
+};
+STRUCTOPT(ShallowCommands, level5);
+
+// ./main level2 level3 level4 level5 --verbose file0 file1 ...
+//
+// `depth` sub-commands, ending with `level5`; DeepCommands nests five structs
+static std::vector<std::string> make_sub_command_arguments(std::size_t depth,
+                                                           std::size_t num_files) {
+  std::vector<std::string> arguments{"./main"};
+  for (std::size_t level = 6 - depth; level <= 5; level++) {
+    arguments.push_back("level" + std::to_string(level));
+  }
+  arguments.push_back("--verbose");
+  for (std::size_t i = 0; i < num_files; i++) {
+    arguments.push_back("file" + std::to_string(i));
+  }
+  return arguments;
+}
+
+TEST_CASE("structopt parses deeply nested sub-commands correctly" *
+          test_suite("parse_scaling")) {
+  auto commands =
+      structopt::app("test").parse<DeepCommands>(make_sub_command_arguments(4, 3));
+  REQUIRE(commands.level2.has_value());
+  REQUIRE(commands.level2.level3.level4.has_value());
+  const auto &level5 = commands.level2.level3.level4.level5;
+  REQUIRE(level5.has_value());
+  REQUIRE(level5.verbose == true);
+  REQUIRE(level5.files == std::vector<std::string>{"file0", "file1", "file2"});
+}
+
+TEST_CASE("structopt shares the tokens with sub-commands" * test_suite("parse_scaling")) {
+  // Every level of sub-commands continues on the same tokens: 4 levels allocate no
+  // more than 1, where a copy of the remaining arguments per level would
+  REQUIRE(parse_allocations<DeepCommands>(make_sub_command_arguments(4, 100000)) ==
+          parse_allocations<ShallowCommands>(make_sub_command_arguments(1, 100000)));
+}
@@ -0,0 +1,84 @@
+#include <allocations.hpp>
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct SchemaOptions {
+  // Positional arguments
+  std::string input_file;
+
+  // Optional arguments
+  std::optional<int> level;
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(SchemaOptions, input_file, level, verbose);
+
+TEST_CASE("structopt can reuse an app for repeated parses" * test_suite("schema")) {
+  auto app = structopt::app("test");
+  for (int i = 0; i < 3; i++) {
+    auto arguments = app.parse<SchemaOptions>(
+        std::vector<std::string>{"./main", "file" + std::to_string(i), "--level", std::to_string(i)});
+    REQUIRE(arguments.input_file == "file" + std::to_string(i));
+    REQUIRE(arguments.level == i);
+  }
+
+  // `help` and `version` are listed once, no matter how many times the app was used
+  const auto help = app.help();
+  REQUIRE(help.find("--help") == help.rfind("--help"));
+  REQUIRE(help.find("--version") == help.rfind("--version"));
+  REQUIRE(help.find("USAGE: test [FLAGS] [OPTIONS] input_file") != std::string::npos);
+}
+
+TEST_CASE("structopt shares the schema of a type across parses" * test_suite("schema")) {
+  const auto &schema = structopt::details::schema<SchemaOptions>();
+  REQUIRE(&schema == &structopt::details::schema<SchemaOptions>());
+  REQUIRE(schema.positional_field_names.size() == 1);
+  REQUIRE(schema.optional_field_names.size() == 3); // level, help, version
+
+  // Missing positional arguments are reported without mutating the schema
+  for (int i = 0; i < 2; i++) {
+    bool exception_thrown{false};
+    try {
+      auto arguments = structopt::app("test").parse<SchemaOptions>(std::vector<std::string>{"./main"});
+    } catch (structopt::exception &e) {
+      exception_thrown = true;
+      REQUIRE(std::string{e.what()} == "Error: expected value for positional argument `input_file`.");
+      REQUIRE(std::string{e.help()}.find("USAGE: test") != std::string::npos);
+    }
+    REQUIRE(exception_thrown == true);
+    REQUIRE(schema.positional_field_names.size() == 1);
+  }
+}
+
+TEST_CASE("structopt renders exception help on demand" * test_suite("schema")) {
+  bool exception_thrown{false};
+  try {
+    auto arguments = structopt::app("test", "1.0", "custom help\n")
+                         .parse<SchemaOptions>(std::vector<std::string>{"./main", "--level"});
+  } catch (structopt::exception &e) {
+    exception_thrown = true;
+    REQUIRE(std::string{e.what()} == "Error: expected value for optional argument `level`.");
+
+    // copies share the rendered help
+    const structopt::exception copy = e;
+    const char *help = copy.help();
+    REQUIRE(std::string{help} == "custom help\n");
+    REQUIRE(e.help() == help);
+  }
+  REQUIRE(exception_thrown == true);
+
+  exception_thrown = false;
+  try {
+    auto arguments = structopt::app("test").parse<SchemaOptions>(
+        std::vector<std::string>{"./main", "--level"});
+  } catch (structopt::exception &e) {
+    exception_thrown = true;
+    // the help is rendered by the first call to help(), not when the exception is thrown
+    std::string help;
+    REQUIRE(structopt_test::allocations_in([&]() { help = e.help(); }) > 1);
+    REQUIRE(help.find("USAGE: test") != std::string::npos);
+    REQUIRE(structopt_test::allocations_in([&]() { (void)e.help(); }) == 0);
+  }
+  REQUIRE(exception_thrown == true);
+}
@@ -0,0 +1,183 @@
+#include <doctest.hpp>
+#include <string>
+#include <structopt/app.hpp>
+#include <thread>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using doctest::test_suite;
+
+// A pipe whose write end is fed `contents` by a thread, e.g., like `find -print0 |`
+class input_pipe {
+  int fds_[2];
+  std::thread writer_;
+
+  static void write_all(int fd, const std::string &contents) {
+    std::size_t written = 0;
+    while (written < contents.size()) {
+      const auto size = std::min<std::size_t>(contents.size() - written, 1 << 16);
+#ifdef _WIN32
+      const auto count =
+          ::_write(fd, contents.data() + written, static_cast<unsigned>(size));
+#else
+      const auto count = ::write(fd, contents.data() + written, size);
+#endif
+      if (count <= 0) {
+        break;
+      }
+      written += static_cast<std::size_t>(count);
+    }
+  }
+
+  static void close(int fd) {
+#ifdef _WIN32
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif
+  }
+
+public:
+  explicit input_pipe(std::string contents) {
+#ifdef _WIN32
+    REQUIRE(::_pipe(fds_, 1 << 16, _O_BINARY) == 0);
+#else
+    REQUIRE(::pipe(fds_) == 0);
+#endif
+    writer_ = std::thread([this, contents = std::move(contents)] {
+      write_all(fds_[1], contents);
+      close(fds_[1]);
+    });
+  }
+
+  ~input_pipe() {
+    writer_.join();
+    close(fds_[0]);
+  }
+
+  int fd() const { return fds_[0]; }
+};
+
+struct RecordInputOptions {
+  std::string command;
+  std::vector<std::string> files;
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(RecordInputOptions, command, files, verbose);
+
+TEST_CASE("structopt reads container values from a file descriptor" *
+          test_suite("record_input")) {
+  {
+    // newline-delimited, with `\r\n` line endings and blank lines
+    input_pipe input("b.txt\r\nc d.txt\n\n-v\ne.txt");
+    auto options =
+        structopt::app("test").read_values_from(input.fd()).parse<RecordInputOptions>(
+            std::vector<std::string>{"./main", "index", "a.txt", "-", "f.txt", "-v"});
+    REQUIRE(options.command == "index");
+    REQUIRE(options.files == std::vector<std::string>{"a.txt", "b.txt", "c d.txt", "-v",
+                                                      "e.txt", "f.txt"});
+    REQUIRE(options.verbose == true);
+  }
+  {
+    // NUL-delimited, e.g., `find . -print0`
+    input_pipe input(std::string("./a b\0./c\nd\0", 12));
+    auto options = structopt::app("test")
+                       .read_values_from(input.fd(), '\0')
+                       .parse<RecordInputOptions>(
+                           std::vector<std::string>{"./main", "index", "-"});
+    REQUIRE(options.files == std::vector<std::string>{"./a b", "./c\nd"});
+  }
+  {
+    // Not enabled - `-` is a value
+    auto options = structopt::app("test").parse<RecordInputOptions>(
+        std::vector<std::string>{"./main", "-", "-"});
+    REQUIRE(options.command == "-");
+    REQUIRE(options.files == std::vector<std::string>{"-"});
+  }
+}
+
+struct RecordNumberOptions {
+  std::optional<std::set<int>> ids;
+  std::deque<double> weights;
+};
+STRUCTOPT(RecordNumberOptions, ids, weights);
+
+TEST_CASE("structopt converts records like arguments" * test_suite("record_input")) {
+  {
+    input_pipe input("3\n0x10\n3\n");
+    auto options =
+        structopt::app("test").read_values_from(input.fd()).parse<RecordNumberOptions>(
+            std::vector<std::string>{"./main", "0.5", "--ids", "1", "-"});
+    REQUIRE(options.ids == std::set<int>{1, 3, 16});
+    REQUIRE(options.weights == std::deque<double>{0.5});
+  }
+  {
+    input_pipe input("1.5\nabc\n2.5\n");
+    auto result = structopt::app("test")
+                      .read_values_from(input.fd())
+                      .try_parse<RecordNumberOptions>(
+                          std::vector<std::string>{"./main", "-", "-"});
+    REQUIRE(!result.has_value());
+    REQUIRE(result.error().kind() == structopt::error_kind::invalid_value);
+    REQUIRE(result.error().field_name() == "weights");
+    REQUIRE(result.error().token() == "abc");
+    REQUIRE(result.error().token_index() == 1);
+  }
+  {
+    // Not a file descriptor that can be read
+    auto result =
+        structopt::app("test").read_values_from(-2).try_parse<RecordNumberOptions>(
+            std::vector<std::string>{"./main", "-"});
+    REQUIRE(!result.has_value());
+    REQUIRE(result.error().kind() == structopt::error_kind::input_failed);
+    REQUIRE(result.error().message() ==
+            "Error: failed to read the values of `weights` from the input.");
+  }
+}
+
+static long long record_sum = 0;
+
+struct RecordStreamOptions {
+  structopt::stream<long long> values = [](long long value) { record_sum += value; };
+};
+STRUCTOPT(RecordStreamOptions, values);
+
+TEST_CASE("structopt streams a million records from a pipe" *
+          test_suite("record_input")) {
+  std::string contents;
+  long long expected = 0;
+  for (long long i = 0; i < 1000000; i++) {
+    contents += std::to_string(i) + '\n';
+    expected += i;
+  }
+  input_pipe input(std::move(contents));
+
+  record_sum = 0;
+  auto options =
+      structopt::app("test").read_values_from(input.fd()).parse<RecordStreamOptions>(
+          std::vector<std::string>{"./main", "-"});
+  REQUIRE(options.values.size() == 1000000);
+  REQUIRE(record_sum == expected);
+}
+
+struct RecordLazyOptions {
+  structopt::lazy_vector<int> values;
+};
+STRUCTOPT(RecordLazyOptions, values);
+
+TEST_CASE("structopt copies records into lazy vectors" * test_suite("record_input")) {
+  input_pipe input(std::string("2\0x\0" "4", 5));
+  auto options =
+      structopt::app("test")
+          .read_values_from(input.fd(), '\0')
+          .parse<RecordLazyOptions>(std::vector<std::string>{"./main", "1", "-", "5"});
+  REQUIRE(options.values.size() == 5);
+  REQUIRE(options.values.token(2) == "x");
+  REQUIRE(options.values[3] == 4);
+  REQUIRE(options.values[4] == 5);
+}
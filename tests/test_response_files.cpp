@@ -0,0 +1,190 @@
+#include <doctest.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct ResponseFileOptions {
+  // Positional arguments
+  std::string output;
+  std::vector<std::string> inputs;
+
+  // Optional arguments
+  std::optional<int> jobs;
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(ResponseFileOptions, output, inputs, jobs, verbose);
+
+// A file in the temporary directory, removed at the end of the test
+class temporary_file {
+  std::filesystem::path path_;
+
+public:
+  temporary_file(const std::string &name, const std::string &contents)
+      : path_(std::filesystem::temp_directory_path() / ("structopt_" + name)) {
+    std::ofstream(path_, std::ios::binary) << contents;
+  }
+
+  ~temporary_file() { std::filesystem::remove(path_); }
+
+  std::string argument() const { return "@" + path_.string(); }
+
+  std::string contents() const {
+    std::ifstream file(path_, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  }
+};
+
+TEST_CASE("structopt expands response files" * test_suite("response_files")) {
+  const temporary_file file("basic.rsp", "out.txt\n--jobs 4\r\n  a.txt\tb.txt\n");
+  auto options = structopt::app("test").expand_response_files().parse<ResponseFileOptions>(
+      std::vector<std::string>{"./main", file.argument(), "c.txt", "-v"});
+  REQUIRE(options.output == "out.txt");
+  REQUIRE(options.jobs == 4);
+  REQUIRE(options.inputs == std::vector<std::string>{"a.txt", "b.txt", "c.txt"});
+  REQUIRE(options.verbose == true);
+}
+
+TEST_CASE("structopt unquotes and unescapes response file arguments" *
+          test_suite("response_files")) {
+  const std::string contents =
+      R"("out file.txt" 'a b.txt' c\ d.txt "e \"f\".txt" 'it'\''s.txt' "" g"h i"j)";
+  const temporary_file file("quotes.rsp", contents);
+  auto options = structopt::app("test").expand_response_files().parse<ResponseFileOptions>(
+      std::vector<std::string>{"./main", file.argument()});
+  REQUIRE(options.output == "out file.txt");
+  REQUIRE(options.inputs == std::vector<std::string>{"a b.txt", "c d.txt", "e \"f\".txt",
+                                                     "it's.txt", "", "gh ij"});
+
+  // Arguments are unescaped in the mapping, not in the file
+  REQUIRE(file.contents() == contents);
+}
+
+TEST_CASE("structopt expands nested response files" * test_suite("response_files")) {
+  const temporary_file inner("inner.rsp", "b.txt c.txt");
+  const temporary_file outer("outer.rsp", "out.txt a.txt " + inner.argument() + " d.txt");
+  const temporary_file empty("empty.rsp", "");
+  auto options = structopt::app("test").expand_response_files().parse<ResponseFileOptions>(
+      std::vector<std::string>{"./main", outer.argument(), empty.argument(),
+                               inner.argument()});
+  REQUIRE(options.output == "out.txt");
+  REQUIRE(options.inputs ==
+          std::vector<std::string>{"a.txt", "b.txt", "c.txt", "d.txt", "b.txt", "c.txt"});
+}
+
+TEST_CASE("structopt reports response files that include themselves" *
+          test_suite("response_files")) {
+  const auto directory = std::filesystem::temp_directory_path();
+  const auto first = "@" + (directory / "structopt_first.rsp").string();
+  const auto second = "@" + (directory / "structopt_second.rsp").string();
+  const temporary_file first_file("first.rsp", "a.txt " + second);
+  const temporary_file second_file("second.rsp", "b.txt " + first);
+
+  auto result =
+      structopt::app("test").expand_response_files().try_parse<ResponseFileOptions>(
+          std::vector<std::string>{"./main", "out.txt", first});
+  REQUIRE(!result.has_value());
+  REQUIRE(result.error().kind() == structopt::error_kind::response_file_cycle);
+  REQUIRE(result.error().token_index() == 2);
+  REQUIRE(result.error().token() == first);
+  REQUIRE(result.error().message() == "Error: response file `" + first.substr(1) +
+                                          "` includes itself, directly or indirectly.");
+}
+
+TEST_CASE("structopt keeps arguments that are not response files" *
+          test_suite("response_files")) {
+  const temporary_file file("unused.rsp", "a.txt");
+
+  // Not enabled
+  auto options = structopt::app("test").parse<ResponseFileOptions>(
+      std::vector<std::string>{"./main", file.argument()});
+  REQUIRE(options.output == file.argument());
+
+  // No such file, or not a file
+  const auto directory = "@" + std::filesystem::temp_directory_path().string();
+  options = structopt::app("test").expand_response_files().parse<ResponseFileOptions>(
+      std::vector<std::string>{"./main", "@", "@no_such_file.rsp", directory});
+  REQUIRE(options.output == "@");
+  REQUIRE(options.inputs == std::vector<std::string>{"@no_such_file.rsp", directory});
+}
+
+// Every `details::response_files` maps the files anew, so the results of two
+// expansions do not share storage
+static std::vector<std::string> expand_arguments(const std::string &argument,
+                                                 std::size_t num_threads,
+                                                 std::size_t parallel_threshold) {
+  structopt::details::response_files files(num_threads, parallel_threshold);
+  structopt::details::tokens arguments{"./main", argument};
+  REQUIRE(!files.expand(arguments).has_value());
+  return {arguments.begin() + 1, arguments.end()};
+}
+
+TEST_CASE("structopt splits response files on several threads" *
+          test_suite("response_files")) {
+  const temporary_file inner("parallel_inner.rsp", "x.txt 'y z.txt'");
+
+  // Quotes and escapes across lines, i.e., across chunk boundaries
+  std::string contents;
+  for (int i = 0; i < 2000; i++) {
+    switch (i % 7) {
+    case 0:
+      contents += "file" + std::to_string(i) + ".txt\n";
+      break;
+    case 1:
+      contents += "\"quoted\n  across lines " + std::to_string(i) + "\"\n";
+      break;
+    case 2:
+      contents += "escaped\\\n" + std::to_string(i) + " \t";
+      break;
+    case 3:
+      contents += "'single \"quoted\"' \"\" ";
+      break;
+    case 4:
+      contents += inner.argument() + "\r\n";
+      break;
+    case 5:
+      contents += "'unterminated " + std::to_string(i) + "\n";
+      break;
+    default:
+      contents += "'closed' " + std::to_string(i) + "\n";
+      break;
+    }
+  }
+  const temporary_file file("parallel.rsp", contents);
+
+  const auto expected = expand_arguments(file.argument(), 1, 0);
+  REQUIRE(expected.size() > 1000);
+  for (std::size_t num_threads : {2, 3, 8, 0}) {
+    REQUIRE(expand_arguments(file.argument(), num_threads, 0) == expected);
+  }
+}
+
+struct FileListOptions {
+  std::vector<std::string> files;
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(FileListOptions, files, verbose);
+
+TEST_CASE("structopt fills long string vectors on several threads" *
+          test_suite("response_files")) {
+  std::string contents;
+  for (int i = 0; i < 100000; i++) {
+    contents += "/data/file_" + std::to_string(i) + ".txt\n";
+  }
+  const temporary_file file("file_list.rsp", contents);
+
+  for (std::size_t num_threads : {1, 4}) {
+    auto options = structopt::app("indexer")
+                       .expand_response_files()
+                       .threads(num_threads)
+                       .parse<FileListOptions>(
+                           std::vector<std::string>{"./main", file.argument(), "--verbose"});
+    REQUIRE(options.files.size() == 100000);
+    REQUIRE(options.files[0] == "/data/file_0.txt");
+    REQUIRE(options.files[54321] == "/data/file_54321.txt");
+    REQUIRE(options.files.back() == "/data/file_99999.txt");
+    REQUIRE(options.verbose == true);
+  }
+}
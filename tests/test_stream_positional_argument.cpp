@@ -0,0 +1,89 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+static std::vector<std::string> streamed_files;
+static long long streamed_sum = 0;
+
+struct StreamArgument {
+  std::string command;
+  structopt::stream<std::string> files = [](const std::string &file) {
+    streamed_files.push_back(file);
+  };
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(StreamArgument, command, files, verbose);
+
+TEST_CASE("structopt streams positional values to a sink" *
+          test_suite("stream_positional")) {
+  {
+    streamed_files.clear();
+    auto arguments = structopt::app("test").parse<StreamArgument>(
+        std::vector<std::string>{"./main", "index", "a.txt", "b.txt", "c.txt", "-v"});
+    REQUIRE(arguments.command == "index");
+    REQUIRE(arguments.files.size() == 3);
+    REQUIRE(arguments.verbose == true);
+    REQUIRE(streamed_files == std::vector<std::string>{"a.txt", "b.txt", "c.txt"});
+  }
+  {
+    streamed_files.clear();
+    auto arguments = structopt::app("test").parse<StreamArgument>(
+        std::vector<std::string>{"./main", "--verbose", "index"});
+    REQUIRE(arguments.files.empty());
+    REQUIRE(arguments.verbose == true);
+    REQUIRE(streamed_files.empty());
+  }
+  {
+    // after `--`, `-v` is a value
+    streamed_files.clear();
+    auto arguments = structopt::app("test").parse<StreamArgument>(
+        std::vector<std::string>{"./main", "index", "--", "-v", "a.txt"});
+    REQUIRE(arguments.files.size() == 2);
+    REQUIRE(arguments.verbose == false);
+    REQUIRE(streamed_files == std::vector<std::string>{"-v", "a.txt"});
+  }
+}
+
+struct StreamIntArgument {
+  structopt::stream<int> values = [](int value) { streamed_sum += value; };
+  std::optional<int> scale;
+};
+STRUCTOPT(StreamIntArgument, values, scale);
+
+TEST_CASE("structopt converts streamed values like vector elements" *
+          test_suite("stream_positional")) {
+  {
+    streamed_sum = 0;
+    auto arguments = structopt::app("test").parse<StreamIntArgument>(
+        std::vector<std::string>{"./main", "1", "-2", "0x10", "--scale", "3"});
+    REQUIRE(arguments.values.size() == 3);
+    REQUIRE(arguments.scale == 3);
+    REQUIRE(streamed_sum == 15);
+  }
+  {
+    // Values up to the invalid one have been delivered
+    streamed_sum = 0;
+    auto result = structopt::app("test").try_parse<StreamIntArgument>(
+        std::vector<std::string>{"./main", "1", "2", "three", "4"});
+    REQUIRE(!result.has_value());
+    REQUIRE(result.error().kind() == structopt::error_kind::invalid_value);
+    REQUIRE(result.error().field_name() == "values");
+    REQUIRE(streamed_sum == 3);
+  }
+}
+
+struct DroppedStreamArgument {
+  structopt::stream<double> values;
+};
+STRUCTOPT(DroppedStreamArgument, values);
+
+TEST_CASE("structopt streams a million values without a sink" *
+          test_suite("stream_positional")) {
+  std::vector<std::string> arguments{"./main"};
+  for (int i = 0; i < 1000000; i++) {
+    arguments.push_back(std::to_string(i) + ".5");
+  }
+  auto options = structopt::app("test").parse<DroppedStreamArgument>(arguments);
+  REQUIRE(options.values.size() == 1000000);
+}
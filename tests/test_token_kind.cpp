@@ -0,0 +1,86 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+using structopt::details::classify_token;
+using structopt::details::token_kind;
+
+static_assert(classify_token("foo.txt") == token_kind::literal);
+static_assert(classify_token("-") == token_kind::literal);
+static_assert(classify_token("") == token_kind::literal);
+static_assert(classify_token("42") == token_kind::number);
+static_assert(classify_token("-3.15") == token_kind::number);
+static_assert(classify_token("--") == token_kind::double_dash);
+static_assert(classify_token("-v") == token_kind::short_flag);
+static_assert(classify_token("-abc") == token_kind::flag_cluster);
+static_assert(classify_token("--verbose") == token_kind::long_option);
+static_assert(classify_token("--foo=bar") == token_kind::delimited_option);
+
+TEST_CASE("structopt classifies numbers" * test_suite("token_kind")) {
+  for (auto token : {"0", "42", "-42", "+98", "071", "0x5B", "-0x5b", "0b0101", "-0b1",
+                     "-3.15", "+2.717", "2E-4", "0.1e2", ".5", "-.3", "+5.999", "5.",
+                     "1e+10", "-1.5E3"}) {
+    INFO(token);
+    REQUIRE(classify_token(token) == token_kind::number);
+  }
+  for (auto token : {"foo", "0x", "0b", "0b12", "0xG", "1e", "1e+", ".", "+",
+                     "1.2.3", "1e5.5", "5f", "inf", "nan", "12a"}) {
+    INFO(token);
+    REQUIRE(classify_token(token) == token_kind::literal);
+  }
+}
+
+TEST_CASE("structopt classifies options" * test_suite("token_kind")) {
+  REQUIRE(classify_token("-e5") == token_kind::flag_cluster);
+  REQUIRE(classify_token("-1-2") == token_kind::flag_cluster);
+  REQUIRE(classify_token("-log-level") == token_kind::flag_cluster);
+  REQUIRE(classify_token("-0x") == token_kind::flag_cluster);
+  REQUIRE(classify_token("-.") == token_kind::short_flag);
+  REQUIRE(classify_token("-x") == token_kind::short_flag);
+  REQUIRE(classify_token("--log-level") == token_kind::long_option);
+  REQUIRE(classify_token("---") == token_kind::long_option);
+  REQUIRE(classify_token("-std=c++17") == token_kind::delimited_option);
+  REQUIRE(classify_token("--foo:BAR") == token_kind::delimited_option);
+  REQUIRE(classify_token("-5=3") == token_kind::delimited_option);
+  REQUIRE(classify_token("foo=bar") == token_kind::literal);
+}
+
+struct TokenKindOptions {
+  std::vector<double> values;
+  std::optional<int> offset;
+  std::optional<bool> verbose = false;
+};
+STRUCTOPT(TokenKindOptions, values, offset, verbose);
+
+TEST_CASE("structopt treats negative numbers as values" * test_suite("token_kind")) {
+  auto arguments = structopt::app("test").parse<TokenKindOptions>(std::vector<std::string>{
+      "./main", "-1", "-3.", "-2E-1", "-.5", "--offset", "-0x10", "-v"});
+  REQUIRE(arguments.values == std::vector<double>{-1, -3, -0.2, -0.5});
+  REQUIRE(arguments.offset == -16);
+  REQUIRE(arguments.verbose == true);
+}
+
+// How the parser used to tell options from values
+static bool is_optional_using_is_number(std::string_view token) {
+  if (token == "--" || structopt::details::is_valid_number(token)) {
+    return false;
+  }
+  return token.size() >= 2 && token[0] == '-';
+}
+
+TEST_CASE("structopt tells options from values like is_number.hpp" *
+          test_suite("token_kind")) {
+  // A realistic mix: options, values, files and numbers; the time of both is compared
+  // in structopt_bench
+  const std::vector<std::string> mix{"--verbose", "-v", "-abc", "--log-level=debug",
+                                     "input.txt", "/usr/local/include/foo.hpp", "42",
+                                     "-3.15", "0x5B", "--output", "build/out.bin",
+                                     "2E-4", "--", "-std:c++17", "release", "-1"};
+  for (const auto &token : mix) {
+    const auto kind = classify_token(token);
+    const bool option = kind != token_kind::literal && kind != token_kind::number &&
+                        kind != token_kind::double_dash;
+    // -3.15 and -1 are values; -abc and -std:c++17 are options
+    CHECK_MESSAGE(option == is_optional_using_is_number(token), token);
+  }
+}
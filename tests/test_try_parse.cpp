@@ -0,0 +1,148 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+struct TryParseOptions {
+  // Positional arguments
+  std::string input_file;
+  std::vector<int> values;
+
+  // Optional arguments
+  std::optional<int> level;
+  std::optional<bool> verbose = false;
+  std::optional<std::pair<int, int>> range;
+};
+STRUCTOPT(TryParseOptions, input_file, values, level, verbose, range);
+
+struct TryParseCommand : structopt::sub_command {
+  std::string name;
+};
+STRUCTOPT(TryParseCommand, name);
+
+struct TryParseCommands {
+  TryParseCommand first;
+  TryParseCommand second;
+};
+STRUCTOPT(TryParseCommands, first, second);
+
+TEST_CASE("structopt try_parse returns the parsed struct" * test_suite("try_parse")) {
+  auto result = structopt::app("test").try_parse<TryParseOptions>(
+      std::vector<std::string>{"./main", "foo.txt", "1", "2", "--level", "3", "-v"});
+  REQUIRE(result.has_value());
+  REQUIRE(result->input_file == "foo.txt");
+  REQUIRE(result->values == std::vector<int>{1, 2});
+  REQUIRE(result.value().level == 3);
+  REQUIRE(result.value().verbose == true);
+}
+
+TEST_CASE("structopt try_parse returns errors instead of throwing" * test_suite("try_parse")) {
+  auto app = structopt::app("test");
+  {
+    auto result = app.try_parse<TryParseOptions>(
+        std::vector<std::string>{"./main", "foo.txt", "--level", "abc"});
+    REQUIRE(!result);
+    REQUIRE(result.error().kind() == structopt::error_kind::invalid_value);
+    REQUIRE(result.error().token_index() == 3);
+    REQUIRE(result.error().field_name() == "level");
+    REQUIRE(result.error().token() == "abc");
+    REQUIRE(result.error().message() ==
+            "Error: failed to parse numeric argument `level`. `abc` is invalid.");
+    REQUIRE(result.error().help().find("USAGE: test") != std::string::npos);
+  }
+  {
+    auto result = app.try_parse<TryParseOptions>(
+        std::vector<std::string>{"./main", "foo.txt", "--level", "99999999999"});
+    REQUIRE(result.error().kind() == structopt::error_kind::value_out_of_range);
+  }
+  {
+    auto result =
+        app.try_parse<TryParseOptions>(std::vector<std::string>{"./main", "foo.txt", "--level"});
+    REQUIRE(result.error().kind() == structopt::error_kind::missing_value);
+    REQUIRE(result.error().token_index() == 3);
+    REQUIRE(result.error().message() == "Error: expected value for optional argument `level`.");
+  }
+  {
+    auto result = app.try_parse<TryParseOptions>(std::vector<std::string>{"./main"});
+    REQUIRE(result.error().kind() == structopt::error_kind::missing_value);
+    REQUIRE(result.error().field_name() == "input_file");
+  }
+  {
+    auto result = app.try_parse<TryParseOptions>(
+        std::vector<std::string>{"./main", "foo.txt", "--range", "1"});
+    REQUIRE(result.error().kind() == structopt::error_kind::missing_value);
+    REQUIRE(result.error().message() ==
+            "Error: failed to correctly parse the pair `range`. Expected 2 arguments, only 1 "
+            "provided.");
+  }
+  {
+    auto result = app.try_parse<TryParseOptions>(
+        std::vector<std::string>{"./main", "foo.txt", "--unknown"});
+    REQUIRE(result.error().kind() == structopt::error_kind::unrecognized_argument);
+    REQUIRE(result.error().token_index() == 2);
+    REQUIRE(result.error().message() == "Error: unrecognized argument '--unknown'");
+  }
+  {
+    // `-vx` is not a combined flag argument; the offending token is `-vx`
+    auto result = app.try_parse<TryParseOptions>(
+        std::vector<std::string>{"./main", "foo.txt", "-vx"});
+    REQUIRE(result.error().kind() == structopt::error_kind::unrecognized_argument);
+    REQUIRE(result.error().token() == "-vx");
+  }
+}
+
+TEST_CASE("structopt try_parse reports help and version requests" * test_suite("try_parse")) {
+  auto app = structopt::app("test", "1.0.0");
+  {
+    auto result =
+        app.try_parse<TryParseOptions>(std::vector<std::string>{"./main", "--help"});
+    REQUIRE(result.error().kind() == structopt::error_kind::help_requested);
+    REQUIRE(result.error().message() == app.help());
+  }
+  {
+    auto result =
+        app.try_parse<TryParseOptions>(std::vector<std::string>{"./main", "--version"});
+    REQUIRE(result.error().kind() == structopt::error_kind::version_requested);
+    REQUIRE(result.error().message() == "1.0.0");
+  }
+}
+
+TEST_CASE("structopt try_parse reports sub-command errors" * test_suite("try_parse")) {
+  {
+    auto result = structopt::app("test").try_parse<TryParseCommands>(
+        std::vector<std::string>{"./main", "first", "foo", "second", "bar"});
+    REQUIRE(result.error().kind() == structopt::error_kind::sub_command_conflict);
+    REQUIRE(result.error().token_index() == 3);
+    REQUIRE(result.error().token() == "second");
+    REQUIRE(result.error().message() ==
+            "Error: failed to invoke sub-command `second` because a different sub-command, "
+            "`first`, has already been invoked.");
+    REQUIRE(result.error().help().find("USAGE: second") != std::string::npos);
+  }
+  {
+    auto result = structopt::app("test").try_parse<TryParseCommands>(
+        std::vector<std::string>{"./main", "first"});
+    REQUIRE(result.error().kind() == structopt::error_kind::missing_value);
+    REQUIRE(result.error().field_name() == "name");
+    REQUIRE(result.error().help().find("USAGE: first") != std::string::npos);
+  }
+}
+
+TEST_CASE("structopt errors outlive the app that raised them" * test_suite("try_parse")) {
+  auto version = structopt::app("test", "1.0.2", "Custom help.")
+                     .try_parse<TryParseOptions>(std::vector<std::string>{"./main", "--version"});
+  auto help = structopt::app("test", "1.0.2", "Custom help.")
+                  .try_parse<TryParseOptions>(std::vector<std::string>{"./main", "--help"});
+  auto invalid = structopt::app("test", "1.0.2", "Custom help.")
+                     .try_parse<TryParseOptions>(
+                         std::vector<std::string>{"./main", "foo.txt", "--level", "abc"});
+  REQUIRE(version.error().message() == "1.0.2");
+  REQUIRE(help.error().help().find("Custom help.") != std::string::npos);
+  REQUIRE(invalid.error().token() == "abc");
+  REQUIRE(invalid.error().help().find("Custom help.") != std::string::npos);
+
+  // copies share the program's strings
+  const auto copy = invalid.error();
+  REQUIRE(copy.message() == invalid.error().message());
+  REQUIRE(copy.help() == invalid.error().help());
+}
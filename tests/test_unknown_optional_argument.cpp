@@ -37,4 +37,46 @@ TEST_CASE("structopt correctly parses optional arguments" * test_suite("single_o
     auto arguments = structopt::app("test").parse<OptionalArgsOptions>(std::vector<std::string>{"./main", "--directory", "foo/bar"});
     REQUIRE(arguments.directory == "foo/bar");
   }
-}
\ No newline at end of file
+}
+
+struct UnknownOptionFiles {
+  std::vector<std::string> files;
+  std::optional<int> value;
+};
+STRUCTOPT(UnknownOptionFiles, files, value);
+
+TEST_CASE("structopt takes unknown options as values of a positional container" *
+          test_suite("single_optional")) {
+  const auto app = structopt::app("test");
+  {
+    auto arguments = app.parse<UnknownOptionFiles>(
+        std::vector<std::string>{"./main", "--foo", "in"});
+    REQUIRE(arguments.files == std::vector<std::string>{"--foo", "in"});
+  }
+  {
+    // wherever they appear among the values
+    auto arguments = app.parse<UnknownOptionFiles>(
+        std::vector<std::string>{"./main", "in", "--foo", "out"});
+    REQUIRE(arguments.files == std::vector<std::string>{"in", "--foo", "out"});
+  }
+  {
+    // option names are case-sensitive, and a known option ends the container
+    auto arguments = app.parse<UnknownOptionFiles>(
+        std::vector<std::string>{"./main", "--VALUE", "in", "--value", "3"});
+    REQUIRE(arguments.files == std::vector<std::string>{"--VALUE", "in"});
+    REQUIRE(arguments.value == 3);
+  }
+  {
+    auto arguments = app.parse<UnknownOptionFiles>(
+        std::vector<std::string>{"./main", "--", "--value", "in"});
+    REQUIRE(arguments.files == std::vector<std::string>{"--value", "in"});
+  }
+  {
+    // without a container to take it, an unknown option is an error
+    auto result = app.try_parse<UnknownOptionFiles>(
+        std::vector<std::string>{"./main", "in", "--value", "3", "--foo"});
+    REQUIRE(!result.has_value());
+    REQUIRE(result.error().kind() == structopt::error_kind::unrecognized_argument);
+    REQUIRE(result.error().token() == "--foo");
+  }
+}
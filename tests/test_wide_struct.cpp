@@ -0,0 +1,386 @@
+#include <doctest.hpp>
+#include <structopt/app.hpp>
+
+using doctest::test_suite;
+
+// More fields than the 69 that VISITABLE_STRUCT used to support
+struct VeryWideOptions {
+  std::optional<int> option_000;
+  std::optional<int> option_001;
+  std::optional<int> option_002;
+  std::optional<int> option_003;
+  std::optional<int> option_004;
+  std::optional<int> option_005;
+  std::optional<int> option_006;
+  std::optional<int> option_007;
+  std::optional<int> option_008;
+  std::optional<int> option_009;
+  std::optional<int> option_010;
+  std::optional<int> option_011;
+  std::optional<int> option_012;
+  std::optional<int> option_013;
+  std::optional<int> option_014;
+  std::optional<int> option_015;
+  std::optional<int> option_016;
+  std::optional<int> option_017;
+  std::optional<int> option_018;
+  std::optional<int> option_019;
+  std::optional<int> option_020;
+  std::optional<int> option_021;
+  std::optional<int> option_022;
+  std::optional<int> option_023;
+  std::optional<int> option_024;
+  std::optional<int> option_025;
+  std::optional<int> option_026;
+  std::optional<int> option_027;
+  std::optional<int> option_028;
+  std::optional<int> option_029;
+  std::optional<int> option_030;
+  std::optional<int> option_031;
+  std::optional<int> option_032;
+  std::optional<int> option_033;
+  std::optional<int> option_034;
+  std::optional<int> option_035;
+  std::optional<int> option_036;
+  std::optional<int> option_037;
+  std::optional<int> option_038;
+  std::optional<int> option_039;
+  std::optional<int> option_040;
+  std::optional<int> option_041;
+  std::optional<int> option_042;
+  std::optional<int> option_043;
+  std::optional<int> option_044;
+  std::optional<int> option_045;
+  std::optional<int> option_046;
+  std::optional<int> option_047;
+  std::optional<int> option_048;
+  std::optional<int> option_049;
+  std::optional<int> option_050;
+  std::optional<int> option_051;
+  std::optional<int> option_052;
+  std::optional<int> option_053;
+  std::optional<int> option_054;
+  std::optional<int> option_055;
+  std::optional<int> option_056;
+  std::optional<int> option_057;
+  std::optional<int> option_058;
+  std::optional<int> option_059;
+  std::optional<int> option_060;
+  std::optional<int> option_061;
+  std::optional<int> option_062;
+  std::optional<int> option_063;
+  std::optional<int> option_064;
+  std::optional<int> option_065;
+  std::optional<int> option_066;
+  std::optional<int> option_067;
+  std::optional<int> option_068;
+  std::optional<int> option_069;
+  std::optional<int> option_070;
+  std::optional<int> option_071;
+  std::optional<int> option_072;
+  std::optional<int> option_073;
+  std::optional<int> option_074;
+  std::optional<int> option_075;
+  std::optional<int> option_076;
+  std::optional<int> option_077;
+  std::optional<int> option_078;
+  std::optional<int> option_079;
+  std::optional<int> option_080;
+  std::optional<int> option_081;
+  std::optional<int> option_082;
+  std::optional<int> option_083;
+  std::optional<int> option_084;
+  std::optional<int> option_085;
+  std::optional<int> option_086;
+  std::optional<int> option_087;
+  std::optional<int> option_088;
+  std::optional<int> option_089;
+  std::optional<int> option_090;
+  std::optional<int> option_091;
+  std::optional<int> option_092;
+  std::optional<int> option_093;
+  std::optional<int> option_094;
+  std::optional<int> option_095;
+  std::optional<int> option_096;
+  std::optional<int> option_097;
+  std::optional<int> option_098;
+  std::optional<int> option_099;
+  std::optional<int> option_100;
+  std::optional<int> option_101;
+  std::optional<int> option_102;
+  std::optional<int> option_103;
+  std::optional<int> option_104;
+  std::optional<int> option_105;
+  std::optional<int> option_106;
+  std::optional<int> option_107;
+  std::optional<int> option_108;
+  std::optional<int> option_109;
+  std::optional<int> option_110;
+  std::optional<int> option_111;
+  std::optional<int> option_112;
+  std::optional<int> option_113;
+  std::optional<int> option_114;
+  std::optional<int> option_115;
+  std::optional<int> option_116;
+  std::optional<int> option_117;
+  std::optional<int> option_118;
+  std::optional<int> option_119;
+  std::optional<int> option_120;
+  std::optional<int> option_121;
+  std::optional<int> option_122;
+  std::optional<int> option_123;
+  std::optional<int> option_124;
+  std::optional<int> option_125;
+  std::optional<int> option_126;
+  std::optional<int> option_127;
+  std::optional<int> option_128;
+  std::optional<int> option_129;
+  std::optional<int> option_130;
+  std::optional<int> option_131;
+  std::optional<int> option_132;
+  std::optional<int> option_133;
+  std::optional<int> option_134;
+  std::optional<int> option_135;
+  std::optional<int> option_136;
+  std::optional<int> option_137;
+  std::optional<int> option_138;
+  std::optional<int> option_139;
+  std::optional<int> option_140;
+  std::optional<int> option_141;
+  std::optional<int> option_142;
+  std::optional<int> option_143;
+  std::optional<int> option_144;
+  std::optional<int> option_145;
+  std::optional<int> option_146;
+  std::optional<int> option_147;
+  std::optional<int> option_148;
+  std::optional<int> option_149;
+  std::optional<int> option_150;
+  std::optional<int> option_151;
+  std::optional<int> option_152;
+  std::optional<int> option_153;
+  std::optional<int> option_154;
+  std::optional<int> option_155;
+  std::optional<int> option_156;
+  std::optional<int> option_157;
+  std::optional<int> option_158;
+  std::optional<int> option_159;
+  std::optional<int> option_160;
+  std::optional<int> option_161;
+  std::optional<int> option_162;
+  std::optional<int> option_163;
+  std::optional<int> option_164;
+  std::optional<int> option_165;
+  std::optional<int> option_166;
+  std::optional<int> option_167;
+  std::optional<int> option_168;
+  std::optional<int> option_169;
+  std::optional<int> option_170;
+  std::optional<int> option_171;
+  std::optional<int> option_172;
+  std::optional<int> option_173;
+  std::optional<int> option_174;
+  std::optional<int> option_175;
+  std::optional<int> option_176;
+  std::optional<int> option_177;
+  std::optional<int> option_178;
+  std::optional<int> option_179;
+  std::optional<int> option_180;
+  std::optional<int> option_181;
+  std::optional<int> option_182;
+  std::optional<int> option_183;
+  std::optional<int> option_184;
+  std::optional<int> option_185;
+  std::optional<int> option_186;
+  std::optional<int> option_187;
+  std::optional<int> option_188;
+  std::optional<int> option_189;
+  std::optional<int> option_190;
+  std::optional<int> option_191;
+  std::optional<int> option_192;
+  std::optional<int> option_193;
+  std::optional<int> option_194;
+  std::optional<int> option_195;
+  std::optional<int> option_196;
+  std::optional<int> option_197;
+  std::optional<int> option_198;
+  std::optional<int> option_199;
+  std::optional<int> option_200;
+  std::optional<int> option_201;
+  std::optional<int> option_202;
+  std::optional<int> option_203;
+  std::optional<int> option_204;
+  std::optional<int> option_205;
+  std::optional<int> option_206;
+  std::optional<int> option_207;
+  std::optional<int> option_208;
+  std::optional<int> option_209;
+  std::optional<int> option_210;
+  std::optional<int> option_211;
+  std::optional<int> option_212;
+  std::optional<int> option_213;
+  std::optional<int> option_214;
+  std::optional<int> option_215;
+  std::optional<int> option_216;
+  std::optional<int> option_217;
+  std::optional<int> option_218;
+  std::optional<int> option_219;
+  std::optional<int> option_220;
+  std::optional<int> option_221;
+  std::optional<int> option_222;
+  std::optional<int> option_223;
+  std::optional<int> option_224;
+  std::optional<int> option_225;
+  std::optional<int> option_226;
+  std::optional<int> option_227;
+  std::optional<int> option_228;
+  std::optional<int> option_229;
+  std::optional<int> option_230;
+  std::optional<int> option_231;
+  std::optional<int> option_232;
+  std::optional<int> option_233;
+  std::optional<int> option_234;
+  std::optional<int> option_235;
+  std::optional<int> option_236;
+  std::optional<int> option_237;
+  std::optional<int> option_238;
+  std::optional<int> option_239;
+  std::optional<int> option_240;
+  std::optional<int> option_241;
+  std::optional<int> option_242;
+  std::optional<int> option_243;
+  std::optional<int> option_244;
+  std::optional<int> option_245;
+  std::optional<int> option_246;
+  std::optional<int> option_247;
+  std::optional<int> option_248;
+  std::optional<int> option_249;
+  std::optional<int> option_250;
+  std::optional<int> option_251;
+  std::optional<int> option_252;
+  std::optional<int> option_253;
+  std::optional<int> option_254;
+  std::optional<int> option_255;
+  std::optional<int> option_256;
+  std::optional<int> option_257;
+  std::optional<int> option_258;
+  std::optional<int> option_259;
+  std::optional<int> option_260;
+  std::optional<int> option_261;
+  std::optional<int> option_262;
+  std::optional<int> option_263;
+  std::optional<int> option_264;
+  std::optional<int> option_265;
+  std::optional<int> option_266;
+  std::optional<int> option_267;
+  std::optional<int> option_268;
+  std::optional<int> option_269;
+  std::optional<int> option_270;
+  std::optional<int> option_271;
+  std::optional<int> option_272;
+  std::optional<int> option_273;
+  std::optional<int> option_274;
+  std::optional<int> option_275;
+  std::optional<int> option_276;
+  std::optional<int> option_277;
+  std::optional<int> option_278;
+  std::optional<int> option_279;
+  std::optional<int> option_280;
+  std::optional<int> option_281;
+  std::optional<int> option_282;
+  std::optional<int> option_283;
+  std::optional<int> option_284;
+  std::optional<int> option_285;
+  std::optional<int> option_286;
+  std::optional<int> option_287;
+  std::optional<int> option_288;
+  std::optional<int> option_289;
+  std::optional<int> option_290;
+  std::optional<int> option_291;
+  std::optional<int> option_292;
+  std::optional<int> option_293;
+  std::optional<int> option_294;
+  std::optional<int> option_295;
+  std::optional<int> option_296;
+  std::optional<int> option_297;
+  std::optional<int> option_298;
+  std::optional<int> option_299;
+  std::optional<bool> verbose = false;
+  std::string input_file;
+};
+STRUCTOPT(VeryWideOptions, option_000, option_001, option_002, option_003, option_004,
+         option_005, option_006, option_007, option_008, option_009, option_010,
+         option_011, option_012, option_013, option_014, option_015, option_016,
+         option_017, option_018, option_019, option_020, option_021, option_022,
+         option_023, option_024, option_025, option_026, option_027, option_028,
+         option_029, option_030, option_031, option_032, option_033, option_034,
+         option_035, option_036, option_037, option_038, option_039, option_040,
+         option_041, option_042, option_043, option_044, option_045, option_046,
+         option_047, option_048, option_049, option_050, option_051, option_052,
+         option_053, option_054, option_055, option_056, option_057, option_058,
+         option_059, option_060, option_061, option_062, option_063, option_064,
+         option_065, option_066, option_067, option_068, option_069, option_070,
+         option_071, option_072, option_073, option_074, option_075, option_076,
+         option_077, option_078, option_079, option_080, option_081, option_082,
+         option_083, option_084, option_085, option_086, option_087, option_088,
+         option_089, option_090, option_091, option_092, option_093, option_094,
+         option_095, option_096, option_097, option_098, option_099, option_100,
+         option_101, option_102, option_103, option_104, option_105, option_106,
+         option_107, option_108, option_109, option_110, option_111, option_112,
+         option_113, option_114, option_115, option_116, option_117, option_118,
+         option_119, option_120, option_121, option_122, option_123, option_124,
+         option_125, option_126, option_127, option_128, option_129, option_130,
+         option_131, option_132, option_133, option_134, option_135, option_136,
+         option_137, option_138, option_139, option_140, option_141, option_142,
+         option_143, option_144, option_145, option_146, option_147, option_148,
+         option_149, option_150, option_151, option_152, option_153, option_154,
+         option_155, option_156, option_157, option_158, option_159, option_160,
+         option_161, option_162, option_163, option_164, option_165, option_166,
+         option_167, option_168, option_169, option_170, option_171, option_172,
+         option_173, option_174, option_175, option_176, option_177, option_178,
+         option_179, option_180, option_181, option_182, option_183, option_184,
+         option_185, option_186, option_187, option_188, option_189, option_190,
+         option_191, option_192, option_193, option_194, option_195, option_196,
+         option_197, option_198, option_199, option_200, option_201, option_202,
+         option_203, option_204, option_205, option_206, option_207, option_208,
+         option_209, option_210, option_211, option_212, option_213, option_214,
+         option_215, option_216, option_217, option_218, option_219, option_220,
+         option_221, option_222, option_223, option_224, option_225, option_226,
+         option_227, option_228, option_229, option_230, option_231, option_232,
+         option_233, option_234, option_235, option_236, option_237, option_238,
+         option_239, option_240, option_241, option_242, option_243, option_244,
+         option_245, option_246, option_247, option_248, option_249, option_250,
+         option_251, option_252, option_253, option_254, option_255, option_256,
+         option_257, option_258, option_259, option_260, option_261, option_262,
+         option_263, option_264, option_265, option_266, option_267, option_268,
+         option_269, option_270, option_271, option_272, option_273, option_274,
+         option_275, option_276, option_277, option_278, option_279, option_280,
+         option_281, option_282, option_283, option_284, option_285, option_286,
+         option_287, option_288, option_289, option_290, option_291, option_292,
+         option_293, option_294, option_295, option_296, option_297, option_298,
+         option_299, verbose, input_file);
+
+TEST_CASE("structopt parses a struct with hundreds of fields" * test_suite("wide_struct")) {
+  REQUIRE(visit_struct::field_count<VeryWideOptions>() == 302);
+  {
+    auto arguments = structopt::app("test").parse<VeryWideOptions>(std::vector<std::string>{
+        "./main", "--option_000", "1", "--option-150", "2", "-v", "--option_299", "3", "foo.txt"});
+    REQUIRE(arguments.option_000 == 1);
+    REQUIRE(arguments.option_150 == 2);
+    REQUIRE(arguments.option_299 == 3);
+    REQUIRE(arguments.option_001.has_value() == false);
+    REQUIRE(arguments.verbose == true);
+    REQUIRE(arguments.input_file == "foo.txt");
+  }
+  {
+    bool exception_thrown = false;
+    try {
+      auto arguments = structopt::app("test").parse<VeryWideOptions>(
+          std::vector<std::string>{"./main", "--option_298", "x", "foo.txt"});
+    } catch (structopt::exception& e) {
+      exception_thrown = true;
+      REQUIRE(std::string{e.what()} == "Error: failed to parse numeric argument `option_298`. `x` is invalid.");
+    }
+    REQUIRE(exception_thrown == true);
+  }
+}
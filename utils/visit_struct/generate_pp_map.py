@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Generate the VISIT_STRUCT_PP_MAP macros of visit_struct.hpp
+
+Structs with up to BLOCK members map through one flat VISIT_STRUCT_APPLYF<N>
+macro. Wider structs map BLOCK members at a time: VISIT_STRUCT_APPLYF<N> applies
+VISIT_STRUCT_APPLYF<BLOCK> to the first BLOCK members and passes the rest on to
+VISIT_STRUCT_APPLYF<N - BLOCK>, through one VISIT_STRUCT_APPLY_BLOCK<level> macro
+per level, since a macro cannot expand itself. The header grows linearly with the
+maximum number of members, and so does the preprocessing of a struct.
+
+MSVC takes at most 127 macro arguments per macro, so the
+maximum stays at 69 members there.
+
+Usage: python3 utils/visit_struct/generate_pp_map.py [--max 1024]
+  rewrites the generated section of
+  include/structopt/third_party/visit_struct/visit_struct.hpp in place
+"""
+
+import argparse
+import os
+import re
+
+BLOCK = 64
+MSVC_MAX = 69
+HEADER = os.path.join(os.path.dirname(__file__), '..', '..', 'include', 'structopt',
+                      'third_party', 'visit_struct', 'visit_struct.hpp')
+BEGIN = '/*** Generated code ***/'
+END = '/*** End generated code ***/'
+
+
+def params(first, last):
+    return ','.join('_%d' % i for i in range(first, last + 1))
+
+
+def counting(maximum):
+    lines = ['#define VISIT_STRUCT_PP_ARG_N( \\']
+    names = ['_%d' % i for i in range(1, maximum + 1)]
+    for row in range(0, maximum, 10):
+        lines.append('        ' + ', '.join(names[row:row + 10]) + ',\\')
+    lines[-1] = lines[-1][:-len(',\\')] + ', N, ...) N'
+    lines.append('#define VISIT_STRUCT_PP_NARG(...) '
+                 'VISIT_STRUCT_EXPAND(VISIT_STRUCT_PP_ARG_N(__VA_ARGS__,  \\')
+    numbers = [str(i) for i in range(maximum, -1, -1)]
+    for row in range(0, maximum + 1, 10):
+        lines.append('        ' + ', '.join(numbers[row:row + 10]) + ',  \\')
+    lines[-1] = lines[-1][:-len(',  \\')] + '))'
+    return lines
+
+
+def generate(maximum):
+    lines = [
+        BEGIN,
+        '',
+        '#define VISIT_STRUCT_EXPAND(x) x',
+        '',
+        '#if defined(_MSC_VER) && !defined(__clang__)',
+        '// at most 127 macro arguments',
+        'static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = %d;' % MSVC_MAX,
+    ]
+    lines += counting(MSVC_MAX)
+    lines += [
+        '#else',
+        'static VISIT_STRUCT_CONSTEXPR const int max_visitable_members = %d;' % maximum,
+    ]
+    lines += counting(maximum)
+    lines += [
+        '#endif',
+        '',
+        '/* need extra level to force extra eval */',
+        '#define VISIT_STRUCT_CONCAT_(a,b) a ## b',
+        '#define VISIT_STRUCT_CONCAT(a,b) VISIT_STRUCT_CONCAT_(a,b)',
+        '',
+        '#define VISIT_STRUCT_APPLYF0(f)',
+    ]
+    for n in range(1, BLOCK + 1):
+        lines.append('#define VISIT_STRUCT_APPLYF%d(f,%s) %s' %
+                     (n, params(1, n), ' '.join('f(_%d)' % i for i in range(1, n + 1))))
+    lines.append('')
+    levels = (maximum - 1) // BLOCK
+    for level in range(1, levels + 1):
+        lines.append('#define VISIT_STRUCT_APPLY_BLOCK%d(NEXT,f,%s,...) '
+                     'VISIT_STRUCT_APPLYF%d(f,%s) VISIT_STRUCT_EXPAND(NEXT(f,__VA_ARGS__))' %
+                     (level, params(1, BLOCK), BLOCK, params(1, BLOCK)))
+    lines.append('')
+    for n in range(BLOCK + 1, maximum + 1):
+        lines.append('#define VISIT_STRUCT_APPLYF%d(f,...) VISIT_STRUCT_EXPAND('
+                     'VISIT_STRUCT_APPLY_BLOCK%d(VISIT_STRUCT_APPLYF%d,f,__VA_ARGS__))' %
+                     (n, (n - 1) // BLOCK, n - BLOCK))
+    lines += [
+        '',
+        '#define VISIT_STRUCT_APPLY_F_(M, ...) VISIT_STRUCT_EXPAND(M(__VA_ARGS__))',
+        '#define VISIT_STRUCT_PP_MAP(f, ...) VISIT_STRUCT_EXPAND(VISIT_STRUCT_APPLY_F_('
+        'VISIT_STRUCT_CONCAT(VISIT_STRUCT_APPLYF, VISIT_STRUCT_PP_NARG(__VA_ARGS__)), f, '
+        '__VA_ARGS__))',
+        '',
+        END,
+    ]
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--max', type=int, default=1024,
+                        help='maximum number of members of a struct')
+    args = parser.parse_args()
+    if args.max < BLOCK:
+        parser.error('--max must be at least %d' % BLOCK)
+
+    with open(HEADER) as f:
+        header = f.read()
+    pattern = re.compile(re.escape(BEGIN) + '.*?' + re.escape(END), re.DOTALL)
+    if not pattern.search(header):
+        raise SystemExit('generated section not found in ' + HEADER)
+    header = pattern.sub(lambda _: generate(args.max), header, count=1)
+    with open(HEADER, 'w') as f:
+        f.write(header)
+
+
+if __name__ == '__main__':
+    main()